@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        adc.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-18
- * @brief       ADC 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       ADC 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com/forum.php
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com/forum.php
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211018
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -29,22 +29,22 @@
 
 
 /******************************************************************************************/
-/* ADC  */
+/* ADC及引脚 定义 */
 
 #define ADC_ADCX_CHY_GPIO_PORT              GPIOA
 #define ADC_ADCX_CHY_GPIO_PIN               GPIO_PIN_3
-#define ADC_ADCX_CHY_GPIO_CLK_ENABLE()      do{ __HAL_RCC_GPIOA_CLK_ENABLE(); }while(0)          /* PAʱʹ */
+#define ADC_ADCX_CHY_GPIO_CLK_ENABLE()      do{ __HAL_RCC_GPIOA_CLK_ENABLE(); }while(0)          /* PA口时钟使能 */
 
 #define ADC_ADCX                            ADC1 
 #define ADC_ADCX_CHY                        ADC_CHANNEL_3
-#define ADC_ADCX_CHY_CLK_ENABLE()           do{ __HAL_RCC_ADC1_CLK_ENABLE(); }while(0)           /* ADC1 ʱʹ */
+#define ADC_ADCX_CHY_CLK_ENABLE()           do{ __HAL_RCC_ADC1_CLK_ENABLE(); }while(0)           /* ADC1 时钟使能 */
 
 /******************************************************************************************/
 
-void adc_init(void);                                                                             /* ADCʼ */
-void adc_channel_set(ADC_HandleTypeDef *adc_handle, uint32_t ch, uint32_t rank, uint32_t stime); /* ADCͨ */
-uint32_t adc_get_result(uint32_t ch);                                                            /* ȡADCֵ  */
-uint32_t adc_get_result_average(uint32_t ch, uint8_t times);                                     /* ADCƽֵ˲ */
+void adc_init(void);                                                                             /* ADC初始化 */
+void adc_channel_set(ADC_HandleTypeDef *adc_handle, uint32_t ch, uint32_t rank, uint32_t stime); /* ADC通道设置 */
+uint32_t adc_get_result(uint32_t ch);                                                            /* 获取ADC值  */
+uint32_t adc_get_result_average(uint32_t ch, uint8_t times);                                     /* 计算ADC的平均值（滤波） */
 
 #endif 
 
@@ -1,55 +1,100 @@
 /**
  ****************************************************************************************************
  * @file        atk_mw579.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2022-06-21
- * @brief       ATK-MW579ģ
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       ATK-MW579模块驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
  ****************************************************************************************************
  */
 
 #include "./BSP/ATK_MW579/atk_mw579.h"
+#include "./BSP/ATK_MW579/atk_mw579_at.h"
 #include "./SYSTEM/delay/delay.h"
 #include <string.h>
 #include <stdio.h>
 
-/* ATK-MW579ݽṹ */
+/* ATK-MW579数据结构体 */
 static struct
 {
     atk_mw579_uart_baudrate_t baudrate;
 } g_atk_mw579_sta;
 
+atk_mw579_conn_t g_atk_mw579_conn;
+
+/* 波特率枚举对应的数值, 顺序与atk_mw579_uart_baudrate_t一致 */
+static const uint32_t g_atk_mw579_baudrate_tbl[] =
+{
+    1200, 2400, 4800, 9600, 14400, 19200, 38400, 43000, 57600, 76800, 115200, 128000, 230400,
+};
+
+/* 扫描模块波特率时依次尝试的波特率, 从高到低 */
+static const atk_mw579_uart_baudrate_t g_atk_mw579_baudrate_scan[] =
+{
+    ATK_MW579_UART_BAUDRATE_230400,
+    ATK_MW579_UART_BAUDRATE_128000,
+    ATK_MW579_UART_BAUDRATE_115200,
+    ATK_MW579_UART_BAUDRATE_57600,
+    ATK_MW579_UART_BAUDRATE_38400,
+    ATK_MW579_UART_BAUDRATE_19200,
+    ATK_MW579_UART_BAUDRATE_9600,
+};
+
+/**
+ * @brief       获取波特率枚举对应的数值
+ * @param       baudrate: ATK-MW579 UART通讯波特率枚举
+ * @retval      波特率, 0表示参数错误
+ */
+uint32_t atk_mw579_baudrate_value(atk_mw579_uart_baudrate_t baudrate)
+{
+    if ((uint32_t)baudrate >= sizeof(g_atk_mw579_baudrate_tbl) / sizeof(g_atk_mw579_baudrate_tbl[0]))
+    {
+        return 0;
+    }
+    
+    return g_atk_mw579_baudrate_tbl[baudrate];
+}
+
 /**
- * @brief       ATK-MW579Ӳʼ
- * @param       
- * @retval      
+ * @brief       ATK-MW579硬件初始化
+ * @param       无
+ * @retval      无
  */
 static void atk_mw579_hw_init(void)
 {
     GPIO_InitTypeDef gpio_init_struct = {0};
     
-    /* ʹʱ */
+    /* 使能时钟 */
     ATK_MW579_STA_GPIO_CLK_ENABLE();
     ATK_MW579_WKUP_GPIO_CLK_ENABLE();
     
-    /* ʼSTA */
+    /* 初始化STA引脚, 双边沿中断 */
     gpio_init_struct.Pin    = ATK_MW579_STA_GPIO_PIN;
-    gpio_init_struct.Mode   = GPIO_MODE_INPUT;
+    gpio_init_struct.Mode   = GPIO_MODE_IT_RISING_FALLING;
     gpio_init_struct.Pull   = GPIO_PULLDOWN;
     gpio_init_struct.Speed  = GPIO_SPEED_FREQ_HIGH;
     HAL_GPIO_Init(ATK_MW579_STA_GPIO_PORT, &gpio_init_struct);
     
-    /* ʼWKUP */
+    g_atk_mw579_conn.sta = atk_mw579_get_conn_sta();
+    g_atk_mw579_conn.edge = 0;
+    g_atk_mw579_conn.up_tick = HAL_GetTick();
+    g_atk_mw579_conn.down_tick = g_atk_mw579_conn.up_tick;
+    g_atk_mw579_conn.disconnects = 0;
+    __HAL_GPIO_EXTI_CLEAR_IT(ATK_MW579_STA_GPIO_PIN);
+    HAL_NVIC_SetPriority(ATK_MW579_STA_INT_IRQn, 3, 3);             /* 只记录时刻, 最低优先级 */
+    HAL_NVIC_EnableIRQ(ATK_MW579_STA_INT_IRQn);
+    
+    /* 初始化WKUP引脚 */
     gpio_init_struct.Pin    = ATK_MW579_WKUP_GPIO_PIN;
     gpio_init_struct.Mode   = GPIO_MODE_OUTPUT_PP;
     gpio_init_struct.Pull   = GPIO_PULLUP;
@@ -60,87 +105,20 @@ static void atk_mw579_hw_init(void)
 }
 
 /**
- * @brief       ATK-MW579ʼ
- * @param       buadrate: ATK-MW579 UARTͨѶ
- * @retval      ATK_MW579_EOK  : ATK-MW579ʼɹ
- *              ATK_MW579_ERROR: ATK-MW579ʼʧ
+ * @brief       ATK-MW579初始化
+ * @param       buadrate: ATK-MW579 UART通讯波特率
+ * @retval      ATK_MW579_EOK  : ATK-MW579初始化成功
+ *              ATK_MW579_ERROR: ATK-MW579初始化失败
  */
 uint8_t atk_mw579_init(atk_mw579_uart_baudrate_t baudrate)
 {
     uint8_t ret;
     uint32_t _baudrate;
     
-    switch (baudrate)
+    _baudrate = atk_mw579_baudrate_value(baudrate);
+    if (_baudrate == 0)
     {
-        case ATK_MW579_UART_BAUDRATE_1200:
-        {
-            _baudrate = 1200;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_2400:
-        {
-            _baudrate = 2400;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_4800:
-        {
-            _baudrate = 4800;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_9600:
-        {
-            _baudrate = 9600;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_14400:
-        {
-            _baudrate = 14400;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_19200:
-        {
-            _baudrate = 19200;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_38400:
-        {
-            _baudrate = 38400;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_43000:
-        {
-            _baudrate = 43000;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_57600:
-        {
-            _baudrate = 57600;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_76800:
-        {
-            _baudrate = 76800;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_115200:
-        {
-            _baudrate = 115200;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_128000:
-        {
-            _baudrate = 1200;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_230400:
-        {
-            _baudrate = 230400;
-            break;
-        }
-        default:
-        {
-            return ATK_MW579_EINVAL;
-        }
+        return ATK_MW579_EINVAL;
     }
     
     atk_mw579_hw_init();
@@ -158,10 +136,10 @@ uint8_t atk_mw579_init(atk_mw579_uart_baudrate_t baudrate)
 }
 
 /**
- * @brief       ȡATK-MW579״̬
- * @param       
- * @retval      ATK_MW579_CONNECTED   : 
- *              ATK_MW579_DISCONNECTED: δ
+ * @brief       获取ATK-MW579连接状态
+ * @param       无
+ * @retval      ATK_MW579_CONNECTED   : 已连接
+ *              ATK_MW579_DISCONNECTED: 未连接
  */
 atk_mw579_conn_sta_t atk_mw579_get_conn_sta(void)
 {
@@ -174,18 +152,77 @@ atk_mw579_conn_sta_t atk_mw579_get_conn_sta(void)
 }
 
 /**
- * @brief       ATK-MW579ATָ
- * @param       cmd    : ͵ATָ
- *              ack    : ȴӦ
- *              timeout: ȴʱʱ
- * @retval      ATK_MW579_EOK     : ִгɹ
- *              ATK_MW579_ETIMEOUT: ȴӦʱִʧ
+ * @brief       ATK-MW579 STA引脚中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void ATK_MW579_STA_INT_IRQHandler(void)
+{
+    if (__HAL_GPIO_EXTI_GET_IT(ATK_MW579_STA_GPIO_PIN) != 0)
+    {
+        __HAL_GPIO_EXTI_CLEAR_IT(ATK_MW579_STA_GPIO_PIN);
+        g_atk_mw579_conn.edge_tick = HAL_GetTick();
+        g_atk_mw579_conn.edge = 1;
+    }
+}
+
+/**
+ * @brief       ATK-MW579连接状态机
+ * @note        STA引脚最后一次跳变后保持ATK_MW579_CONN_DEBOUNCE_MS不变才确认,
+ *              建立连接过程中的短暂跳变不会被当作一次断开
+ * @param       无
+ * @retval      ATK_MW579_CONN_EVT_NONE: 状态没有改变
+ *              ATK_MW579_CONN_EVT_UP  : 刚刚连接
+ *              ATK_MW579_CONN_EVT_DOWN: 刚刚断开
+ */
+atk_mw579_conn_evt_t atk_mw579_conn_poll(void)
+{
+    atk_mw579_conn_sta_t sta;
+    
+    if ((g_atk_mw579_conn.edge == 0) || ((HAL_GetTick() - g_atk_mw579_conn.edge_tick) < ATK_MW579_CONN_DEBOUNCE_MS))
+    {
+        return ATK_MW579_CONN_EVT_NONE;
+    }
+    
+    g_atk_mw579_conn.edge = 0;                                      /* 先清标志再读引脚, 之后的跳变会重新置位 */
+    sta = atk_mw579_get_conn_sta();
+    if (sta == g_atk_mw579_conn.sta)
+    {
+        return ATK_MW579_CONN_EVT_NONE;
+    }
+    
+    g_atk_mw579_conn.sta = sta;
+    if (sta == ATK_MW579_CONNECTED)
+    {
+        g_atk_mw579_conn.up_tick = HAL_GetTick();
+        return ATK_MW579_CONN_EVT_UP;
+    }
+    
+    g_atk_mw579_conn.down_tick = HAL_GetTick();
+    g_atk_mw579_conn.disconnects++;
+    return ATK_MW579_CONN_EVT_DOWN;
+}
+
+/**
+ * @brief       ATK-MW579发送AT指令
+ * @param       cmd    : 待发送的AT指令
+ *              ack    : 等待的响应
+ *              timeout: 等待超时时间
+ * @note        录制时(见atk_mw579_at.h)不发送, 只把指令加入异步脚本
+ * @retval      ATK_MW579_EOK     : 函数执行成功
+ *              ATK_MW579_ETIMEOUT: 等待期望应答超时，函数执行失败
+ *              ATK_MW579_ERROR   : 录制时脚本已满
  */
 uint8_t atk_mw579_send_at_cmd(char *cmd, char *ack, uint32_t timeout)
 {
     uint8_t *ret = NULL;
     
-    atk_mw579_uart_rx_restart();
+    if (g_atk_mw579_at.recording != 0)
+    {
+        return atk_mw579_at_add(cmd, ack, timeout);
+    }
+    
+    atk_mw579_uart_rx_flush();
     atk_mw579_uart_printf("%s\r\n", cmd);
     
     if ((ack == NULL) || (timeout == 0))
@@ -217,10 +254,10 @@ uint8_t atk_mw579_send_at_cmd(char *cmd, char *ack, uint32_t timeout)
 }
 
 /**
- * @brief       ATK-MW579ģʽ
- * @param       
- * @retval      ATK_MW579_EOK  : ATK-MW579ģʽɹ
- *              ATK_MW579_ERROR: ATK-MW579ģʽʧ
+ * @brief       ATK-MW579进入配置模式
+ * @param       无
+ * @retval      ATK_MW579_EOK  : ATK-MW579进入配置模式成功
+ *              ATK_MW579_ERROR: ATK-MW579进入配置模式失败
  */
 uint8_t atk_mw579_enter_config_mode(void)
 {
@@ -236,10 +273,10 @@ uint8_t atk_mw579_enter_config_mode(void)
 }
 
 /**
- * @brief       ATK-MW579 ATָ
- * @param       
- * @retval      ATK_MW579_EOK  : ATָԳɹ
- *              ATK_MW579_ERROR: ATָʧ
+ * @brief       ATK-MW579 AT指令测试
+ * @param       无
+ * @retval      ATK_MW579_EOK  : AT指令测试成功
+ *              ATK_MW579_ERROR: AT指令测试失败
  */
 uint8_t atk_mw579_at_test(void)
 {
@@ -259,10 +296,10 @@ uint8_t atk_mw579_at_test(void)
 }
 
 /**
- * @brief       ATK-MW579
- * @param       name: 
- * @retval      ATK_MW579_EOK  : ATK-MW579Ƴɹ
- *              ATK_MW579_ERROR: ATK-MW579ʧ
+ * @brief       设置ATK-MW579蓝牙名称
+ * @param       name: 蓝牙名称
+ * @retval      ATK_MW579_EOK  : 设置ATK-MW579蓝牙名称成功
+ *              ATK_MW579_ERROR: 设置ATK-MW579蓝牙名称失败
  */
 uint8_t atk_mw579_set_name(char *name)
 {
@@ -280,10 +317,10 @@ uint8_t atk_mw579_set_name(char *name)
 }
 
 /**
- * @brief       ATK-MW579ӭ
- * @param       hello: ӭ
- * @retval      ATK_MW579_EOK  : ATK-MW579ӭɹ
- *              ATK_MW579_ERROR: ATK-MW579ӭʧ
+ * @brief       设置ATK-MW579开机欢迎语
+ * @param       hello: 开机欢迎语
+ * @retval      ATK_MW579_EOK  : 设置ATK-MW579开机欢迎语成功
+ *              ATK_MW579_ERROR: 设置ATK-MW579开机欢迎语失败
  */
 uint8_t atk_mw579_set_hello(char *hello)
 {
@@ -301,7 +338,7 @@ uint8_t atk_mw579_set_hello(char *hello)
 }
 
 /**
- * @brief       ATK-MW579书
+ * @brief       设置ATK-MW579发射功率
  * @param       tpl: ATK_MW579_TPL_N20DBM: -20dBm
  *                   ATK_MW579_TPL_N14DBM: -14dBm
  *                   ATK_MW579_TPL_N8DBM : -8dBm
@@ -310,9 +347,9 @@ uint8_t atk_mw579_set_hello(char *hello)
  *                   ATK_MW579_TPL_P1DBM : +1dBm
  *                   ATK_MW579_TPL_P2DBM : +2dBm
  *                   ATK_MW579_TPL_P3DBM : +3dBm
- * @retval      ATK_MW579_EOK   : ATK-MW579书ʳɹ
- *              ATK_MW579_ERROR : ATK-MW579书ʧ
- *              ATK_MW579_EINVAL: 
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579发射功率成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579发射功率失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_tpl(atk_mw579_tpl_t tpl)
 {
@@ -379,14 +416,14 @@ uint8_t atk_mw579_set_tpl(atk_mw579_tpl_t tpl)
 }
 
 /**
- * @brief       ATK-MW579ڲ
- * @param       baudrate: 
- *              data    : λ
- *              pari    : Уλ
- *              stop    : ֹͣλ
- * @retval      ATK_MW579_EOK   : ATK-MW579ڲɹ
- *              ATK_MW579_ERROR : ATK-MW579ڲʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579串口参数
+ * @param       baudrate: 波特率
+ *              data    : 数据位
+ *              pari    : 校验位
+ *              stop    : 停止位
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579串口参数成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579串口参数失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_uart(atk_mw579_uart_baudrate_t baudrate, atk_mw579_uart_data_t data, atk_mw579_uart_pari_t pari, atk_mw579_uart_stop_t stop)
 {
@@ -397,77 +434,10 @@ uint8_t atk_mw579_set_uart(atk_mw579_uart_baudrate_t baudrate, atk_mw579_uart_da
     uint8_t _stop;
     char cmd[22];
     
-    switch (baudrate)
+    _baudrate = atk_mw579_baudrate_value(baudrate);
+    if (_baudrate == 0)
     {
-        case ATK_MW579_UART_BAUDRATE_1200:
-        {
-            _baudrate = 1200;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_2400:
-        {
-            _baudrate = 2400;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_4800:
-        {
-            _baudrate = 4800;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_9600:
-        {
-            _baudrate = 9600;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_14400:
-        {
-            _baudrate = 14400;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_19200:
-        {
-            _baudrate = 19200;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_38400:
-        {
-            _baudrate = 38400;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_43000:
-        {
-            _baudrate = 43000;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_57600:
-        {
-            _baudrate = 57600;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_76800:
-        {
-            _baudrate = 76800;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_115200:
-        {
-            _baudrate = 115200;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_128000:
-        {
-            _baudrate = 1200;
-            break;
-        }
-        case ATK_MW579_UART_BAUDRATE_230400:
-        {
-            _baudrate = 230400;
-            break;
-        }
-        default:
-        {
-            return ATK_MW579_EINVAL;
-        }
+        return ATK_MW579_EINVAL;
     }
     
     switch (data)
@@ -550,11 +520,11 @@ uint8_t atk_mw579_set_uart(atk_mw579_uart_baudrate_t baudrate, atk_mw579_uart_da
 }
 
 /**
- * @brief       ATK-MW579㲥ٶ
- * @param       adptim: 㲥ʱ䣬λ10msΧ2~1024
- * @retval      ATK_MW579_EOK   : ATK-MW579㲥ٶȳɹ
- *              ATK_MW579_ERROR : ATK-MW579㲥ٶʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579广播速度
+ * @param       adptim: 广播时间，单位：10ms，范围：2~1024
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579广播速度成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579广播速度失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_adptim(uint16_t adptim)
 {
@@ -577,12 +547,12 @@ uint8_t atk_mw579_set_adptim(uint16_t adptim)
 }
 
 /**
- * @brief       ATK-MW579·ƥ
- * @param       linkpassen: ATK_MW579_LINKPASSEN_ON : ʹ·ƥ
- *                          ATK_MW579_LINKPASSEN_OFF: ر·ƥ
- * @retval      ATK_MW579_EOK   : ATK-MW579·ƥɹ
- *              ATK_MW579_ERROR : ATK-MW579·ƥʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579链路匹配
+ * @param       linkpassen: ATK_MW579_LINKPASSEN_ON : 使能链路匹配
+ *                          ATK_MW579_LINKPASSEN_OFF: 关闭链路匹配
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579链路匹配成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579链路匹配失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_linkpassen(atk_mw579_linkpassen_t linkpassen)
 {
@@ -619,12 +589,12 @@ uint8_t atk_mw579_set_linkpassen(atk_mw579_linkpassen_t linkpassen)
 }
 
 /**
- * @brief       ATK-MW579LED
- * @param       leden: ATK_MW579_LEDEN_ON : ʹܰLED
- *                     ATK_MW579_LEDEN_OFF: رհLED
- * @retval      ATK_MW579_EOK   : ATK-MW579LEDɹ
- *              ATK_MW579_ERROR : ATK-MW579LEDʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579板载LED
+ * @param       leden: ATK_MW579_LEDEN_ON : 使能板载LED
+ *                     ATK_MW579_LEDEN_OFF: 关闭板载LED
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579板载LED成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579板载LED失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_leden(atk_mw579_leden_t leden)
 {
@@ -661,12 +631,12 @@ uint8_t atk_mw579_set_leden(atk_mw579_leden_t leden)
 }
 
 /**
- * @brief       ATK-MW579豸˯
- * @param       leden: ATK_MW579_SLAVESLEEPEN_ON : ʹܴ豸˯
- *                     ATK_MW579_SLAVESLEEPEN_OFF: رմ豸˯
- * @retval      ATK_MW579_EOK   : ATK-MW579豸˯߳ɹ
- *              ATK_MW579_ERROR : ATK-MW579豸˯ʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579从设备断连睡眠
+ * @param       leden: ATK_MW579_SLAVESLEEPEN_ON : 使能从设备断连睡眠
+ *                     ATK_MW579_SLAVESLEEPEN_OFF: 关闭从设备断连睡眠
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579从设备断连睡眠成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579从设备断连睡眠失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_slavesleepen(atk_mw579_slavesleepen_t slavesleepen)
 {
@@ -703,12 +673,12 @@ uint8_t atk_mw579_set_slavesleepen(atk_mw579_slavesleepen_t slavesleepen)
 }
 
 /**
- * @brief       ATK-MW579ͨ
- * @param       leden: ATK_MW579_MAXPUT_ON : ʹͨ
- *                     ATK_MW579_MAXPUT_OFF: رͨ
- * @retval      ATK_MW579_EOK   : ATK-MW579ͨɹ
- *              ATK_MW579_ERROR : ATK-MW579ͨʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579通信最大输出
+ * @param       leden: ATK_MW579_MAXPUT_ON : 使能通信最大输出
+ *                     ATK_MW579_MAXPUT_OFF: 关闭通信最大输出
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579通信最大输出成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579通信最大输出失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_maxput(atk_mw579_maxput_t maxput)
 {
@@ -745,15 +715,15 @@ uint8_t atk_mw579_set_maxput(atk_mw579_maxput_t maxput)
 }
 
 /**
- * @brief       ATK-MW579ģʽ
- * @param       leden: ATK_MW579_MODE_M: 豸ģʽ
- *                     ATK_MW579_MODE_S: 豸ģʽ
- *                     ATK_MW579_MODE_O: ۲ģʽ
- *                     ATK_MW579_MODE_B: 㲥ģʽ
- *                     ATK_MW579_MODE_I: iBeaconģʽ
- * @retval      ATK_MW579_EOK   : ATK-MW579ģʽɹ
- *              ATK_MW579_ERROR : ATK-MW579ģʽʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579工作模式
+ * @param       leden: ATK_MW579_MODE_M: 主设备模式
+ *                     ATK_MW579_MODE_S: 从设备模式
+ *                     ATK_MW579_MODE_O: 观察者模式
+ *                     ATK_MW579_MODE_B: 广播者模式
+ *                     ATK_MW579_MODE_I: iBeacon模式
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579工作模式成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579工作模式失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_mode(atk_mw579_mode_t mode)
 {
@@ -801,16 +771,23 @@ uint8_t atk_mw579_set_mode(atk_mw579_mode_t mode)
         return ATK_MW579_ERROR;
     }
     
-    delay_ms(100);
+    if (g_atk_mw579_at.recording != 0)
+    {
+        atk_mw579_at_settle(100);
+    }
+    else
+    {
+        delay_ms(100);
+    }
     
     return ATK_MW579_EOK;
 }
 
 /**
- * @brief       ATK-MW579ɨΧ豸
- * @param       
- * @retval      ATK_MW579_EOK   : ATK-MW579ɨΧ豸ɹ
- *              ATK_MW579_ERROR : ATK-MW579ɨΧ豸ʧ
+ * @brief       ATK-MW579扫描周围从设备
+ * @param       无
+ * @retval      ATK_MW579_EOK   : ATK-MW579扫描周围从设备成功
+ *              ATK_MW579_ERROR : ATK-MW579扫描周围从设备失败
  */
 uint8_t atk_mw579_scan_slave(void)
 {
@@ -826,10 +803,10 @@ uint8_t atk_mw579_scan_slave(void)
 }
 
 /**
- * @brief       ATK-MW579Χ豸
- * @param       id: ɨ豸
- * @retval      ATK_MW579_EOK   : ATK-MW579Χ豸ɹ
- *              ATK_MW579_ERROR : ATK-MW579Χ豸ʧ
+ * @brief       ATK-MW579连接周围从设备
+ * @param       id: 扫描出从设备的序号
+ * @retval      ATK_MW579_EOK   : ATK-MW579连接周围从设备成功
+ *              ATK_MW579_ERROR : ATK-MW579连接周围从设备失败
  */
 uint8_t atk_mw579_conn_slave(uint8_t id)
 {
@@ -847,10 +824,10 @@ uint8_t atk_mw579_conn_slave(uint8_t id)
 }
 
 /**
- * @brief       ATK-MW579͸
- * @param       
- * @retval      ATK_MW579_EOK   : ATK-MW579͸ɹ
- *              ATK_MW579_ERROR : ATK-MW579͸ʧ
+ * @brief       ATK-MW579进入透传
+ * @param       无
+ * @retval      ATK_MW579_EOK   : ATK-MW579进入透传成功
+ *              ATK_MW579_ERROR : ATK-MW579进入透传失败
  */
 uint8_t atk_mw579_enter_unvarnished(void)
 {
@@ -868,11 +845,11 @@ uint8_t atk_mw579_enter_unvarnished(void)
 }
 
 /**
- * @brief       ATK-MW579·ƥ
- * @param       pass: ·ƥ룬֧֡ӢġţȱΪ6λ
- * @retval      ATK_MW579_EOK   : ATK-MW579·ƥɹ
- *              ATK_MW579_ERROR : ATK-MW579·ƥʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579链路匹配密码
+ * @param       pass: 链路匹配密码，支持数字、英文、符号，长度必须为6位
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579链路匹配密码成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579链路匹配密码失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_linkpass(char *pass)
 {
@@ -895,13 +872,13 @@ uint8_t atk_mw579_set_linkpass(char *pass)
 }
 
 /**
- * @brief       ATK-MW579Զ˯
- * @param       autosleepen: ATK_MW579_AUTOSLEEPEN_ON : ʹԶ˯
- *                           ATK_MW579_AUTOSLEEPEN_OFF: رԶ˯
- *              autotim    : Զ˯ʱ䣬λ5sΧ1~100
- * @retval      ATK_MW579_EOK   : ATK-MW579Զ˯߳ɹ
- *              ATK_MW579_ERROR : ATK-MW579Զ˯ʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579自动睡眠
+ * @param       autosleepen: ATK_MW579_AUTOSLEEPEN_ON : 使能自动睡眠
+ *                           ATK_MW579_AUTOSLEEPEN_OFF: 关闭自动睡眠
+ *              autotim    : 自动睡眠时间，单位：5s，范围：1~100
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579自动睡眠成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579自动睡眠失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_autosleepen(atk_mw579_autosleepen_t autosleepen, uint8_t autotim)
 {
@@ -943,12 +920,12 @@ uint8_t atk_mw579_set_autosleepen(atk_mw579_autosleepen_t autosleepen, uint8_t a
 }
 
 /**
- * @brief       ATK-MW579Զ˯ģʽ
- * @param       autosleep: ATK_MW579_AUTOSLEEP_LOW : ǳ˯
- *                         ATK_MW579_AUTOSLEEP_DEEP: ˯
- * @retval      ATK_MW579_EOK   : ATK-MW579Զ˯ģʽɹ
- *              ATK_MW579_ERROR : ATK-MW579Զ˯ģʽʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579自动睡眠模式
+ * @param       autosleep: ATK_MW579_AUTOSLEEP_LOW : 浅睡眠
+ *                         ATK_MW579_AUTOSLEEP_DEEP: 深度睡眠
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579自动睡眠模式成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579自动睡眠模式失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_autosleep(atk_mw579_autosleep_t autosleep)
 {
@@ -985,12 +962,12 @@ uint8_t atk_mw579_set_autosleep(atk_mw579_autosleep_t autosleep)
 }
 
 /**
- * @brief       ATK-MW579ϵ˯
- * @param       powersleepen: ATK_MW579_POWERSLEEPEN_ON : ʹϵ˯
- *                            ATK_MW579_POWERSLEEPEN_OFF: رϵ˯
- * @retval      ATK_MW579_EOK   : ATK-MW579ϵ˯߳ɹ
- *              ATK_MW579_ERROR : ATK-MW579ϵ˯ʧ
- *              ATK_MW579_EINVAL: 
+ * @brief       设置ATK-MW579上电睡眠
+ * @param       powersleepen: ATK_MW579_POWERSLEEPEN_ON : 使能上电睡眠
+ *                            ATK_MW579_POWERSLEEPEN_OFF: 关闭上电睡眠
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579上电睡眠成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579上电睡眠失败
+ *              ATK_MW579_EINVAL: 函数参数错误
  */
 uint8_t atk_mw579_set_powersleepen(atk_mw579_powersleepen_t powersleepen)
 {
@@ -1027,13 +1004,13 @@ uint8_t atk_mw579_set_powersleepen(atk_mw579_powersleepen_t powersleepen)
 }
 
 /**
- * @brief       ATK-MW579 iBeacon
- * @param       uuid : ʶ
- *              major: ʶ
- *              minor: αʶ
- *              rssi : 1ʱźǿ
- * @retval      ATK_MW579_EOK   : ATK-MW579 iBeaconɹ
- *              ATK_MW579_ERROR : ATK-MW579 iBeaconʧ
+ * @brief       设置ATK-MW579 iBeacon
+ * @param       uuid : 标识符
+ *              major: 主标识
+ *              minor: 次标识
+ *              rssi : 距离1米时的信号强度
+ * @retval      ATK_MW579_EOK   : 设置ATK-MW579 iBeacon成功
+ *              ATK_MW579_ERROR : 设置ATK-MW579 iBeacon失败
  */
 uint8_t atk_mw579_set_ibeacon(char *uuid, uint16_t major, uint16_t minor, uint8_t rssi)
 {
@@ -1051,9 +1028,9 @@ uint8_t atk_mw579_set_ibeacon(char *uuid, uint16_t major, uint16_t minor, uint8_
 }
 
 /**
- * @brief       ͨWKUPŻATK-MW579
- * @param       
- * @retval      
+ * @brief       通过WKUP引脚唤醒ATK-MW579
+ * @param       无
+ * @retval      无
  */
 void atk_mw579_wakeup_by_pin(void)
 {
@@ -1064,9 +1041,9 @@ void atk_mw579_wakeup_by_pin(void)
 }
 
 /**
- * @brief       ͨUARTATK-MW579
- * @param       
- * @retval      
+ * @brief       通过UART唤醒ATK-MW579
+ * @param       无
+ * @retval      无
  */
 void atk_mw579_wakeup_by_uart(void)
 {
@@ -1119,3 +1096,172 @@ void atk_mw579_wakeup_by_uart(void)
         atk_mw579_uart_printf("0");
     }
 }
+
+/**
+ * @brief       获取ATK-MW579当前的UART通讯波特率
+ * @param       无
+ * @retval      波特率枚举
+ */
+atk_mw579_uart_baudrate_t atk_mw579_get_baudrate(void)
+{
+    return g_atk_mw579_sta.baudrate;
+}
+
+/**
+ * @brief       验证当前波特率下的链路
+ * @note        连续ATK_MW579_BAUD_VERIFY_NUM次AT往返都要在第一次发送时成功, 期间UART不能出现
+ *              帧错误/噪声/过载; 临界的波特率偶尔能应答, 用单次AT测试发现不了
+ * @param       无
+ * @retval      ATK_MW579_EOK  : 链路稳定
+ *              ATK_MW579_ERROR: 链路不稳定
+ */
+static uint8_t atk_mw579_verify_baudrate(void)
+{
+    uint32_t errors;
+    uint8_t loop;
+    
+    if (atk_mw579_at_test() != ATK_MW579_EOK)                   /* 先同步, 丢掉切换时的乱码 */
+    {
+        return ATK_MW579_ERROR;
+    }
+    
+    errors = g_atk_mw579_uart_rx_sta.errors;
+    for (loop=0; loop<ATK_MW579_BAUD_VERIFY_NUM; loop++)
+    {
+        if (atk_mw579_send_at_cmd("AT", "OK", 50) != ATK_MW579_EOK)
+        {
+            return ATK_MW579_ERROR;
+        }
+    }
+    
+    if (g_atk_mw579_uart_rx_sta.errors != errors)
+    {
+        return ATK_MW579_ERROR;
+    }
+    
+    return ATK_MW579_EOK;
+}
+
+/**
+ * @brief       扫描ATK-MW579当前的UART通讯波特率
+ * @note        模块把波特率保存在自己的Flash中, 主控记录的波特率丢失或与模块不一致时用来找回;
+ *              每个波特率最多约2s
+ * @param       无
+ * @retval      ATK_MW579_EOK  : 已找到, UART已切换到该波特率
+ *              ATK_MW579_ERROR: 所有波特率都没有应答
+ */
+uint8_t atk_mw579_find_baudrate(void)
+{
+    uint8_t i;
+    
+    for (i=0; i<sizeof(g_atk_mw579_baudrate_scan) / sizeof(g_atk_mw579_baudrate_scan[0]); i++)
+    {
+        atk_mw579_uart_set_baudrate(atk_mw579_baudrate_value(g_atk_mw579_baudrate_scan[i]));
+        atk_mw579_enter_config_mode();
+        if (atk_mw579_at_test() == ATK_MW579_EOK)
+        {
+            g_atk_mw579_sta.baudrate = g_atk_mw579_baudrate_scan[i];
+            return ATK_MW579_EOK;
+        }
+    }
+    
+    return ATK_MW579_ERROR;
+}
+
+/**
+ * @brief       切换ATK-MW579和UART的通讯波特率, 验证失败时自动退回
+ * @note        需要先进入配置模式; 数据位8, 无校验, 停止位1.
+ *              不确定模块是在应答OK后立即切换, 还是重新上电后才生效, 所以退回时两种情况都要
+ *              处理: 先在原波特率下试, 模块没有切换就撤销已保存的设置; 否则在新波特率下
+ *              尽力发送原设置; 都不行时扫描模块的实际波特率
+ * @param       baudrate: 新波特率
+ * @retval      ATK_MW579_EOK   : 已切换并验证
+ *              ATK_MW579_ERROR : 新波特率验证失败, 已退回原波特率
+ *              ATK_MW579_EINVAL: 函数参数错误
+ */
+uint8_t atk_mw579_switch_baudrate(atk_mw579_uart_baudrate_t baudrate)
+{
+    atk_mw579_uart_baudrate_t old = g_atk_mw579_sta.baudrate;
+    uint32_t _baudrate;
+    
+    _baudrate = atk_mw579_baudrate_value(baudrate);
+    if (_baudrate == 0)
+    {
+        return ATK_MW579_EINVAL;
+    }
+    
+    if (baudrate == old)
+    {
+        return ATK_MW579_EOK;
+    }
+    
+    if (atk_mw579_set_uart(baudrate, ATK_MW579_UART_DATA_8, ATK_MW579_UART_PARI_NONE, ATK_MW579_UART_STOP_1) != ATK_MW579_EOK)
+    {
+        return ATK_MW579_ERROR;
+    }
+    
+    atk_mw579_uart_set_baudrate(_baudrate);
+    delay_ms(ATK_MW579_BAUD_SETTLE_MS);
+    if (atk_mw579_verify_baudrate() == ATK_MW579_EOK)
+    {
+        g_atk_mw579_sta.baudrate = baudrate;
+        return ATK_MW579_EOK;
+    }
+    
+    /* 退回原波特率 */
+    atk_mw579_uart_set_baudrate(atk_mw579_baudrate_value(old));
+    delay_ms(ATK_MW579_BAUD_SETTLE_MS);
+    if (atk_mw579_at_test() == ATK_MW579_EOK)
+    {
+        /* 模块还没有切换, 撤销已保存的新设置 */
+        atk_mw579_set_uart(old, ATK_MW579_UART_DATA_8, ATK_MW579_UART_PARI_NONE, ATK_MW579_UART_STOP_1);
+        return ATK_MW579_ERROR;
+    }
+    
+    /* 模块已经切换但链路不稳定, 在新波特率下把原设置发回去 */
+    atk_mw579_uart_set_baudrate(_baudrate);
+    delay_ms(ATK_MW579_BAUD_SETTLE_MS);
+    atk_mw579_at_test();
+    atk_mw579_set_uart(old, ATK_MW579_UART_DATA_8, ATK_MW579_UART_PARI_NONE, ATK_MW579_UART_STOP_1);
+    atk_mw579_uart_set_baudrate(atk_mw579_baudrate_value(old));
+    delay_ms(ATK_MW579_BAUD_SETTLE_MS);
+    if (atk_mw579_at_test() != ATK_MW579_EOK)
+    {
+        atk_mw579_find_baudrate();
+    }
+    
+    return ATK_MW579_ERROR;
+}
+
+/**
+ * @brief       协商ATK-MW579的最高稳定波特率
+ * @note        需要先进入配置模式; 从max开始向下逐个尝试比当前高的波特率, 每个都经过验证,
+ *              失败时已自动退回, 最差保持当前波特率
+ * @param       max: 尝试的最高波特率
+ * @retval      ATK_MW579_EOK  : 已切换到更高的波特率, 或当前已经是max
+ *              ATK_MW579_ERROR: 更高的波特率都不稳定, 保持当前波特率
+ */
+uint8_t atk_mw579_tune_baudrate(atk_mw579_uart_baudrate_t max)
+{
+    uint8_t i;
+    
+    if (g_atk_mw579_sta.baudrate >= max)
+    {
+        return ATK_MW579_EOK;
+    }
+    
+    for (i=0; i<sizeof(g_atk_mw579_baudrate_scan) / sizeof(g_atk_mw579_baudrate_scan[0]); i++)
+    {
+        if ((g_atk_mw579_baudrate_scan[i] > max) || (g_atk_mw579_baudrate_scan[i] <= g_atk_mw579_sta.baudrate))
+        {
+            continue;
+        }
+        
+        if (atk_mw579_switch_baudrate(g_atk_mw579_baudrate_scan[i]) == ATK_MW579_EOK)
+        {
+            return ATK_MW579_EOK;
+        }
+    }
+    
+    return ATK_MW579_ERROR;
+}
@@ -1,19 +1,19 @@
 /**
  ****************************************************************************************************
  * @file        atk_mw579.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2022-06-21
- * @brief       ATK-MW579ģ
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       ATK-MW579模块驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
  ****************************************************************************************************
  */
@@ -24,29 +24,53 @@
 #include "./SYSTEM/sys/sys.h"
 #include "./BSP/ATK_MW579/atk_mw579_uart.h"
 
-/* Ŷ */
+/* 引脚定义 */
 #define ATK_MW579_STA_GPIO_PORT             GPIOI
 #define ATK_MW579_STA_GPIO_PIN              GPIO_PIN_10
 #define ATK_MW579_STA_GPIO_CLK_ENABLE()    do{ __HAL_RCC_GPIOI_CLK_ENABLE(); }while(0)
 #define ATK_MW579_WKUP_GPIO_PORT            GPIOI
 #define ATK_MW579_WKUP_GPIO_PIN             GPIO_PIN_11
 #define ATK_MW579_WKUP_GPIO_CLK_ENABLE()    do{ __HAL_RCC_GPIOI_CLK_ENABLE(); }while(0)
+#define ATK_MW579_STA_INT_IRQn              EXTI15_10_IRQn
+#define ATK_MW579_STA_INT_IRQHandler        EXTI15_10_IRQHandler
 
-/* IO */
-#define ATK_MW579_READ_STA()                HAL_GPIO_ReadPin(ATK_MW579_STA_GPIO_PORT, ATK_MW579_STA_GPIO_PIN)
-#define ATK_MW579_WKUP(x)                   do{ x ?                                                                                     \
-                                                HAL_GPIO_WritePin(ATK_MW579_WKUP_GPIO_PORT, ATK_MW579_WKUP_GPIO_PIN, GPIO_PIN_SET) :    \
-                                                HAL_GPIO_WritePin(ATK_MW579_WKUP_GPIO_PORT, ATK_MW579_WKUP_GPIO_PIN, GPIO_PIN_RESET);   \
-                                            }while(0)
+/* 引脚描述符: 端口, 引脚, 有效电平 */
+#define ATK_MW579_STA_IO                    ATK_MW579_STA_GPIO_PORT, ATK_MW579_STA_GPIO_PIN, 0      /* 低电平表示已连接 */
+#define ATK_MW579_WKUP_IO                   ATK_MW579_WKUP_GPIO_PORT, ATK_MW579_WKUP_GPIO_PIN, 0    /* 低电平唤醒 */
 
-/* ״̬ö */
+/* IO操作 */
+#define ATK_MW579_READ_STA()                SYS_IO_READ(ATK_MW579_STA_IO)
+#define ATK_MW579_WKUP(x)                   do{ SYS_IO_WRITE(ATK_MW579_WKUP_IO, x); }while(0)
+
+/* 连接状态枚举 */
 typedef enum
 {
-    ATK_MW579_CONNECTED = 0x00,             /*  */
-    ATK_MW579_DISCONNECTED,                 /* δ */
+    ATK_MW579_CONNECTED = 0x00,             /* 已连接 */
+    ATK_MW579_DISCONNECTED,                 /* 未连接 */
 } atk_mw579_conn_sta_t;
 
-/* 书ö */
+/* 连接事件枚举 */
+typedef enum
+{
+    ATK_MW579_CONN_EVT_NONE = 0x00,         /* 状态没有改变 */
+    ATK_MW579_CONN_EVT_UP,                  /* 已连接 */
+    ATK_MW579_CONN_EVT_DOWN,                /* 已断开 */
+} atk_mw579_conn_evt_t;
+
+/* 连接状态机: STA引脚的跳变由EXTI中断记录, 主循环中消抖后确认 */
+typedef struct
+{
+    atk_mw579_conn_sta_t sta;               /* 已确认的连接状态 */
+    volatile uint8_t edge;                  /* STA引脚有跳变, 等待消抖 */
+    volatile uint32_t edge_tick;            /* 最后一次跳变的时刻 */
+    uint32_t up_tick;                       /* 最近一次连接的时刻 */
+    uint32_t down_tick;                     /* 最近一次断开的时刻 */
+    uint32_t disconnects;                   /* 断开次数 */
+} atk_mw579_conn_t;
+
+extern atk_mw579_conn_t g_atk_mw579_conn;
+
+/* 发射功率枚举 */
 typedef enum
 {
     ATK_MW579_TPL_N20DBM = 0x00,            /* -20dBm */
@@ -59,7 +83,7 @@ typedef enum
     ATK_MW579_TPL_P3DBM,                    /* +3dBm */
 } atk_mw579_tpl_t;
 
-/* ڲö */
+/* 串口波特率枚举 */
 typedef enum
 {
     ATK_MW579_UART_BAUDRATE_1200 = 0x00,    /* 1200bps */
@@ -77,120 +101,133 @@ typedef enum
     ATK_MW579_UART_BAUDRATE_230400,         /* 230400bps */
 } atk_mw579_uart_baudrate_t;
 
-/*λö */
+/*串口数据位枚举 */
 typedef enum
 {
-    ATK_MW579_UART_DATA_5 = 0x00,           /* 5λλ */
-    ATK_MW579_UART_DATA_6,                  /* 6λλ */
-    ATK_MW579_UART_DATA_7,                  /* 7λλ */
-    ATK_MW579_UART_DATA_8,                  /* 8λλ */
+    ATK_MW579_UART_DATA_5 = 0x00,           /* 5位数据位 */
+    ATK_MW579_UART_DATA_6,                  /* 6位数据位 */
+    ATK_MW579_UART_DATA_7,                  /* 7位数据位 */
+    ATK_MW579_UART_DATA_8,                  /* 8位数据位 */
 } atk_mw579_uart_data_t;
 
-/* Уλö */
+/* 串口校验位枚举 */
 typedef enum
 {
-    ATK_MW579_UART_PARI_NONE = 0x00,        /* У */
-    ATK_MW579_UART_PARI_ODD,                /* У */
-    ATK_MW579_UART_PARI_EVEN,               /* żУ */
+    ATK_MW579_UART_PARI_NONE = 0x00,        /* 无校验 */
+    ATK_MW579_UART_PARI_ODD,                /* 奇校验 */
+    ATK_MW579_UART_PARI_EVEN,               /* 偶校验 */
 } atk_mw579_uart_pari_t;
 
-/* ֹͣλö */
+/* 串口停止位枚举 */
 typedef enum
 {
-    ATK_MW579_UART_STOP_1 = 0x00,           /* 1λֹͣλ */
-    ATK_MW579_UART_STOP_2,                  /* 2λֹͣλ */
+    ATK_MW579_UART_STOP_1 = 0x00,           /* 1位停止位 */
+    ATK_MW579_UART_STOP_2,                  /* 2位停止位 */
 } atk_mw579_uart_stop_t;
 
-/* ·ƥö */
+/* 链路匹配连接枚举 */
 typedef enum
 {
-    ATK_MW579_LINKPASSEN_ON = 0x00,         /* ʹ·ƥ */
-    ATK_MW579_LINKPASSEN_OFF,               /* ر·ƥ */
+    ATK_MW579_LINKPASSEN_ON = 0x00,         /* 使能链路匹配 */
+    ATK_MW579_LINKPASSEN_OFF,               /* 关闭链路匹配 */
 } atk_mw579_linkpassen_t;
 
-/* LEDö */
+/* 板载LED枚举 */
 typedef enum
 {
-    ATK_MW579_LEDEN_ON = 0x00,              /* ʹܰLED */
-    ATK_MW579_LEDEN_OFF,                    /* رհLED */
+    ATK_MW579_LEDEN_ON = 0x00,              /* 使能板载LED */
+    ATK_MW579_LEDEN_OFF,                    /* 关闭板载LED */
 } atk_mw579_leden_t;
 
-/* 豸˯ö */
+/* 从设备断连睡眠枚举 */
 typedef enum
 {
-    ATK_MW579_SLAVESLEEPEN_ON = 0x00,       /* ʹܴ豸˯ */
-    ATK_MW579_SLAVESLEEPEN_OFF,             /* رմ豸˯ */
+    ATK_MW579_SLAVESLEEPEN_ON = 0x00,       /* 使能从设备断连睡眠 */
+    ATK_MW579_SLAVESLEEPEN_OFF,             /* 关闭从设备断连睡眠 */
 } atk_mw579_slavesleepen_t;
 
-/* ͨö */
+/* 通信最大输出枚举 */
 typedef enum
 {
-    ATK_MW579_MAXPUT_ON = 0x00,             /* ʹͨ */
-    ATK_MW579_MAXPUT_OFF,                   /* رͨ */
+    ATK_MW579_MAXPUT_ON = 0x00,             /* 使能通信最大输出 */
+    ATK_MW579_MAXPUT_OFF,                   /* 关闭通信最大输出 */
 } atk_mw579_maxput_t;
 
-/* ģʽö */
+/* 工作模式枚举 */
 typedef enum
 {
-    ATK_MW579_MODE_M = 0x00,                /* 豸ģʽ */
-    ATK_MW579_MODE_S,                       /* 豸ģʽ */
-    ATK_MW579_MODE_O,                       /* ۲ģʽ */
-    ATK_MW579_MODE_B,                       /* 㲥ģʽ */
-    ATK_MW579_MODE_I,                       /* iBeaconģʽ */
+    ATK_MW579_MODE_M = 0x00,                /* 主设备模式 */
+    ATK_MW579_MODE_S,                       /* 从设备模式 */
+    ATK_MW579_MODE_O,                       /* 观察者模式 */
+    ATK_MW579_MODE_B,                       /* 广播者模式 */
+    ATK_MW579_MODE_I,                       /* iBeacon模式 */
 } atk_mw579_mode_t;
 
-/* Զ˯ö */
+/* 自动睡眠枚举 */
 typedef enum
 {
-    ATK_MW579_AUTOSLEEPEN_ON = 0x00,        /* ʹԶ˯ */
-    ATK_MW579_AUTOSLEEPEN_OFF,              /* رԶ˯ */
+    ATK_MW579_AUTOSLEEPEN_ON = 0x00,        /* 使能自动睡眠 */
+    ATK_MW579_AUTOSLEEPEN_OFF,              /* 关闭自动睡眠 */
 } atk_mw579_autosleepen_t;
 
-/* Զ˯ģʽö */
+/* 自动睡眠模式枚举 */
 typedef enum
 {
-    ATK_MW579_AUTOSLEEP_LOW = 0x00,         /* ǳ˯ */
-    ATK_MW579_AUTOSLEEP_DEEP,               /* ˯ */
+    ATK_MW579_AUTOSLEEP_LOW = 0x00,         /* 浅睡眠 */
+    ATK_MW579_AUTOSLEEP_DEEP,               /* 深度睡眠 */
 } atk_mw579_autosleep_t;
 
-/* ϵ˯ö */
+/* 上电睡眠枚举 */
 typedef enum
 {
-    ATK_MW579_POWERSLEEPEN_ON = 0x00,       /* ʹϵ˯ */
-    ATK_MW579_POWERSLEEPEN_OFF,             /* رϵ˯ */
+    ATK_MW579_POWERSLEEPEN_ON = 0x00,       /* 使能上电睡眠 */
+    ATK_MW579_POWERSLEEPEN_OFF,             /* 关闭上电睡眠 */
 } atk_mw579_powersleepen_t;
 
-/*  */
-#define ATK_MW579_EOK      0                /* ûд */
-#define ATK_MW579_ERROR    1                /*  */
-#define ATK_MW579_ETIMEOUT 2                /* ʱ */
-#define ATK_MW579_EINVAL   3                /*  */
-
-/*  */
-uint8_t atk_mw579_init(atk_mw579_uart_baudrate_t baudrate);                                                                                         /* ATK-MW579ʼ */
-atk_mw579_conn_sta_t atk_mw579_get_conn_sta(void);                                                                                                  /* ȡATK-MW579״̬ */
-uint8_t atk_mw579_send_at_cmd(char *cmd, char *ack, uint32_t timeout);                                                                              /* ATK-MW579ATָ */
-uint8_t atk_mw579_enter_config_mode(void);                                                                                                          /* ATK-MW579ģʽ */
-uint8_t atk_mw579_at_test(void);                                                                                                                    /* ATK-MW579 ATָ */
-uint8_t atk_mw579_set_name(char *name);                                                                                                             /* ATK-MW579 */
-uint8_t atk_mw579_set_hello(char *hello);                                                                                                           /* ATK-MW579ӭ */
-uint8_t atk_mw579_set_tpl(atk_mw579_tpl_t tpl);                                                                                                     /* ATK-MW579书 */
-uint8_t atk_mw579_set_uart(atk_mw579_uart_baudrate_t baudrate, atk_mw579_uart_data_t data, atk_mw579_uart_pari_t pari, atk_mw579_uart_stop_t stop); /* ATK-MW579ڲ */
-uint8_t atk_mw579_set_adptim(uint16_t adptim);                                                                                                      /* ATK-MW579㲥ٶ */
-uint8_t atk_mw579_set_linkpassen(atk_mw579_linkpassen_t linkpassen);                                                                                /* ATK-MW579·ƥ */
-uint8_t atk_mw579_set_leden(atk_mw579_leden_t leden);                                                                                               /* ATK-MW579LED */
-uint8_t atk_mw579_set_slavesleepen(atk_mw579_slavesleepen_t slavesleepen);                                                                          /* ATK-MW579豸˯ */
-uint8_t atk_mw579_set_maxput(atk_mw579_maxput_t maxput);                                                                                            /* ATK-MW579ͨ */
-uint8_t atk_mw579_set_mode(atk_mw579_mode_t mode);                                                                                                  /* ATK-MW579ģʽ */
-uint8_t atk_mw579_scan_slave(void);                                                                                                                 /* ATK-MW579ɨΧ豸 */
-uint8_t atk_mw579_conn_slave(uint8_t id);                                                                                                           /* ATK-MW579Χ豸 */
-uint8_t atk_mw579_enter_unvarnished(void);                                                                                                          /* ATK-MW579͸ */
-uint8_t atk_mw579_set_linkpass(char *pass);                                                                                                         /* ATK-MW579·ƥ */
-uint8_t atk_mw579_set_autosleepen(atk_mw579_autosleepen_t autosleepen, uint8_t autotim);                                                            /* ATK-MW579Զ˯ */
-uint8_t atk_mw579_set_autosleep(atk_mw579_autosleep_t autosleep);                                                                                   /* ATK-MW579Զ˯ģʽ */
-uint8_t atk_mw579_set_powersleepen(atk_mw579_powersleepen_t powersleepen);                                                                          /* ATK-MW579ϵ˯ */
-uint8_t atk_mw579_set_ibeacon(char *uuid, uint16_t major, uint16_t minor, uint8_t rssi);                                                            /* ATK-MW579 iBeacon */
-void atk_mw579_wakeup_by_pin(void);                                                                                                                 /* ͨWKUPŻATK-MW579 */
-void atk_mw579_wakeup_by_uart(void);                                                                                                                /* ͨUARTATK-MW579 */
+/* 错误代码 */
+#define ATK_MW579_EOK      0                /* 没有错误 */
+#define ATK_MW579_ERROR    1                /* 错误 */
+#define ATK_MW579_ETIMEOUT 2                /* 超时错误 */
+#define ATK_MW579_EINVAL   3                /* 参数错误 */
+
+/* 波特率协商 */
+#define ATK_MW579_BAUD_VERIFY_NUM   16      /* 验证新波特率时连续成功的AT往返次数 */
+#define ATK_MW579_BAUD_SETTLE_MS    20      /* 切换波特率后等待模块稳定的时间 */
+
+/* 连接状态 */
+#define ATK_MW579_CONN_DEBOUNCE_MS  50      /* STA引脚保持该时间不变才确认连接状态改变 */
+
+/* 操作函数 */
+uint8_t atk_mw579_init(atk_mw579_uart_baudrate_t baudrate);                                                                                         /* ATK-MW579初始化 */
+atk_mw579_conn_sta_t atk_mw579_get_conn_sta(void);                                                                                                  /* 获取ATK-MW579连接状态 */
+atk_mw579_conn_evt_t atk_mw579_conn_poll(void);                                                                                                     /* ATK-MW579连接状态机, 在主循环中调用 */
+uint8_t atk_mw579_send_at_cmd(char *cmd, char *ack, uint32_t timeout);                                                                              /* ATK-MW579发送AT指令 */
+uint8_t atk_mw579_enter_config_mode(void);                                                                                                          /* ATK-MW579进入配置模式 */
+uint8_t atk_mw579_at_test(void);                                                                                                                    /* ATK-MW579 AT指令测试 */
+uint8_t atk_mw579_set_name(char *name);                                                                                                             /* 设置ATK-MW579蓝牙名称 */
+uint8_t atk_mw579_set_hello(char *hello);                                                                                                           /* 设置ATK-MW579开机欢迎语 */
+uint8_t atk_mw579_set_tpl(atk_mw579_tpl_t tpl);                                                                                                     /* 设置ATK-MW579发射功率 */
+uint8_t atk_mw579_set_uart(atk_mw579_uart_baudrate_t baudrate, atk_mw579_uart_data_t data, atk_mw579_uart_pari_t pari, atk_mw579_uart_stop_t stop); /* 设置ATK-MW579串口参数 */
+uint8_t atk_mw579_set_adptim(uint16_t adptim);                                                                                                      /* 设置ATK-MW579广播速度 */
+uint8_t atk_mw579_set_linkpassen(atk_mw579_linkpassen_t linkpassen);                                                                                /* 设置ATK-MW579链路匹配 */
+uint8_t atk_mw579_set_leden(atk_mw579_leden_t leden);                                                                                               /* 设置ATK-MW579板载LED */
+uint8_t atk_mw579_set_slavesleepen(atk_mw579_slavesleepen_t slavesleepen);                                                                          /* 设置ATK-MW579从设备断连睡眠 */
+uint8_t atk_mw579_set_maxput(atk_mw579_maxput_t maxput);                                                                                            /* 设置ATK-MW579通信最大输出 */
+uint8_t atk_mw579_set_mode(atk_mw579_mode_t mode);                                                                                                  /* 设置ATK-MW579工作模式 */
+uint8_t atk_mw579_scan_slave(void);                                                                                                                 /* ATK-MW579扫描周围从设备 */
+uint8_t atk_mw579_conn_slave(uint8_t id);                                                                                                           /* ATK-MW579连接周围从设备 */
+uint8_t atk_mw579_enter_unvarnished(void);                                                                                                          /* ATK-MW579进入透传 */
+uint8_t atk_mw579_set_linkpass(char *pass);                                                                                                         /* 设置ATK-MW579链路匹配密码 */
+uint8_t atk_mw579_set_autosleepen(atk_mw579_autosleepen_t autosleepen, uint8_t autotim);                                                            /* 设置ATK-MW579自动睡眠 */
+uint8_t atk_mw579_set_autosleep(atk_mw579_autosleep_t autosleep);                                                                                   /* 设置ATK-MW579自动睡眠模式 */
+uint8_t atk_mw579_set_powersleepen(atk_mw579_powersleepen_t powersleepen);                                                                          /* 设置ATK-MW579上电睡眠 */
+uint8_t atk_mw579_set_ibeacon(char *uuid, uint16_t major, uint16_t minor, uint8_t rssi);                                                            /* 设置ATK-MW579 iBeacon */
+void atk_mw579_wakeup_by_pin(void);                                                                                                                 /* 通过WKUP引脚唤醒ATK-MW579 */
+void atk_mw579_wakeup_by_uart(void);                                                                                                                /* 通过UART唤醒ATK-MW579 */
+uint32_t atk_mw579_baudrate_value(atk_mw579_uart_baudrate_t baudrate);                                                                              /* 获取波特率枚举对应的数值 */
+atk_mw579_uart_baudrate_t atk_mw579_get_baudrate(void);                                                                                             /* 获取ATK-MW579当前的UART通讯波特率 */
+uint8_t atk_mw579_find_baudrate(void);                                                                                                              /* 扫描ATK-MW579当前的UART通讯波特率 */
+uint8_t atk_mw579_switch_baudrate(atk_mw579_uart_baudrate_t baudrate);                                                                              /* 切换ATK-MW579和UART的通讯波特率 */
+uint8_t atk_mw579_tune_baudrate(atk_mw579_uart_baudrate_t max);                                                                                     /* 协商ATK-MW579的最高稳定波特率 */
 
 #endif
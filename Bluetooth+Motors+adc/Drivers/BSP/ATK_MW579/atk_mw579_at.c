@@ -0,0 +1,212 @@
+/**
+ ****************************************************************************************************
+ * @file        atk_mw579_at.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       ATK-MW579异步AT指令脚本 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/ATK_MW579/atk_mw579_at.h"
+#include "./BSP/ATK_MW579/atk_mw579.h"
+#include <string.h>
+
+
+atk_mw579_at_t g_atk_mw579_at;
+
+static atk_mw579_at_cmd_t g_atk_mw579_at_script[ATK_MW579_AT_NUM];
+
+/**
+ * @brief       开始/结束录制
+ * @param       on: 1, 开始录制, 清空脚本; 0, 结束录制
+ * @retval      无
+ */
+void atk_mw579_at_record(uint8_t on)
+{
+    if (on)
+    {
+        g_atk_mw579_at.state = ATK_MW579_AT_IDLE;
+        g_atk_mw579_at.num = 0;
+    }
+
+    g_atk_mw579_at.recording = on;
+}
+
+/**
+ * @brief       录制一条指令, 由atk_mw579_send_at_cmd()在录制时调用
+ * @param       cmd    : 指令, 不含\r\n
+ * @param       ack    : 期望的应答, 必须是常量字符串; NULL表示不等待
+ * @param       timeout: 等待应答的超时时间, 单位: ms
+ * @retval      ATK_MW579_EOK  : 已录制
+ *              ATK_MW579_ERROR: 脚本已满或指令过长
+ */
+uint8_t atk_mw579_at_add(const char *cmd, const char *ack, uint32_t timeout)
+{
+    atk_mw579_at_cmd_t *entry;
+
+    if ((g_atk_mw579_at.num >= ATK_MW579_AT_NUM) || (strlen(cmd) >= ATK_MW579_AT_CMD_SIZE))
+    {
+        return ATK_MW579_ERROR;
+    }
+
+    entry = &g_atk_mw579_at_script[g_atk_mw579_at.num++];
+    strcpy(entry->cmd, cmd);
+    entry->ack = (timeout != 0) ? ack : NULL;
+    entry->timeout = (timeout > 0xFFFF) ? 0xFFFF : timeout;
+    entry->settle = 0;
+    return ATK_MW579_EOK;
+}
+
+/**
+ * @brief       设置上一条指令应答后的等待时间, 代替设置函数中的delay_ms()
+ * @param       ms: 等待时间, 单位: ms
+ * @retval      无
+ */
+void atk_mw579_at_settle(uint16_t ms)
+{
+    if (g_atk_mw579_at.num > 0)
+    {
+        g_atk_mw579_at_script[g_atk_mw579_at.num - 1].settle = ms;
+    }
+}
+
+/**
+ * @brief       脚本指纹, 所有指令的FNV-1a哈希
+ * @note        期望应答和超时不影响模块的配置结果, 不参与计算
+ * @param       无
+ * @retval      指纹, 不会为0(0留给"没有记录")
+ */
+uint32_t atk_mw579_at_hash(void)
+{
+    uint32_t hash = 2166136261u;
+    const char *p;
+    uint8_t i;
+
+    for (i = 0; i < g_atk_mw579_at.num; i++)
+    {
+        for (p = g_atk_mw579_at_script[i].cmd; *p != '\0'; p++)
+        {
+            hash = (hash ^ (uint8_t)*p) * 16777619u;
+        }
+
+        hash = (hash ^ '\n') * 16777619u;       /* 指令之间的分隔, "AB"+"C"与"A"+"BC"不同 */
+    }
+
+    return (hash != 0) ? hash : 1;
+}
+
+/**
+ * @brief       开始执行脚本, 模块需要已经处于配置模式
+ * @param       无
+ * @retval      无
+ */
+void atk_mw579_at_start(void)
+{
+    g_atk_mw579_at.recording = 0;
+    g_atk_mw579_at.index = 0;
+    g_atk_mw579_at.tries = 0;
+    g_atk_mw579_at.retries = 0;
+    g_atk_mw579_at.start = HAL_GetTick();
+    g_atk_mw579_at.state = (g_atk_mw579_at.num > 0) ? ATK_MW579_AT_SEND : ATK_MW579_AT_DONE;
+}
+
+/**
+ * @brief       推进脚本, 不阻塞
+ * @param       无
+ * @retval      1: 脚本执行中; 0: 没有脚本或已结束(结果见g_atk_mw579_at.state)
+ */
+uint8_t atk_mw579_at_poll(void)
+{
+    atk_mw579_at_cmd_t *entry = &g_atk_mw579_at_script[g_atk_mw579_at.index];
+    uint32_t now = HAL_GetTick();
+    uint8_t *frame;
+
+    switch (g_atk_mw579_at.state)
+    {
+        case ATK_MW579_AT_SEND:
+        {
+            atk_mw579_uart_rx_flush();
+            atk_mw579_uart_printf("%s\r\n", entry->cmd);
+            g_atk_mw579_at.tick = now;
+            g_atk_mw579_at.state = (entry->ack != NULL) ? ATK_MW579_AT_WAIT : ATK_MW579_AT_SETTLE;
+            break;
+        }
+        case ATK_MW579_AT_WAIT:
+        {
+            frame = atk_mw579_uart_rx_get_frame();
+            if (frame != NULL)
+            {
+                if (strstr((const char *)frame, entry->ack) != NULL)
+                {
+                    g_atk_mw579_at.tick = now;
+                    g_atk_mw579_at.state = ATK_MW579_AT_SETTLE;
+                }
+                atk_mw579_uart_rx_restart();
+            }
+            else if ((now - g_atk_mw579_at.tick) >= entry->timeout)
+            {
+                if (g_atk_mw579_at.tries >= ATK_MW579_AT_RETRY)
+                {
+                    g_atk_mw579_at.elapsed = now - g_atk_mw579_at.start;
+                    g_atk_mw579_at.state = ATK_MW579_AT_FAIL;
+                }
+                else
+                {
+                    g_atk_mw579_at.tries++;
+                    g_atk_mw579_at.retries++;
+                    g_atk_mw579_at.state = ATK_MW579_AT_SEND;
+                }
+            }
+            break;
+        }
+        case ATK_MW579_AT_SETTLE:
+        {
+            if ((now - g_atk_mw579_at.tick) >= entry->settle)
+            {
+                g_atk_mw579_at.index++;
+                g_atk_mw579_at.tries = 0;
+                if (g_atk_mw579_at.index >= g_atk_mw579_at.num)
+                {
+                    g_atk_mw579_at.elapsed = now - g_atk_mw579_at.start;
+                    g_atk_mw579_at.state = ATK_MW579_AT_DONE;
+                }
+                else
+                {
+                    g_atk_mw579_at.state = ATK_MW579_AT_SEND;
+                }
+            }
+            break;
+        }
+        default:
+        {
+            return 0;
+        }
+    }
+
+    return (g_atk_mw579_at.state == ATK_MW579_AT_DONE) || (g_atk_mw579_at.state == ATK_MW579_AT_FAIL) ? 0 : 1;
+}
+
+/**
+ * @brief       当前执行的指令, 失败时为失败的那条
+ * @param       无
+ * @retval      指令字符串, 没有脚本时为""
+ */
+const char *atk_mw579_at_current(void)
+{
+    if (g_atk_mw579_at.index >= g_atk_mw579_at.num)
+    {
+        return "";
+    }
+
+    return g_atk_mw579_at_script[g_atk_mw579_at.index].cmd;
+}
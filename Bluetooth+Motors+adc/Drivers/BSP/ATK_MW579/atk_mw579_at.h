@@ -0,0 +1,85 @@
+/**
+ ****************************************************************************************************
+ * @file        atk_mw579_at.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       ATK-MW579异步AT指令脚本 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 录制: atk_mw579_at_record(1)之后调用atk_mw579_set_xxx(), atk_mw579_send_at_cmd()不发送,
+ *       而是把指令、期望应答和超时加入脚本, 所以各设置函数的参数检查和格式化不需要重写一遍.
+ * 指纹: 脚本的所有指令做FNV-1a哈希, 与上次成功应用的指纹相同时说明模块已经是这个配置,
+ *       可以整个跳过.
+ * 执行: atk_mw579_at_start()之后在主循环中调用atk_mw579_at_poll(), 每次只检查一下状态就返回:
+ *       发送 -> 等待应答(收到就进入下一条, 不按1ms轮询) -> 超时重发, 重试ATK_MW579_AT_RETRY次后失败;
+ *       需要模块稳定时间的指令(如AT+MODE)在应答后等待, 也不阻塞.
+ * 执行期间模块的应答占用接收队列, 调用者不能同时处理蓝牙命令.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __ATK_MW579_AT_H
+#define __ATK_MW579_AT_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 配置 */
+
+#define ATK_MW579_AT_NUM            16          /* 脚本最多指令数 */
+#define ATK_MW579_AT_CMD_SIZE       48          /* 单条指令最大长度(含结束符) */
+#define ATK_MW579_AT_RETRY          3           /* 超时重发次数 */
+
+/* 脚本状态 */
+typedef enum
+{
+    ATK_MW579_AT_IDLE = 0x00,                   /* 没有脚本 */
+    ATK_MW579_AT_SEND,                          /* 发送当前指令 */
+    ATK_MW579_AT_WAIT,                          /* 等待应答 */
+    ATK_MW579_AT_SETTLE,                        /* 应答后等待模块稳定 */
+    ATK_MW579_AT_DONE,                          /* 全部完成 */
+    ATK_MW579_AT_FAIL,                          /* 某条指令重试后仍然失败 */
+} atk_mw579_at_state_t;
+
+typedef struct
+{
+    char cmd[ATK_MW579_AT_CMD_SIZE];            /* 指令, 不含\r\n */
+    const char *ack;                            /* 期望的应答, NULL表示不等待 */
+    uint16_t timeout;                           /* 等待应答的超时时间, 单位: ms */
+    uint16_t settle;                            /* 应答后的等待时间, 单位: ms */
+} atk_mw579_at_cmd_t;
+
+typedef struct
+{
+    atk_mw579_at_state_t state;
+    uint8_t recording;                          /* 1: atk_mw579_send_at_cmd()只录制不发送 */
+    uint8_t num;                                /* 脚本指令数 */
+    uint8_t index;                              /* 当前指令 */
+    uint8_t tries;                              /* 当前指令已重发次数 */
+    uint32_t tick;                              /* 当前状态的开始时刻 */
+    uint32_t start;                             /* 脚本开始时刻 */
+    uint32_t elapsed;                           /* 脚本用时, 单位: ms */
+    uint32_t retries;                           /* 累计重发次数 */
+} atk_mw579_at_t;
+
+extern atk_mw579_at_t g_atk_mw579_at;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void atk_mw579_at_record(uint8_t on);                                   /* 开始/结束录制, 开始时清空脚本 */
+uint8_t atk_mw579_at_add(const char *cmd, const char *ack, uint32_t timeout);  /* 录制一条指令 */
+void atk_mw579_at_settle(uint16_t ms);                                  /* 设置上一条指令应答后的等待时间 */
+uint32_t atk_mw579_at_hash(void);                                       /* 脚本指纹 */
+void atk_mw579_at_start(void);                                          /* 开始执行脚本 */
+uint8_t atk_mw579_at_poll(void);                                        /* 推进脚本, 在主循环中调用 */
+const char *atk_mw579_at_current(void);                                 /* 当前(或失败的)指令 */
+
+#endif
@@ -1,19 +1,19 @@
 /**
  ****************************************************************************************************
  * @file        atk_mw579_uart.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2022-06-21
- * @brief       ATK-MW579ģUARTӿ
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       ATK-MW579模块UART接口驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
  ****************************************************************************************************
  */
@@ -24,58 +24,274 @@
 #include <string.h>
 
 static UART_HandleTypeDef g_uart_handle;                    /* ATK-MW579 UART */
+static DMA_HandleTypeDef g_uart_rx_dma;                     /* ATK-MW579 UART接收DMA */
+static uint8_t g_uart_rx_dma_buf[ATK_MW579_UART_RX_DMA_SIZE];   /* 接收DMA循环缓冲 */
+static uint16_t g_uart_rx_dma_rd;                           /* 接收DMA循环缓冲中已处理到的位置 */
 static struct
 {
-    uint8_t buf[ATK_MW579_UART_RX_BUF_SIZE];                /* ֡ջ */
-    struct
+    uint8_t buf[ATK_MW579_UART_RX_FRAME_NUM][ATK_MW579_UART_RX_FRAME_SIZE]; /* 帧缓冲 */
+    uint16_t len[ATK_MW579_UART_RX_FRAME_NUM];              /* 帧长度 */
+    uint32_t tick[ATK_MW579_UART_RX_FRAME_NUM];             /* 帧到达时刻(总线空闲时), 单位: ms */
+    uint8_t trunc;                                          /* 正在接收的帧已超长 */
+    volatile uint8_t head;                                  /* 正在接收的帧, 由中断写入 */
+    volatile uint8_t tail;                                  /* 最早的未处理帧, 由主循环读取, head == tail表示队列空 */
+} g_uart_rx_frame = {0};                                    /* ATK-MW579 UART接收帧环形队列 */
+static atk_mw579_uart_rx_urgent_cb_t g_uart_rx_urgent_cb = NULL;    /* 紧急帧回调 */
+static DMA_HandleTypeDef g_uart_tx_dma;                     /* ATK-MW579 UART发送DMA */
+static struct
+{
+    uint8_t buf[ATK_MW579_UART_TX_BUF_NUM][ATK_MW579_UART_TX_BUF_SIZE];     /* 发送缓冲 */
+    uint16_t len[ATK_MW579_UART_TX_BUF_NUM];                /* 各缓冲的数据长度 */
+    volatile uint8_t head;                                  /* 下一个空闲缓冲, 由主循环写入 */
+    volatile uint8_t tail;                                  /* 正在发送的缓冲, 由DMA完成中断推进 */
+    volatile uint8_t busy;                                  /* DMA正在发送 */
+} g_uart_tx_queue = {0};                                    /* ATK-MW579 UART发送队列 */
+
+atk_mw579_uart_rx_sta_t g_atk_mw579_uart_rx_sta = {0};      /* 接收统计 */
+atk_mw579_uart_tx_sta_t g_atk_mw579_uart_tx_sta = {0};      /* 发送统计 */
+
+/**
+ * @brief       启动发送队列中最早的一条
+ * @note        在发送DMA中断关闭或DMA完成回调中调用
+ * @param       无
+ * @retval      无
+ */
+static void atk_mw579_uart_tx_kick(void)
+{
+    uint8_t tail = g_uart_tx_queue.tail;
+    
+    if (tail == g_uart_tx_queue.head)
     {
-        uint16_t len    : 15;                               /* ֡ճȣsta[14:0] */
-        uint16_t finsh  : 1;                                /* ֡ɱ־sta[15] */
-    } sta;                                                  /* ֡״̬Ϣ */
-} g_uart_rx_frame = {0};                                    /* ATK-MW579 UART֡Ϣṹ */
-static uint8_t g_uart_tx_buf[ATK_MW579_UART_TX_BUF_SIZE];   /* ATK-MW579 UARTͻ */
+        g_uart_tx_queue.busy = 0;
+        return;
+    }
+    
+    g_uart_tx_queue.busy = 1;
+    HAL_DMA_Start_IT(&g_uart_tx_dma, (uint32_t)g_uart_tx_queue.buf[tail], (uint32_t)&g_uart_handle.Instance->DR, g_uart_tx_queue.len[tail]);
+}
+
+/**
+ * @brief       发送DMA完成回调, 释放已发完的缓冲并接着发下一条
+ * @param       hdma: DMA句柄
+ * @retval      无
+ */
+static void atk_mw579_uart_tx_dma_cb(DMA_HandleTypeDef *hdma)
+{
+    g_uart_tx_queue.tail = (g_uart_tx_queue.tail + 1) % ATK_MW579_UART_TX_BUF_NUM;
+    g_atk_mw579_uart_tx_sta.sent++;
+    g_atk_mw579_uart_tx_sta.depth--;
+    atk_mw579_uart_tx_kick();
+}
+
+/**
+ * @brief       取一个空闲的发送缓冲
+ * @param       无
+ * @retval      NULL: 队列满, 本条丢弃
+ *              其他: 空闲缓冲, 写入数据后调用atk_mw579_uart_tx_commit()
+ */
+static uint8_t *atk_mw579_uart_tx_alloc(void)
+{
+    uint8_t head = g_uart_tx_queue.head;
+    
+    if (((head + 1) % ATK_MW579_UART_TX_BUF_NUM) == g_uart_tx_queue.tail)
+    {
+        g_atk_mw579_uart_tx_sta.drops++;
+        return NULL;
+    }
+    
+    return g_uart_tx_queue.buf[head];
+}
+
+/**
+ * @brief       把写好的缓冲加入发送队列, DMA空闲时立即开始发送
+ * @note        只关闭发送DMA中断, 不影响急停和步进电机中断
+ * @param       len: 数据长度
+ * @retval      无
+ */
+static void atk_mw579_uart_tx_commit(uint16_t len)
+{
+    if (len == 0)
+    {
+        return;
+    }
+    
+    HAL_NVIC_DisableIRQ(ATK_MW579_UART_TX_DMA_IRQn);
+    g_uart_tx_queue.len[g_uart_tx_queue.head] = len;
+    g_uart_tx_queue.head = (g_uart_tx_queue.head + 1) % ATK_MW579_UART_TX_BUF_NUM;
+    
+    g_atk_mw579_uart_tx_sta.bytes += len;
+    g_atk_mw579_uart_tx_sta.depth++;
+    if (g_atk_mw579_uart_tx_sta.depth > g_atk_mw579_uart_tx_sta.max_depth)
+    {
+        g_atk_mw579_uart_tx_sta.max_depth = g_atk_mw579_uart_tx_sta.depth;
+    }
+    
+    if (g_uart_tx_queue.busy == 0)
+    {
+        atk_mw579_uart_tx_kick();
+    }
+    HAL_NVIC_EnableIRQ(ATK_MW579_UART_TX_DMA_IRQn);
+}
 
 /**
  * @brief       ATK-MW579 UART printf
- * @param       fmt: ӡ
- * @retval      
+ * @note        直接格式化到发送队列的空闲缓冲中, 入队后立即返回;
+ *              队列满时丢弃, 超过ATK_MW579_UART_TX_BUF_SIZE - 1的部分截断
+ * @param       fmt: 待打印的数据
+ * @retval      无
  */
 void atk_mw579_uart_printf(char *fmt, ...)
 {
     va_list ap;
-    uint16_t len;
+    int len;
+    uint8_t *buf;
+    
+    buf = atk_mw579_uart_tx_alloc();
+    if (buf == NULL)
+    {
+        return;
+    }
     
     va_start(ap, fmt);
-    vsprintf((char *)g_uart_tx_buf, fmt, ap);
+    len = vsnprintf((char *)buf, ATK_MW579_UART_TX_BUF_SIZE, fmt, ap);
     va_end(ap);
     
-    len = strlen((const char *)g_uart_tx_buf);
-    HAL_UART_Transmit(&g_uart_handle, g_uart_tx_buf, len, HAL_MAX_DELAY);
+    if (len >= ATK_MW579_UART_TX_BUF_SIZE)
+    {
+        len = ATK_MW579_UART_TX_BUF_SIZE - 1;
+        g_atk_mw579_uart_tx_sta.truncs++;
+    }
+    
+    atk_mw579_uart_tx_commit((len > 0) ? len : 0);
+}
+
+/**
+ * @brief       ATK-MW579 UART发送一段数据
+ * @note        复制到发送队列后立即返回, 可以发送二进制数据
+ * @param       dat: 待发送的数据
+ * @param       len: 数据长度, 不超过ATK_MW579_UART_TX_BUF_SIZE
+ * @retval      0: 已入队
+ *              1: 队列满或长度错误, 已丢弃
+ */
+uint8_t atk_mw579_uart_send(const uint8_t *dat, uint16_t len)
+{
+    uint8_t *buf;
+    
+    if ((len == 0) || (len > ATK_MW579_UART_TX_BUF_SIZE))
+    {
+        return 1;
+    }
+    
+    buf = atk_mw579_uart_tx_alloc();
+    if (buf == NULL)
+    {
+        return 1;
+    }
+    
+    memcpy(buf, dat, len);
+    atk_mw579_uart_tx_commit(len);
+    
+    return 0;
+}
+
+/**
+ * @brief       等待发送队列清空
+ * @note        修改模块配置或进入低功耗前调用, 保证之前的数据已经交给UART
+ * @param       timeout: 等待超时时间, 单位: ms
+ * @retval      0: 已清空
+ *              1: 超时
+ */
+uint8_t atk_mw579_uart_tx_wait(uint32_t timeout)
+{
+    uint32_t tickstart = HAL_GetTick();
+    
+    while (g_uart_tx_queue.busy)
+    {
+        if ((HAL_GetTick() - tickstart) > timeout)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief       发送队列空闲缓冲数
+ * @note        发送方可以据此在队列满之前降低数据量, 而不是等到入队失败
+ * @param       无
+ * @retval      空闲缓冲数
+ */
+uint8_t atk_mw579_uart_tx_free(void)
+{
+    return (g_uart_tx_queue.tail + ATK_MW579_UART_TX_BUF_NUM - g_uart_tx_queue.head - 1) % ATK_MW579_UART_TX_BUF_NUM;
+}
+
+/**
+ * @brief       上次查询以来的发送链路利用率
+ * @note        按每字节10位计算入队字节占当前波特率容量的比例, 超过1000表示发送速度跟不上
+ * @param       无
+ * @retval      利用率, 千分比
+ */
+uint16_t atk_mw579_uart_tx_util(void)
+{
+    static uint32_t last_tick = 0;
+    static uint32_t last_bytes = 0;
+    uint32_t tick = HAL_GetTick();
+    uint32_t bytes = g_atk_mw579_uart_tx_sta.bytes;
+    uint64_t util;
+    
+    if (tick == last_tick)
+    {
+        return 0;
+    }
+    
+    util = (uint64_t)(bytes - last_bytes) * 10 * 1000 * 1000 / ((uint64_t)g_uart_handle.Init.BaudRate * (tick - last_tick));
+    last_tick = tick;
+    last_bytes = bytes;
+    
+    return (util > 0xFFFF) ? 0xFFFF : (uint16_t)util;
 }
 
 /**
- * @brief       ATK-MW579 UART¿ʼ
- * @param       
- * @retval      
+ * @brief       ATK-MW579 UART释放当前帧, 接收下一帧
+ * @note        处理完atk_mw579_uart_rx_get_frame()返回的帧后调用
+ * @param       无
+ * @retval      无
  */
 void atk_mw579_uart_rx_restart(void)
 {
-    g_uart_rx_frame.sta.len     = 0;
-    g_uart_rx_frame.sta.finsh   = 0;
+    if (g_uart_rx_frame.tail != g_uart_rx_frame.head)
+    {
+        g_uart_rx_frame.tail = (g_uart_rx_frame.tail + 1) % ATK_MW579_UART_RX_FRAME_NUM;
+    }
+}
+
+/**
+ * @brief       ATK-MW579 UART丢弃所有未处理的帧
+ * @note        发送AT指令前调用, 避免把之前的数据当成应答
+ * @param       无
+ * @retval      无
+ */
+void atk_mw579_uart_rx_flush(void)
+{
+    g_uart_rx_frame.tail = g_uart_rx_frame.head;
 }
 
 /**
- * @brief       ȡATK-MW579 UARTյһ֡
- * @param       
- * @retval      NULL: δյһ֡
- *              : յһ֡
+ * @brief       获取ATK-MW579 UART接收到的一帧数据
+ * @param       无
+ * @retval      NULL: 未接收到一帧数据
+ *              其他: 接收到的一帧数据, 以'\0'结尾
  */
 uint8_t *atk_mw579_uart_rx_get_frame(void)
 {
-    if (g_uart_rx_frame.sta.finsh == 1)
+    uint8_t tail = g_uart_rx_frame.tail;
+    
+    if (tail != g_uart_rx_frame.head)
     {
-        g_uart_rx_frame.buf[g_uart_rx_frame.sta.len] = '\0';
-        return g_uart_rx_frame.buf;
+        g_uart_rx_frame.buf[tail][g_uart_rx_frame.len[tail]] = '\0';
+        return g_uart_rx_frame.buf[tail];
     }
     else
     {
@@ -84,16 +300,18 @@ uint8_t *atk_mw579_uart_rx_get_frame(void)
 }
 
 /**
- * @brief       ȡATK-MW579 UARTյһ֡ݵĳ
- * @param       
- * @retval      0   : δյһ֡
- *              : յһ֡ݵĳ
+ * @brief       获取ATK-MW579 UART接收到的一帧数据的长度
+ * @param       无
+ * @retval      0   : 未接收到一帧数据
+ *              其他: 接收到的一帧数据的长度
  */
 uint16_t atk_mw579_uart_rx_get_frame_len(void)
 {
-    if (g_uart_rx_frame.sta.finsh == 1)
+    uint8_t tail = g_uart_rx_frame.tail;
+    
+    if (tail != g_uart_rx_frame.head)
     {
-        return g_uart_rx_frame.sta.len;
+        return g_uart_rx_frame.len[tail];
     }
     else
     {
@@ -102,65 +320,249 @@ uint16_t atk_mw579_uart_rx_get_frame_len(void)
 }
 
 /**
- * @brief       ATK-MW579 UARTʼ
- * @param       baudrate: UARTͨѶ
- * @retval      
+ * @brief       获取ATK-MW579 UART接收到的一帧数据的到达时刻
+ * @note        用于统计命令在队列中的等待时间
+ * @param       无
+ * @retval      帧结束(总线空闲)时的HAL_GetTick()值, 没有帧时返回0
  */
-void atk_mw579_uart_init(uint32_t baudrate)
+uint32_t atk_mw579_uart_rx_get_frame_tick(void)
 {
-    g_uart_handle.Instance          = ATK_MW579_UART_INTERFACE;     /* ATK-MW579 UART */
-    g_uart_handle.Init.BaudRate     = baudrate;                     /*  */
-    g_uart_handle.Init.WordLength   = UART_WORDLENGTH_8B;           /* λ */
-    g_uart_handle.Init.StopBits     = UART_STOPBITS_1;              /* ֹͣλ */
-    g_uart_handle.Init.Parity       = UART_PARITY_NONE;             /* Уλ */
-    g_uart_handle.Init.Mode         = UART_MODE_TX_RX;              /* շģʽ */
-    g_uart_handle.Init.HwFlowCtl    = UART_HWCONTROL_NONE;          /* Ӳ */
-    g_uart_handle.Init.OverSampling = UART_OVERSAMPLING_16;         /*  */
-    HAL_UART_Init(&g_uart_handle);                                  /* ʹATK-MW579 UART
-                                                                     * HAL_UART_Init()úHAL_UART_MspInit()
-                                                                     * úļusart.c
-                                                                     */
+    uint8_t tail = g_uart_rx_frame.tail;
+    
+    if (tail != g_uart_rx_frame.head)
+    {
+        return g_uart_rx_frame.tick[tail];
+    }
+    else
+    {
+        return 0;
+    }
 }
 
 /**
- * @brief       ATK-MW579 UARTжϻص
- * @param       
- * @retval      
+ * @brief       获取ATK-MW579 UART队列中未处理的帧数
+ * @param       无
+ * @retval      未处理的帧数(含当前帧)
  */
-void ATK_MW579_UART_IRQHandler(void)
+uint8_t atk_mw579_uart_rx_get_frame_num(void)
 {
-    uint8_t tmp;
+    return (g_uart_rx_frame.head + ATK_MW579_UART_RX_FRAME_NUM - g_uart_rx_frame.tail) % ATK_MW579_UART_RX_FRAME_NUM;
+}
+
+/**
+ * @brief       设置紧急帧回调
+ * @note        急停、停止等命令不能因为主循环忙或队列满而延迟/丢失, 由回调在接收中断中直接处理
+ * @param       cb: 紧急帧回调, NULL表示所有帧都进入队列
+ * @retval      无
+ */
+void atk_mw579_uart_rx_set_urgent(atk_mw579_uart_rx_urgent_cb_t cb)
+{
+    g_uart_rx_urgent_cb = cb;
+}
+
+/**
+ * @brief       把接收DMA循环缓冲中的新数据搬到正在接收的帧
+ * @note        在DMA半满/全满中断和UART总线空闲中断中调用, 三者优先级相同, 不会互相打断.
+ *              总线空闲时结束当前帧并发布到队列, 队列满时丢弃该帧
+ * @param       idle: 1, 总线空闲, 结束当前帧; 0, 只搬运数据
+ * @retval      无
+ */
+static void atk_mw579_uart_rx_drain(uint8_t idle)
+{
+    uint16_t wr;
+    uint8_t head = g_uart_rx_frame.head;
+    uint8_t next;
+    uint16_t len = g_uart_rx_frame.len[head];
     
-    if (__HAL_UART_GET_FLAG(&g_uart_handle, UART_FLAG_ORE) != RESET)        /* UARTչشж */
+    wr = ATK_MW579_UART_RX_DMA_SIZE - __HAL_DMA_GET_COUNTER(&g_uart_rx_dma);    /* DMA写入位置 */
+    if (wr >= ATK_MW579_UART_RX_DMA_SIZE)
     {
-        __HAL_UART_CLEAR_OREFLAG(&g_uart_handle);                           /* չشжϱ־ */
-        (void)g_uart_handle.Instance->SR;                                   /* ȶSRĴٶDRĴ */
-        (void)g_uart_handle.Instance->DR;
+        wr = 0;
     }
     
-    if (__HAL_UART_GET_FLAG(&g_uart_handle, UART_FLAG_RXNE) != RESET)       /* UARTж */
+    while (g_uart_rx_dma_rd != wr)
     {
-        HAL_UART_Receive(&g_uart_handle, &tmp, 1, HAL_MAX_DELAY);           /* UART */
-        
-        if (g_uart_rx_frame.sta.len < (ATK_MW579_UART_RX_BUF_SIZE - 1))     /* жUARTջǷ
-                                                                             * һλ'\0'
-                                                                             */
+        if (len < (ATK_MW579_UART_RX_FRAME_SIZE - 1))                       /* 留出一位给结束符'\0' */
         {
-            g_uart_rx_frame.buf[g_uart_rx_frame.sta.len] = tmp;             /* յд뻺 */
-            g_uart_rx_frame.sta.len++;                                      /* ½յݳ */
+            g_uart_rx_frame.buf[head][len++] = g_uart_rx_dma_buf[g_uart_rx_dma_rd];
         }
-        else                                                                /* UARTջ */
+        else
         {
-            g_uart_rx_frame.sta.len = 0;                                    /* ֮ǰյ */
-            g_uart_rx_frame.buf[g_uart_rx_frame.sta.len] = tmp;             /* յд뻺 */
-            g_uart_rx_frame.sta.len++;                                      /* ½յݳ */
+            g_uart_rx_frame.trunc = 1;                                      /* 超长, 丢弃多出的数据 */
         }
+        g_uart_rx_dma_rd = (g_uart_rx_dma_rd + 1) % ATK_MW579_UART_RX_DMA_SIZE;
+    }
+    g_uart_rx_frame.len[head] = len;
+    
+    if ((idle == 0) || (len == 0))
+    {
+        return;
+    }
+    
+    g_atk_mw579_uart_rx_sta.frames++;
+    if (g_uart_rx_frame.trunc)
+    {
+        g_atk_mw579_uart_rx_sta.truncs++;
+        g_uart_rx_frame.trunc = 0;
     }
     
-    if (__HAL_UART_GET_FLAG(&g_uart_handle, UART_FLAG_IDLE) != RESET)       /* UART߿ж */
+    g_uart_rx_frame.buf[head][len] = '\0';
+    if ((g_uart_rx_urgent_cb != NULL) && g_uart_rx_urgent_cb(g_uart_rx_frame.buf[head], len))
     {
-        g_uart_rx_frame.sta.finsh = 1;                                      /* ֡ */
-        
-        __HAL_UART_CLEAR_IDLEFLAG(&g_uart_handle);                          /* UART߿ж */
+        g_atk_mw579_uart_rx_sta.urgents++;                                  /* 已处理, 复用该帧缓冲 */
+        g_uart_rx_frame.len[head] = 0;
+        return;
     }
+    g_uart_rx_frame.tick[head] = HAL_GetTick();
+    
+    next = (head + 1) % ATK_MW579_UART_RX_FRAME_NUM;
+    if (next == g_uart_rx_frame.tail)                                       /* 队列满, 丢弃该帧 */
+    {
+        g_atk_mw579_uart_rx_sta.drops++;
+    }
+    else
+    {
+        g_uart_rx_frame.head = next;
+    }
+    g_uart_rx_frame.len[g_uart_rx_frame.head] = 0;
+}
+
+/**
+ * @brief       接收DMA半满/全满回调
+ * @param       hdma: DMA句柄
+ * @retval      无
+ */
+static void atk_mw579_uart_rx_dma_cb(DMA_HandleTypeDef *hdma)
+{
+    atk_mw579_uart_rx_drain(0);
+}
+
+/**
+ * @brief       修改ATK-MW579 UART波特率
+ * @note        等待发送队列和移位寄存器清空后只改BRR, 收发DMA不需要重新初始化;
+ *              切换过程中收到的数据没有意义, 全部丢弃
+ * @param       baudrate: 新波特率
+ * @retval      无
+ */
+void atk_mw579_uart_set_baudrate(uint32_t baudrate)
+{
+    uint32_t tickstart;
+    
+    atk_mw579_uart_tx_wait(100);
+    tickstart = HAL_GetTick();
+    while ((__HAL_UART_GET_FLAG(&g_uart_handle, UART_FLAG_TC) == RESET) && ((HAL_GetTick() - tickstart) < 10));
+    
+    __HAL_UART_DISABLE(&g_uart_handle);
+    g_uart_handle.Init.BaudRate = baudrate;
+    g_uart_handle.Instance->BRR = UART_BRR_SAMPLING16(HAL_RCC_GetPCLK1Freq(), baudrate);    /* UART4在APB1上 */
+    __HAL_UART_ENABLE(&g_uart_handle);
+    
+    atk_mw579_uart_rx_flush();
+}
+
+/**
+ * @brief       ATK-MW579 UART初始化
+ * @param       baudrate: UART通讯波特率
+ * @retval      无
+ */
+void atk_mw579_uart_init(uint32_t baudrate)
+{
+    g_uart_handle.Instance          = ATK_MW579_UART_INTERFACE;     /* ATK-MW579 UART */
+    g_uart_handle.Init.BaudRate     = baudrate;                     /* 波特率 */
+    g_uart_handle.Init.WordLength   = UART_WORDLENGTH_8B;           /* 数据位 */
+    g_uart_handle.Init.StopBits     = UART_STOPBITS_1;              /* 停止位 */
+    g_uart_handle.Init.Parity       = UART_PARITY_NONE;             /* 校验位 */
+    g_uart_handle.Init.Mode         = UART_MODE_TX_RX;              /* 收发模式 */
+    g_uart_handle.Init.HwFlowCtl    = UART_HWCONTROL_NONE;          /* 无硬件流控 */
+    g_uart_handle.Init.OverSampling = UART_OVERSAMPLING_16;         /* 过采样 */
+    HAL_UART_Init(&g_uart_handle);                                  /* 使能ATK-MW579 UART
+                                                                     * HAL_UART_Init()会调用函数HAL_UART_MspInit()
+                                                                     * 该函数定义在文件usart.c中
+                                                                     */
+    
+    /* 接收DMA: 循环模式, 不需要重新启动 */
+    ATK_MW579_UART_RX_DMA_CLK_ENABLE();
+    g_uart_rx_dma.Instance                  = ATK_MW579_UART_RX_DMA_STREAM;
+    g_uart_rx_dma.Init.Channel              = ATK_MW579_UART_RX_DMA_CHANNEL;
+    g_uart_rx_dma.Init.Direction            = DMA_PERIPH_TO_MEMORY;
+    g_uart_rx_dma.Init.PeriphInc            = DMA_PINC_DISABLE;
+    g_uart_rx_dma.Init.MemInc               = DMA_MINC_ENABLE;
+    g_uart_rx_dma.Init.PeriphDataAlignment  = DMA_PDATAALIGN_BYTE;
+    g_uart_rx_dma.Init.MemDataAlignment     = DMA_MDATAALIGN_BYTE;
+    g_uart_rx_dma.Init.Mode                 = DMA_CIRCULAR;
+    g_uart_rx_dma.Init.Priority             = DMA_PRIORITY_HIGH;
+    g_uart_rx_dma.Init.FIFOMode             = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&g_uart_rx_dma);
+    g_uart_rx_dma.XferHalfCpltCallback      = atk_mw579_uart_rx_dma_cb;     /* 设置回调后HAL_DMA_Start_IT()才会开启半满中断 */
+    g_uart_rx_dma.XferCpltCallback          = atk_mw579_uart_rx_dma_cb;
+    
+    HAL_NVIC_SetPriority(ATK_MW579_UART_RX_DMA_IRQn, 1, 1);         /* 与UART中断相同, 互不打断 */
+    HAL_NVIC_EnableIRQ(ATK_MW579_UART_RX_DMA_IRQn);
+    
+    g_uart_rx_dma_rd = 0;
+    HAL_DMA_Start_IT(&g_uart_rx_dma, (uint32_t)&g_uart_handle.Instance->DR, (uint32_t)g_uart_rx_dma_buf, ATK_MW579_UART_RX_DMA_SIZE);
+    SET_BIT(g_uart_handle.Instance->CR3, USART_CR3_DMAR);           /* 由DMA接收数据 */
+    
+    /* 发送DMA: 普通模式, 每条发完后在完成回调中启动下一条 */
+    ATK_MW579_UART_TX_DMA_CLK_ENABLE();
+    g_uart_tx_dma.Instance                  = ATK_MW579_UART_TX_DMA_STREAM;
+    g_uart_tx_dma.Init.Channel              = ATK_MW579_UART_TX_DMA_CHANNEL;
+    g_uart_tx_dma.Init.Direction            = DMA_MEMORY_TO_PERIPH;
+    g_uart_tx_dma.Init.PeriphInc            = DMA_PINC_DISABLE;
+    g_uart_tx_dma.Init.MemInc               = DMA_MINC_ENABLE;
+    g_uart_tx_dma.Init.PeriphDataAlignment  = DMA_PDATAALIGN_BYTE;
+    g_uart_tx_dma.Init.MemDataAlignment     = DMA_MDATAALIGN_BYTE;
+    g_uart_tx_dma.Init.Mode                 = DMA_NORMAL;
+    g_uart_tx_dma.Init.Priority             = DMA_PRIORITY_MEDIUM;
+    g_uart_tx_dma.Init.FIFOMode             = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&g_uart_tx_dma);
+    g_uart_tx_dma.XferCpltCallback          = atk_mw579_uart_tx_dma_cb;
+    
+    HAL_NVIC_SetPriority(ATK_MW579_UART_TX_DMA_IRQn, 3, 1);         /* 发送不着急, 低于步进电机和接收 */
+    HAL_NVIC_EnableIRQ(ATK_MW579_UART_TX_DMA_IRQn);
+    
+    SET_BIT(g_uart_handle.Instance->CR3, USART_CR3_DMAT);           /* 由DMA发送数据 */
+}
+
+/**
+ * @brief       ATK-MW579 UART中断回调函数
+ * @note        数据由DMA接收, 这里只处理总线空闲(一帧结束)和接收错误
+ * @param       无
+ * @retval      无
+ */
+void ATK_MW579_UART_IRQHandler(void)
+{
+    if ((g_uart_handle.Instance->SR & (USART_SR_ORE | USART_SR_NE | USART_SR_FE)) != 0)    /* UART接收过载/噪声/帧错误中断 */
+    {
+        g_atk_mw579_uart_rx_sta.errors++;
+        __HAL_UART_CLEAR_OREFLAG(&g_uart_handle);                           /* 清除错误中断标志 */
+        (void)g_uart_handle.Instance->SR;                                   /* 先读SR寄存器，再读DR寄存器 */
+        (void)g_uart_handle.Instance->DR;
+    }
+    
+    if (__HAL_UART_GET_FLAG(&g_uart_handle, UART_FLAG_IDLE) != RESET)       /* UART总线空闲中断 */
+    {
+        __HAL_UART_CLEAR_IDLEFLAG(&g_uart_handle);                          /* 清除UART总线空闲中断 */
+        atk_mw579_uart_rx_drain(1);                                         /* 搬运剩余数据, 结束当前帧 */
+    }
+}
+
+/**
+ * @brief       ATK-MW579 UART接收DMA中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void ATK_MW579_UART_RX_DMA_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&g_uart_rx_dma);
+}
+
+/**
+ * @brief       ATK-MW579 UART发送DMA中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void ATK_MW579_UART_TX_DMA_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&g_uart_tx_dma);
 }
@@ -1,19 +1,19 @@
 /**
  ****************************************************************************************************
  * @file        atk_mw579_uart.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2022-06-21
- * @brief       ATK-MW579ģUARTӿ
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       ATK-MW579模块UART接口驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
  ****************************************************************************************************
  */
@@ -23,7 +23,7 @@
 
 #include "./SYSTEM/sys/sys.h"
 
-/* Ŷ */
+/* 引脚定义 */
 #define ATK_MW579_UART_TX_GPIO_PORT         GPIOC
 #define ATK_MW579_UART_TX_GPIO_PIN          GPIO_PIN_10
 #define ATK_MW579_UART_TX_GPIO_AF           GPIO_AF8_UART4
@@ -39,15 +39,74 @@
 #define ATK_MW579_UART_IRQHandler           UART4_IRQHandler
 #define ATK_MW579_UART_CLK_ENABLE()         do{ __HAL_RCC_UART4_CLK_ENABLE(); }while(0)
 
-/* UARTշС */
-#define ATK_MW579_UART_RX_BUF_SIZE          2048
-#define ATK_MW579_UART_TX_BUF_SIZE          64
+/* 接收DMA定义, UART4_RX: DMA1数据流2通道4 */
+#define ATK_MW579_UART_RX_DMA_STREAM        DMA1_Stream2
+#define ATK_MW579_UART_RX_DMA_CHANNEL       DMA_CHANNEL_4
+#define ATK_MW579_UART_RX_DMA_IRQn          DMA1_Stream2_IRQn
+#define ATK_MW579_UART_RX_DMA_IRQHandler    DMA1_Stream2_IRQHandler
+#define ATK_MW579_UART_RX_DMA_CLK_ENABLE()  do{ __HAL_RCC_DMA1_CLK_ENABLE(); }while(0)
 
-/*  */
-void atk_mw579_uart_printf(char *fmt, ...);     /* ATK-MW579 UART printf */
-void atk_mw579_uart_rx_restart(void);           /* ATK-MW579 UART¿ʼ */
-uint8_t *atk_mw579_uart_rx_get_frame(void);     /* ȡATK-MW579 UARTյһ֡ */
-uint16_t atk_mw579_uart_rx_get_frame_len(void); /* ȡATK-MW579 UARTյһ֡ݵĳ */
-void atk_mw579_uart_init(uint32_t baudrate);    /* ATK-MW579 UARTʼ */
+/* 发送DMA定义, UART4_TX: DMA1数据流4通道4 */
+#define ATK_MW579_UART_TX_DMA_STREAM        DMA1_Stream4
+#define ATK_MW579_UART_TX_DMA_CHANNEL       DMA_CHANNEL_4
+#define ATK_MW579_UART_TX_DMA_IRQn          DMA1_Stream4_IRQn
+#define ATK_MW579_UART_TX_DMA_IRQHandler    DMA1_Stream4_IRQHandler
+#define ATK_MW579_UART_TX_DMA_CLK_ENABLE()  do{ __HAL_RCC_DMA1_CLK_ENABLE(); }while(0)
+
+/* UART收发缓冲大小
+ * 接收: DMA循环缓冲, 半满/全满/总线空闲时把新数据搬到帧环形队列, 总线空闲时结束一帧;
+ *       115200波特率下半个DMA缓冲约11ms(230400下约5.5ms), 期间主循环不需要参与
+ * 发送: 每次printf/send格式化或复制到一个空闲缓冲后入队立即返回, DMA发完一个缓冲后
+ *       在完成中断中接着发下一个; 队列满时丢弃该条并计数, 发送方永远不会等待
+ */
+#define ATK_MW579_UART_RX_DMA_SIZE          256                 /* 接收DMA循环缓冲大小 */
+#define ATK_MW579_UART_RX_FRAME_SIZE        256                 /* 单帧最大长度(含结束符), 超出部分丢弃 */
+#define ATK_MW579_UART_RX_FRAME_NUM         8                   /* 帧环形队列深度 */
+#define ATK_MW579_UART_TX_BUF_SIZE          128                 /* 单条发送的最大长度, 超出部分截断 */
+#define ATK_MW579_UART_TX_BUF_NUM           16                  /* 发送队列深度 */
+
+/* 接收统计 */
+typedef struct
+{
+    uint32_t frames;                                            /* 收到的帧数 */
+    uint32_t drops;                                             /* 队列满丢弃的帧数 */
+    uint32_t truncs;                                            /* 超长被截断的帧数 */
+    uint32_t urgents;                                           /* 在中断中直接处理的紧急帧数 */
+    uint32_t errors;                                            /* 帧错误/噪声/过载次数, 用来判断波特率是否稳定 */
+} atk_mw579_uart_rx_sta_t;
+
+/* 紧急帧回调, 在接收中断中对每个完整帧调用, 帧已以'\0'结尾, 不可修改;
+ * 返回1表示已处理, 该帧不进入队列(队列满时也不会丢失) */
+typedef uint8_t (*atk_mw579_uart_rx_urgent_cb_t)(const uint8_t *frame, uint16_t len);
+
+/* 发送统计 */
+typedef struct
+{
+    uint32_t sent;                                              /* 已发完的条数 */
+    uint32_t drops;                                             /* 队列满丢弃的条数 */
+    uint32_t truncs;                                            /* 超长被截断的条数 */
+    uint32_t bytes;                                             /* 已入队的字节数 */
+    uint8_t depth;                                              /* 当前队列深度(含正在发送的一条) */
+    uint8_t max_depth;                                          /* 队列深度最大值 */
+} atk_mw579_uart_tx_sta_t;
+
+extern atk_mw579_uart_rx_sta_t g_atk_mw579_uart_rx_sta;
+extern atk_mw579_uart_tx_sta_t g_atk_mw579_uart_tx_sta;
+
+/* 操作函数 */
+void atk_mw579_uart_printf(char *fmt, ...);     /* ATK-MW579 UART printf, 不阻塞 */
+uint8_t atk_mw579_uart_send(const uint8_t *dat, uint16_t len);  /* ATK-MW579 UART发送一段数据, 不阻塞 */
+uint8_t atk_mw579_uart_tx_wait(uint32_t timeout);   /* 等待发送队列清空 */
+uint8_t atk_mw579_uart_tx_free(void);           /* 发送队列空闲缓冲数 */
+uint16_t atk_mw579_uart_tx_util(void);          /* 上次查询以来的发送链路利用率, 千分比 */
+void atk_mw579_uart_rx_restart(void);           /* ATK-MW579 UART释放当前帧, 接收下一帧 */
+void atk_mw579_uart_rx_flush(void);             /* ATK-MW579 UART丢弃所有未处理的帧 */
+uint8_t *atk_mw579_uart_rx_get_frame(void);     /* 获取ATK-MW579 UART接收到的一帧数据 */
+uint16_t atk_mw579_uart_rx_get_frame_len(void); /* 获取ATK-MW579 UART接收到的一帧数据的长度 */
+uint32_t atk_mw579_uart_rx_get_frame_tick(void);    /* 获取ATK-MW579 UART接收到的一帧数据的到达时刻 */
+uint8_t atk_mw579_uart_rx_get_frame_num(void);  /* 获取ATK-MW579 UART队列中未处理的帧数 */
+void atk_mw579_uart_rx_set_urgent(atk_mw579_uart_rx_urgent_cb_t cb);  /* 设置紧急帧回调 */
+void atk_mw579_uart_set_baudrate(uint32_t baudrate);    /* 修改ATK-MW579 UART波特率 */
+void atk_mw579_uart_init(uint32_t baudrate);    /* ATK-MW579 UART初始化 */
 
 #endif
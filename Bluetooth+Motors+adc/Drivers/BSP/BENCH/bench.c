@@ -0,0 +1,152 @@
+/**
+ ****************************************************************************************************
+ * @file        bench.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       蓝牙链路吞吐量/延时基准测试 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/BENCH/bench.h"
+#include "./BSP/ATK_MW579/atk_mw579_uart.h"
+
+
+bench_t g_bench;
+
+static uint8_t g_bench_raw[TELEMETRY_RAW_SIZE];
+static uint8_t g_bench_wire[TELEMETRY_WIRE_SIZE];
+
+/**
+ * @brief       组装并发送一帧测试帧
+ * @param       无
+ * @retval      无
+ */
+static void bench_send(void)
+{
+    uint32_t tick = HAL_GetTick();
+    uint16_t len = 0;
+    uint16_t crc;
+    uint16_t wire_len;
+    uint8_t i;
+
+    g_bench_raw[len++] = TELEMETRY_VERSION;
+    g_bench_raw[len++] = TELEMETRY_TYPE_BENCH;
+    g_bench_raw[len++] = g_bench.seq & 0xFF;
+    g_bench_raw[len++] = g_bench.seq >> 8;
+    g_bench_raw[len++] = tick & 0xFF;
+    g_bench_raw[len++] = (tick >> 8) & 0xFF;
+    g_bench_raw[len++] = (tick >> 16) & 0xFF;
+    g_bench_raw[len++] = tick >> 24;
+
+    for (i = 0; i < g_bench.size - BENCH_SIZE_MIN; i++)
+    {
+        g_bench_raw[len++] = (g_bench.seq + i) & 0xFF;
+    }
+
+    crc = telemetry_crc16(g_bench_raw, len);
+    g_bench_raw[len++] = crc & 0xFF;
+    g_bench_raw[len++] = crc >> 8;
+
+    g_bench_wire[0] = 0x00;
+    wire_len = telemetry_cobs_encode(g_bench_raw, len, &g_bench_wire[1]) + 1;
+    g_bench_wire[wire_len++] = 0x00;
+
+    if (atk_mw579_uart_send(g_bench_wire, wire_len) != 0)
+    {
+        g_bench.drops++;
+    }
+    else
+    {
+        g_bench.frames++;
+        g_bench.bytes += wire_len;
+    }
+
+    g_bench.seq++;
+}
+
+/**
+ * @brief       开始测试
+ * @param       size    : payload大小, BENCH_SIZE_MIN ~ BENCH_SIZE_MAX
+ * @param       rate    : 发送速率, 帧/秒, 0为发送队列有空就发
+ * @param       duration: 测试时长, 单位: ms, 0为停止正在进行的测试
+ * @retval      BENCH_EOK   : 已开始(或已停止)
+ *              BENCH_EINVAL: 参数错误
+ */
+uint8_t bench_start(uint16_t size, uint16_t rate, uint32_t duration)
+{
+    if (duration == 0)
+    {
+        g_bench.duration = 0;                   /* 下一次bench_poll()结束测试并上报 */
+        return BENCH_EOK;
+    }
+
+    if ((size < BENCH_SIZE_MIN) || (size > BENCH_SIZE_MAX) || (rate > BENCH_RATE_MAX) || (duration > BENCH_TIME_MAX))
+    {
+        return BENCH_EINVAL;
+    }
+
+    g_bench.size = size;
+    g_bench.rate = rate;
+    g_bench.duration = duration;
+    g_bench.seq = 0;
+    g_bench.frames = 0;
+    g_bench.drops = 0;
+    g_bench.bytes = 0;
+    g_bench.start = HAL_GetTick();
+    g_bench.running = 1;
+    return BENCH_EOK;
+}
+
+/**
+ * @brief       按速率发送测试帧, 时间到时上报结果
+ * @note        按开始以来应发的帧数补发, 主循环偶尔被耽误也不会降低平均速率
+ * @param       无
+ * @retval      1: 测试进行中; 0: 没有测试
+ */
+uint8_t bench_poll(void)
+{
+    uint32_t elapsed;
+    uint32_t due;
+
+    if (g_bench.running == 0)
+    {
+        return 0;
+    }
+
+    elapsed = HAL_GetTick() - g_bench.start;
+    if (elapsed >= g_bench.duration)
+    {
+        g_bench.running = 0;
+        atk_mw579_uart_tx_wait(100);            /* 结果不能因为队列满被丢弃 */
+        atk_mw579_uart_printf("benchend:%lu,%lu,%lu,%lu\r\n", g_bench.frames, g_bench.drops, g_bench.bytes, elapsed);
+        return 0;
+    }
+
+    if (g_bench.rate == 0)
+    {
+        while (atk_mw579_uart_tx_free() > TELEMETRY_TX_RESERVE)
+        {
+            bench_send();
+        }
+    }
+    else
+    {
+        due = (uint64_t)elapsed * g_bench.rate / 1000 + 1;
+        while ((g_bench.frames + g_bench.drops) < due)
+        {
+            bench_send();
+        }
+    }
+
+    return 1;
+}
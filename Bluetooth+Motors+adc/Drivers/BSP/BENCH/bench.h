@@ -0,0 +1,66 @@
+/**
+ ****************************************************************************************************
+ * @file        bench.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       蓝牙链路吞吐量/延时基准测试 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * "bench <大小> <速率> <时长ms>"开始测试: 按给定速率(帧/秒, 0为发送队列有空就发)发送
+ * TELEMETRY_TYPE_BENCH帧, 帧格式与遥测帧相同(COBS + CRC16), seq为帧序号, 每帧加1, payload:
+ *   time_ms(4) | 测试序列(大小 - 4字节, 第i字节为(seq + i) & 0xFF)
+ * 发送队列满时该帧计为设备端丢弃, 序号照样加1, 上位机由序号跳变减去设备端丢弃得到链路丢失.
+ * 结束时发送"benchend:<已发帧数>,<设备端丢弃帧数>,<已发字节数>,<时长ms>".
+ * 测试期间主循环不采样, 只发送测试帧和执行命令, 上位机穿插"ping <n>"测量往返延时.
+ * 与波特率(baud命令)、通信最大输出(maxput命令)组合, 得到不同设置下链路的实际能力.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include "./SYSTEM/sys/sys.h"
+#include "./BSP/TELEMETRY/telemetry.h"
+
+/******************************************************************************************/
+/* 参数定义 */
+
+#define BENCH_SIZE_MIN          4               /* 最小payload: time_ms */
+#define BENCH_SIZE_MAX          (TELEMETRY_RAW_SIZE - TELEMETRY_HEAD_SIZE - TELEMETRY_CRC_SIZE)
+#define BENCH_RATE_MAX          2000            /* 最高发送速率, 帧/秒 */
+#define BENCH_TIME_MAX          60000           /* 最长测试时间, 单位: ms */
+
+/* 错误代码 */
+#define BENCH_EOK               0               /* 没有错误 */
+#define BENCH_EINVAL            1               /* 参数错误 */
+
+typedef struct
+{
+    uint8_t running;                            /* 1: 测试进行中 */
+    uint8_t size;                               /* payload大小 */
+    uint16_t rate;                              /* 发送速率, 帧/秒, 0为尽快发送 */
+    uint32_t duration;                          /* 测试时长, 单位: ms */
+    uint32_t start;                             /* 开始时刻, 单位: ms */
+    uint16_t seq;                               /* 下一帧的序号 */
+    uint32_t frames;                            /* 已发送的帧数 */
+    uint32_t drops;                             /* 发送队列满丢弃的帧数 */
+    uint32_t bytes;                             /* 已发送的线路字节数(COBS编码后, 含分隔符) */
+} bench_t;
+
+extern bench_t g_bench;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+uint8_t bench_start(uint16_t size, uint16_t rate, uint32_t duration);  /* 开始测试, duration为0时停止 */
+uint8_t bench_poll(void);                                               /* 按速率发送测试帧, 在主循环中调用 */
+
+#endif
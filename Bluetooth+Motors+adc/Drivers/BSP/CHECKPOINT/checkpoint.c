@@ -0,0 +1,207 @@
+/**
+ ****************************************************************************************************
+ * @file        checkpoint.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       后备SRAM断电续测记录 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/CHECKPOINT/checkpoint.h"
+#include <string.h>
+
+
+#define CHECKPOINT_WORDS        ((sizeof(checkpoint_t) - 4) / 4)                /* 参与CRC的字数 */
+
+checkpoint_t g_checkpoint;
+
+static checkpoint_t *const g_checkpoint_slot[2] =                               /* 后备SRAM中的A/B两份记录 */
+{
+    (checkpoint_t *)BKPSRAM_BASE,
+    (checkpoint_t *)(BKPSRAM_BASE + sizeof(checkpoint_t)),
+};
+
+/**
+ * @brief       计算记录的CRC32
+ * @note        使用片上CRC单元(多项式0x04C11DB7), 按字计算, 不包含crc字段本身
+ * @param       cp: 记录
+ * @retval      CRC32
+ */
+static uint32_t checkpoint_crc(const checkpoint_t *cp)
+{
+    const uint32_t *p = (const uint32_t *)cp;
+    uint32_t i;
+
+    CRC->CR = CRC_CR_RESET;
+    for (i = 0; i < CHECKPOINT_WORDS; i++)
+    {
+        CRC->DR = p[i];
+    }
+
+    return CRC->DR;
+}
+
+/**
+ * @brief       检查一份记录是否完整
+ * @param       cp: 记录
+ * @retval      1: 有效; 0: 无效
+ */
+static uint8_t checkpoint_valid(const checkpoint_t *cp)
+{
+    return (cp->magic == CHECKPOINT_MAGIC) && (cp->crc == checkpoint_crc(cp));
+}
+
+/**
+ * @brief       开启后备SRAM并恢复最新的记录
+ * @note        后备调压器开启后, 主电源掉电时后备SRAM由VBAT保持.
+ *              需要在stepper_home_init()之前调用, 回零状态和位置由它从g_checkpoint恢复
+ * @param       无
+ * @retval      CHECKPOINT_EOK   : 已恢复
+ *              CHECKPOINT_EEMPTY: 没有有效记录(第一次上电或电池掉电), g_checkpoint为空记录
+ */
+uint8_t checkpoint_init(void)
+{
+    uint8_t a;
+    uint8_t b;
+
+    __HAL_RCC_PWR_CLK_ENABLE();                 /* 使能电源时钟PWR */
+    HAL_PWR_EnableBkUpAccess();                 /* 取消备份区写保护 */
+    __HAL_RCC_BKPSRAM_CLK_ENABLE();             /* 使能后备SRAM时钟 */
+    HAL_PWREx_EnableBkUpReg();                  /* 开启后备调压器, 等待就绪 */
+    __HAL_RCC_CRC_CLK_ENABLE();                 /* 使能CRC单元时钟 */
+
+    a = checkpoint_valid(g_checkpoint_slot[0]);
+    b = checkpoint_valid(g_checkpoint_slot[1]);
+
+    if (a && b)                                 /* 都有效, 取序号新的一份, 差值比较允许序号回绕 */
+    {
+        a = ((int32_t)(g_checkpoint_slot[0]->seq - g_checkpoint_slot[1]->seq) > 0);
+        b = !a;
+    }
+
+    if (a || b)
+    {
+        g_checkpoint = *g_checkpoint_slot[a ? 0 : 1];
+        return CHECKPOINT_EOK;
+    }
+
+    memset(&g_checkpoint, 0, sizeof(g_checkpoint));
+    g_checkpoint.magic = CHECKPOINT_MAGIC;
+    g_checkpoint.cell_x = CHECKPOINT_CELL_NONE;
+    g_checkpoint.cell_y = CHECKPOINT_CELL_NONE;
+
+    return CHECKPOINT_EEMPTY;
+}
+
+/**
+ * @brief       保存当前记录
+ * @note        序号加1后写入较旧的一份, 先写数据再写CRC, 另一份保持不变;
+ *              后备SRAM读写没有次数限制, 状态每次改变都可以立即保存
+ * @param       无
+ * @retval      无
+ */
+void checkpoint_save(void)
+{
+    checkpoint_t *slot;
+
+    g_checkpoint.seq++;
+    g_checkpoint.crc = checkpoint_crc(&g_checkpoint);
+
+    slot = g_checkpoint_slot[g_checkpoint.seq & 1];
+    slot->crc = 0;                              /* 先使旧内容失效 */
+    __DSB();
+    memcpy(slot, &g_checkpoint, sizeof(checkpoint_t) - 4);
+    __DSB();
+    slot->crc = g_checkpoint.crc;
+    __DSB();
+}
+
+/**
+ * @brief       开始新的测量
+ * @param       run_id: 测量编号, 0表示结束当前测量
+ * @retval      无
+ */
+void checkpoint_run(uint32_t run_id)
+{
+    g_checkpoint.run_id = run_id;
+    g_checkpoint.cell_x = CHECKPOINT_CELL_NONE;
+    g_checkpoint.cell_y = CHECKPOINT_CELL_NONE;
+    g_checkpoint.done[0] = 0;
+    g_checkpoint.done[1] = 0;
+    checkpoint_save();
+}
+
+/**
+ * @brief       设置当前网格
+ * @param       x: 网格行, 0 ~ CHECKPOINT_GRID_N - 1
+ * @param       y: 网格列, 0 ~ CHECKPOINT_GRID_N - 1
+ * @retval      CHECKPOINT_EOK   : 设置成功
+ *              CHECKPOINT_EINVAL: 参数错误
+ */
+uint8_t checkpoint_cell(uint8_t x, uint8_t y)
+{
+    if ((x >= CHECKPOINT_GRID_N) || (y >= CHECKPOINT_GRID_N))
+    {
+        return CHECKPOINT_EINVAL;
+    }
+
+    if ((g_checkpoint.cell_x != x) || (g_checkpoint.cell_y != y))
+    {
+        g_checkpoint.cell_x = x;
+        g_checkpoint.cell_y = y;
+        checkpoint_save();
+    }
+
+    return CHECKPOINT_EOK;
+}
+
+/**
+ * @brief       当前网格测量完成, 记入已完成位图
+ * @param       无
+ * @retval      CHECKPOINT_EOK   : 已记录
+ *              CHECKPOINT_EINVAL: 没有当前网格
+ */
+uint8_t checkpoint_cell_done(void)
+{
+    uint8_t bit;
+
+    if (g_checkpoint.cell_x >= CHECKPOINT_GRID_N)
+    {
+        return CHECKPOINT_EINVAL;
+    }
+
+    bit = g_checkpoint.cell_x * CHECKPOINT_GRID_N + g_checkpoint.cell_y;
+    g_checkpoint.done[bit >> 5] |= 1UL << (bit & 0x1F);
+    checkpoint_save();
+
+    return CHECKPOINT_EOK;
+}
+
+/**
+ * @brief       查询网格是否已完成
+ * @param       x: 网格行
+ * @param       y: 网格列
+ * @retval      1: 已完成; 0: 未完成或参数错误
+ */
+uint8_t checkpoint_is_done(uint8_t x, uint8_t y)
+{
+    uint8_t bit;
+
+    if ((x >= CHECKPOINT_GRID_N) || (y >= CHECKPOINT_GRID_N))
+    {
+        return 0;
+    }
+
+    bit = x * CHECKPOINT_GRID_N + y;
+    return (g_checkpoint.done[bit >> 5] >> (bit & 0x1F)) & 1;
+}
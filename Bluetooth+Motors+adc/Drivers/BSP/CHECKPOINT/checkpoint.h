@@ -0,0 +1,68 @@
+/**
+ ****************************************************************************************************
+ * @file        checkpoint.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       后备SRAM断电续测记录 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 各轴绝对位置、回零状态、测量编号、当前网格和已完成网格保存在4KB后备SRAM中,
+ * 由纽扣电池和后备调压器保持, 与rtc.c使用的RTC后备寄存器同属后备域.
+ * 记录分为A/B两份交替写入, 每份带序号和CRC32: 写入过程中掉电只会损坏正在写的那份,
+ * 上电时取CRC正确且序号最新的一份, 所以总能恢复到最后一次完整保存的状态.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __CHECKPOINT_H
+#define __CHECKPOINT_H
+
+#include "./SYSTEM/sys/sys.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+
+/******************************************************************************************/
+/* 记录定义 */
+
+#define CHECKPOINT_MAGIC        0x43504B31      /* "CPK1", 结构体改动时需要修改 */
+#define CHECKPOINT_GRID_N       7               /* 测量网格边长, 与上位机的7x7网格一致 */
+#define CHECKPOINT_CELL_NONE    0xFF            /* 没有当前网格 */
+
+/* 错误代码 */
+#define CHECKPOINT_EOK          0               /* 已恢复 */
+#define CHECKPOINT_EEMPTY       1               /* 两份记录都无效, 从空记录开始 */
+#define CHECKPOINT_EINVAL       2               /* 参数错误 */
+
+typedef struct
+{
+    uint32_t magic;                             /* 记录标志 */
+    uint32_t seq;                               /* 保存序号, 每次保存加1, 决定写入哪一份 */
+    uint32_t run_id;                            /* 测量编号, 由上位机分配, 0表示没有进行中的测量 */
+    uint8_t cell_x;                             /* 当前网格行, CHECKPOINT_CELL_NONE表示没有 */
+    uint8_t cell_y;                             /* 当前网格列 */
+    uint8_t homed;                              /* 各轴回零状态, bit0~bit3对应电机1~4, 置位表示位置可信 */
+    uint8_t reserved;
+    uint32_t done[2];                           /* 已完成网格位图, 第(x * CHECKPOINT_GRID_N + y)位 */
+    int32_t pos[STEPPER_AXIS_NUM];              /* 各轴停止时的绝对位置, 单位: 步 */
+    uint32_t crc;                               /* 以上各字的CRC32 */
+} checkpoint_t;
+
+extern checkpoint_t g_checkpoint;               /* 当前记录(RAM副本) */
+
+/******************************************************************************************/
+/* 外部接口函数*/
+uint8_t checkpoint_init(void);                                          /* 开启后备SRAM并恢复最新的记录 */
+void checkpoint_save(void);                                             /* 保存当前记录 */
+void checkpoint_run(uint32_t run_id);                                   /* 开始新的测量, 清除网格进度 */
+uint8_t checkpoint_cell(uint8_t x, uint8_t y);                          /* 设置当前网格 */
+uint8_t checkpoint_cell_done(void);                                     /* 当前网格测量完成 */
+uint8_t checkpoint_is_done(uint8_t x, uint8_t y);                       /* 查询网格是否已完成 */
+
+#endif
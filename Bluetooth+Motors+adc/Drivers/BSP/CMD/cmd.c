@@ -0,0 +1,473 @@
+/**
+ ****************************************************************************************************
+ * @file        cmd.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       蓝牙命令注册与分发 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/CMD/cmd.h"
+#include "./BSP/ATK_MW579/atk_mw579_uart.h"
+#include "./SYSTEM/usart/usart.h"
+#include <string.h>
+#include <stdlib.h>
+
+
+static const cmd_t *g_cmd_hash[CMD_HASH_SIZE];     /* 动词哈希表, 开放寻址 */
+static uint16_t g_cmd_num;                          /* 已注册的命令数 */
+static struct
+{
+    const cmd_t *entry[CMD_URGENT_NUM];             /* 已执行的紧急命令 */
+    uint8_t ret[CMD_URGENT_NUM];                    /* 处理函数返回值 */
+    volatile uint8_t head;                          /* 由接收中断写入 */
+    volatile uint8_t tail;                          /* 由cmd_poll()读取 */
+} g_cmd_urgent;                                     /* 待发送的紧急命令应答 */
+
+cmd_sta_t g_cmd_sta = {0};
+
+static uint8_t cmd_urgent(const uint8_t *frame, uint16_t len);
+
+/**
+ * @brief       计算动词的FNV-1a哈希
+ * @param       verb: 动词
+ * @retval      哈希值
+ */
+static uint32_t cmd_hash(const char *verb)
+{
+    uint32_t h = 2166136261u;
+
+    while (*verb)
+    {
+        h ^= (uint8_t)*verb++;
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+/**
+ * @brief       查找命令
+ * @param       verb: 动词
+ * @retval      命令表项, 没有注册时返回NULL
+ */
+static const cmd_t *cmd_find(const char *verb)
+{
+    uint32_t slot = cmd_hash(verb) & (CMD_HASH_SIZE - 1);
+
+    while (g_cmd_hash[slot] != NULL)        /* 表最多半满, 一定有空槽结束探测 */
+    {
+        if (strcmp(g_cmd_hash[slot]->verb, verb) == 0)
+        {
+            return g_cmd_hash[slot];
+        }
+        slot = (slot + 1) & (CMD_HASH_SIZE - 1);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief       初始化, 注册cmd_config.c中的命令表, 开启紧急命令通道
+ * @note        注册命令表应在蓝牙模块初始化之前完成, 之后只有主循环会修改哈希表
+ * @param       无
+ * @retval      无
+ */
+void cmd_init(void)
+{
+    memset(g_cmd_hash, 0, sizeof(g_cmd_hash));
+    g_cmd_num = 0;
+    cmd_register(g_cmd_table, g_cmd_table_num);
+    atk_mw579_uart_rx_set_urgent(cmd_urgent);
+}
+
+/**
+ * @brief       注册命令表
+ * @note        表项只保存指针, table必须是常量或静态数组
+ * @param       table: 命令表
+ * @param       num  : 命令数
+ * @retval      CMD_EOK    : 全部注册成功
+ *              CMD_EFULL  : 超过CMD_NUM_MAX, 其后的命令未注册
+ *              CMD_EEXIST : 有动词重复, 重复的命令未注册
+ */
+uint8_t cmd_register(const cmd_t *table, uint16_t num)
+{
+    uint8_t ret = CMD_EOK;
+    uint32_t slot;
+    uint16_t i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (g_cmd_num >= CMD_NUM_MAX)
+        {
+            return CMD_EFULL;
+        }
+
+        if ((strlen(table[i].verb) > CMD_VERB_MAX) || (cmd_find(table[i].verb) != NULL))
+        {
+            ret = CMD_EEXIST;
+            continue;
+        }
+
+        slot = cmd_hash(table[i].verb) & (CMD_HASH_SIZE - 1);
+        while (g_cmd_hash[slot] != NULL)
+        {
+            slot = (slot + 1) & (CMD_HASH_SIZE - 1);
+        }
+        g_cmd_hash[slot] = &table[i];
+        g_cmd_num++;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief       取下一个以空白分隔的单词
+ * @param       p: 当前位置, 返回时指向单词之后
+ * @retval      单词(已在原位以'\0'结束), 没有单词时返回NULL
+ */
+static char *cmd_next_word(char **p)
+{
+    char *s = *p;
+    char *word;
+
+    while ((*s == ' ') || (*s == '\t') || (*s == '\r'))
+    {
+        s++;
+    }
+
+    if (*s == '\0')
+    {
+        *p = s;
+        return NULL;
+    }
+
+    word = s;
+    while ((*s != '\0') && (*s != ' ') && (*s != '\t') && (*s != '\r'))
+    {
+        s++;
+    }
+
+    if (*s != '\0')
+    {
+        *s++ = '\0';
+    }
+    *p = s;
+
+    return word;
+}
+
+/**
+ * @brief       按类型解析一个参数
+ * @param       type : 参数类型字符
+ * @param       enums: 枚举名列表
+ * @param       word : 参数文本
+ * @param       arg  : 解析结果
+ * @retval      CMD_EOK: 成功; CMD_EARG: 格式错误
+ */
+static uint8_t cmd_parse_arg(char type, const char *const *enums, const char *word, cmd_arg_t *arg)
+{
+    char *end;
+    int32_t i;
+
+    switch (type)
+    {
+        case 'i':
+            arg->i = strtol(word, &end, 0);
+            return (*end == '\0') ? CMD_EOK : CMD_EARG;
+
+        case 'f':
+            arg->f = strtof(word, &end);
+            return (*end == '\0') ? CMD_EOK : CMD_EARG;
+
+        case 's':
+            arg->s = word;
+            return CMD_EOK;
+
+        case 'e':
+            for (i = 0; (enums != NULL) && (enums[i] != NULL); i++)
+            {
+                if (strcmp(enums[i], word) == 0)
+                {
+                    arg->i = i;
+                    return CMD_EOK;
+                }
+            }
+
+            arg->i = strtol(word, &end, 10);    /* 也可以直接给序号 */
+            if ((*end != '\0') || (enums == NULL) || (arg->i < 0) || (arg->i >= i))
+            {
+                return CMD_EARG;
+            }
+            return CMD_EOK;
+
+        default:
+            return CMD_EARG;
+    }
+}
+
+/**
+ * @brief       按命令的参数类型串解析参数
+ * @param       entry: 命令表项
+ * @param       p    : 动词之后的文本, 会被原位修改
+ * @param       arg  : 解析结果
+ * @param       argc : 解析出的参数个数
+ * @retval      CMD_EOK: 成功; CMD_EARG: 参数个数或格式错误
+ */
+static uint8_t cmd_parse(const cmd_t *entry, char *p, cmd_arg_t *arg, uint8_t *argc)
+{
+    const char *type;
+    char *word;
+    uint8_t optional = 0;
+
+    *argc = 0;
+    for (type = entry->args; *type != '\0'; type++)
+    {
+        if (*type == '!')
+        {
+            continue;
+        }
+
+        if (*type == '?')
+        {
+            optional = 1;
+            continue;
+        }
+
+        if (*type == '*')
+        {
+            while ((*p == ' ') || (*p == '\t') || (*p == '\r'))
+            {
+                p++;
+            }
+            word = (*p != '\0') ? p : NULL;
+            p += strlen(p);                     /* 剩下的文本都属于这个参数 */
+        }
+        else
+        {
+            word = cmd_next_word(&p);
+        }
+
+        if (word == NULL)
+        {
+            return optional ? CMD_EOK : CMD_EARG;
+        }
+
+        if ((*argc >= CMD_ARGS_MAX) || (cmd_parse_arg((*type == '*') ? 's' : *type, entry->enums, word, &arg[*argc]) != CMD_EOK))
+        {
+            return CMD_EARG;
+        }
+        (*argc)++;
+    }
+
+    return (cmd_next_word(&p) == NULL) ? CMD_EOK : CMD_EARG;    /* 不能有多余的参数 */
+}
+
+/**
+ * @brief       解析并执行一条命令, 发送应答
+ * @param       cmd: 命令文本, 会被原位修改
+ * @param       ret: 处理函数的返回值, 没有执行时为CMD_NOREPLY
+ * @retval      CMD_EOK: 已执行; CMD_EARG: 参数错误; CMD_EUNKNOWN: 没有该命令
+ */
+uint8_t cmd_call(char *cmd, uint8_t *ret)
+{
+    const cmd_t *entry;
+    cmd_arg_t arg[CMD_ARGS_MAX];
+    char *verb;
+    uint8_t argc;
+
+    *ret = CMD_NOREPLY;
+    verb = cmd_next_word(&cmd);
+    if (verb == NULL)
+    {
+        return CMD_EOK;                     /* 空命令 */
+    }
+
+    entry = cmd_find(verb);
+    if (entry == NULL)
+    {
+        atk_mw579_uart_printf("unknown:%s\r\n", verb);
+        return CMD_EUNKNOWN;
+    }
+
+    if (cmd_parse(entry, cmd, arg, &argc) != CMD_EOK)
+    {
+        atk_mw579_uart_printf("%s:earg\r\n", entry->verb);
+        return CMD_EARG;
+    }
+
+    *ret = entry->handler(arg, argc);
+    if (*ret != CMD_NOREPLY)
+    {
+        atk_mw579_uart_printf("%s:%d\r\n", entry->verb, *ret);
+    }
+
+    return CMD_EOK;
+}
+
+/**
+ * @brief       只检查一条命令的动词和参数, 不执行也不应答
+ * @note        用于先保存后执行的命令(如宏的步骤), 保存时就能发现错误
+ * @param       cmd: 命令文本, 会被原位修改
+ * @retval      CMD_EOK: 可以执行; CMD_EARG: 参数错误; CMD_EUNKNOWN: 没有该命令或为空
+ */
+uint8_t cmd_check(char *cmd)
+{
+    const cmd_t *entry;
+    cmd_arg_t arg[CMD_ARGS_MAX];
+    char *verb;
+    uint8_t argc;
+
+    verb = cmd_next_word(&cmd);
+    if (verb == NULL)
+    {
+        return CMD_EUNKNOWN;
+    }
+
+    entry = cmd_find(verb);
+    if (entry == NULL)
+    {
+        return CMD_EUNKNOWN;
+    }
+
+    return cmd_parse(entry, cmd, arg, &argc);
+}
+
+/**
+ * @brief       紧急帧回调, 在接收中断中执行紧急命令
+ * @note        不能调用atk_mw579_uart_printf(), 应答记录下来由cmd_poll()发送
+ * @param       frame: 接收到的一帧, 以'\0'结尾
+ * @param       len  : 帧长度
+ * @retval      1: 是紧急命令, 已执行; 0: 不是, 进入队列
+ */
+static uint8_t cmd_urgent(const uint8_t *frame, uint16_t len)
+{
+    char line[CMD_URGENT_SIZE];
+    char *p = line;
+    const cmd_t *entry;
+    cmd_arg_t arg[CMD_ARGS_MAX];
+    uint8_t argc;
+    uint8_t next;
+    char *verb;
+
+    if ((len >= CMD_URGENT_SIZE) || (strpbrk((const char *)frame, ";\n") != NULL))
+    {
+        return 0;
+    }
+
+    memcpy(line, frame, len + 1);
+    verb = cmd_next_word(&p);
+    if (verb == NULL)
+    {
+        return 0;
+    }
+
+    entry = cmd_find(verb);
+    if ((entry == NULL) || (entry->args[0] != '!') || (cmd_parse(entry, p, arg, &argc) != CMD_EOK))
+    {
+        return 0;                           /* 参数错误也交给主循环, 由它统一应答 */
+    }
+
+    g_cmd_urgent.ret[g_cmd_urgent.head] = entry->handler(arg, argc);
+    g_cmd_urgent.entry[g_cmd_urgent.head] = entry;
+    next = (g_cmd_urgent.head + 1) % CMD_URGENT_NUM;
+    if (next != g_cmd_urgent.tail)          /* 应答队列满时命令照常执行, 只是不再应答 */
+    {
+        g_cmd_urgent.head = next;
+    }
+    g_cmd_sta.urgents++;
+
+    return 1;
+}
+
+/**
+ * @brief       解析并执行一帧命令
+ * @note        一帧中的多条命令以';'或换行分隔, 按顺序执行
+ * @param       line: 接收到的一帧, 以'\0'结束, 会被原位修改
+ * @retval      最后一个出错命令的错误代码, 全部成功时为CMD_EOK
+ */
+uint8_t cmd_dispatch(char *line)
+{
+    uint8_t ret = CMD_EOK;
+    uint8_t res;
+    uint8_t status;
+    char *cmd = line;
+    char *p;
+
+    for (p = line; ; p++)
+    {
+        if ((*p == ';') || (*p == '\n') || (*p == '\0'))
+        {
+            char c = *p;
+
+            *p = '\0';
+            res = cmd_call(cmd, &status);
+            if (res != CMD_EOK)
+            {
+                ret = res;
+            }
+
+            if (c == '\0')
+            {
+                break;
+            }
+            cmd = p + 1;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief       执行队列中的命令, 在主循环中调用
+ * @note        先发送紧急命令的应答和丢帧报告, 再按到达顺序执行全部排队的帧
+ * @param       无
+ * @retval      无
+ */
+void cmd_poll(void)
+{
+    uint8_t *frame;
+    uint32_t wait;
+    uint8_t tail;
+
+    while (g_cmd_urgent.tail != g_cmd_urgent.head)
+    {
+        tail = g_cmd_urgent.tail;
+        if (g_cmd_urgent.ret[tail] != CMD_NOREPLY)
+        {
+            atk_mw579_uart_printf("%s:%d\r\n", g_cmd_urgent.entry[tail]->verb, g_cmd_urgent.ret[tail]);
+        }
+        g_cmd_urgent.tail = (tail + 1) % CMD_URGENT_NUM;
+    }
+
+    if (g_atk_mw579_uart_rx_sta.drops != g_cmd_sta.ovf_reported)
+    {
+        /* 有命令帧因队列满被丢弃, 上位机需要重发 */
+        g_cmd_sta.ovf_reported = g_atk_mw579_uart_rx_sta.drops;
+        atk_mw579_uart_printf("ovf:%lu\r\n", g_cmd_sta.ovf_reported);
+    }
+
+    while ((frame = atk_mw579_uart_rx_get_frame()) != NULL)
+    {
+        wait = HAL_GetTick() - atk_mw579_uart_rx_get_frame_tick();
+        if (wait > g_cmd_sta.max_wait)
+        {
+            g_cmd_sta.max_wait = wait;
+        }
+
+        printf("%s\r\n", frame);
+        cmd_dispatch((char *)frame);
+        g_cmd_sta.execs++;
+        atk_mw579_uart_rx_restart();
+    }
+}
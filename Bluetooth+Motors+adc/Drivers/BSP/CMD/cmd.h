@@ -0,0 +1,114 @@
+/**
+ ****************************************************************************************************
+ * @file        cmd.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       蓝牙命令注册与分发 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 命令格式: <动词> [参数1] [参数2] ..., 以空格分隔; 一帧中可以用';'或换行分隔多条命令
+ * 命令表在cmd_config.c中配置(与USMART的usmart_config.c相同), 其他模块也可以用cmd_register()
+ * 注册自己的命令表, 不需要修改分发代码.
+ * cmd_init()把动词按FNV-1a哈希放入开放寻址表, 表长为命令数上限的2倍, 分发时只计算一次哈希,
+ * 平均探测1~2次即可找到, 与命令数无关.
+ *
+ * 参数类型串, 每个字符对应一个参数:
+ *   'i': 整数, 支持十进制和0x开头的十六进制
+ *   'f': 浮点数
+ *   'e': 枚举, 可以是枚举名, 也可以是序号, 解析结果为序号
+ *   's': 字符串, 一个单词
+ *   '*': 字符串, 该行剩下的全部文本(可含空格), 必须放在最后
+ *   '?': 其后的参数可以省略, 省略的参数个数由argc给出
+ *   '!': 放在最前, 紧急命令, 见下
+ *
+ * 命令队列:
+ *   接收中断把每个完整帧放入atk_mw579_uart的帧环形队列(记录长度和到达时刻), cmd_poll()在主循环中
+ *   按顺序取出并执行全部排队的帧; 队列满丢帧时向上位机上报"ovf:<累计丢帧数>".
+ *   紧急命令(stop, estop, credit, sync, mstop)由接收中断回调直接执行, 不经过队列, 所以不受主循环阻塞
+ *   (如回零等待)和队列满的影响; 其处理函数必须可以在中断中调用, 应答推迟到cmd_poll()中发送.
+ *   一帧只含一条紧急命令时才走紧急通道, 与其他命令合在一帧时按普通命令排队.
+ *
+ * 应答格式(统一):
+ *   <动词>:<返回值>    处理函数返回的状态, 0表示成功, 其余为各模块的错误代码
+ *   <动词>:earg        参数个数、类型或枚举名错误, 未执行
+ *   unknown:<动词>     没有注册该命令
+ * 处理函数返回CMD_NOREPLY时由处理函数自己发送应答(带数据的查询命令)
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __CMD_H
+#define __CMD_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 配置 */
+
+#define CMD_NUM_MAX             48              /* 最多注册的命令数 */
+#define CMD_HASH_SIZE           128             /* 哈希表长度, 2的幂, 不小于CMD_NUM_MAX的2倍 */
+#define CMD_ARGS_MAX            4               /* 每条命令最多参数数 */
+#define CMD_VERB_MAX            12              /* 动词最大长度 */
+#define CMD_URGENT_SIZE         32              /* 紧急命令帧最大长度 */
+#define CMD_URGENT_NUM          4               /* 待发送的紧急命令应答数 */
+
+/* 错误代码 */
+#define CMD_EOK                 0               /* 没有错误 */
+#define CMD_EFULL               1               /* 命令表已满 */
+#define CMD_EEXIST              2               /* 动词已注册 */
+#define CMD_EARG                3               /* 参数错误 */
+#define CMD_EUNKNOWN            4               /* 没有该命令 */
+
+#define CMD_NOREPLY             0xFF            /* 处理函数已自行应答 */
+
+/* 参数值 */
+typedef union
+{
+    int32_t i;                                  /* 'i'和'e'类型 */
+    float f;                                    /* 'f'类型 */
+    const char *s;                              /* 's'和'*'类型, 指向命令文本内部, 只在处理函数中有效 */
+} cmd_arg_t;
+
+/* 处理函数, 返回状态码或CMD_NOREPLY */
+typedef uint8_t (*cmd_handler_t)(const cmd_arg_t *arg, uint8_t argc);
+
+typedef struct
+{
+    const char *verb;                           /* 动词 */
+    const char *args;                           /* 参数类型串, 无参数时为"" */
+    const char *const *enums;                   /* 'e'类型的枚举名, 以NULL结尾, 没有时为NULL */
+    cmd_handler_t handler;                      /* 处理函数 */
+} cmd_t;
+
+/* 命令队列统计 */
+typedef struct
+{
+    uint32_t execs;                             /* 已执行的排队帧数 */
+    uint32_t urgents;                           /* 已执行的紧急命令数 */
+    uint32_t max_wait;                          /* 帧在队列中的最长等待时间, 单位: ms */
+    uint32_t ovf_reported;                      /* 已上报的接收丢帧数 */
+} cmd_sta_t;
+
+extern cmd_sta_t g_cmd_sta;
+
+extern const cmd_t g_cmd_table[];               /* cmd_config.c中的命令表 */
+extern const uint16_t g_cmd_table_num;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void cmd_init(void);                                                    /* 初始化, 注册cmd_config.c中的命令表 */
+uint8_t cmd_register(const cmd_t *table, uint16_t num);                 /* 注册命令表 */
+uint8_t cmd_dispatch(char *line);                                       /* 解析并执行一帧命令 */
+uint8_t cmd_call(char *cmd, uint8_t *ret);                              /* 解析并执行一条命令, 取得处理函数的返回值 */
+uint8_t cmd_check(char *cmd);                                           /* 只检查一条命令的动词和参数, 不执行 */
+void cmd_poll(void);                                                    /* 执行队列中的命令, 在主循环中调用 */
+
+#endif
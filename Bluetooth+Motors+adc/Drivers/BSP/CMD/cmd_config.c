@@ -0,0 +1,422 @@
+/**
+ ****************************************************************************************************
+ * @file        cmd_config.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       蓝牙命令表 配置代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 各驱动模块的维护/诊断命令在这里配置; 与探测流程状态相关的命令(power, change, move等)
+ * 由main.c用cmd_register()注册.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/CMD/cmd.h"
+
+/******************************************************************************************/
+/* 用户配置区
+ * 这下面要包含所用到的函数所申明的头文件(用户自己添加)
+ */
+
+#include "./BSP/ATK_MW579/atk_mw579.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./BSP/STEPPER_MOTOR/stepper_power.h"
+#include "./BSP/STEPPER_MOTOR/stepper_verify.h"
+#include "./BSP/STEPPER_MOTOR/stepper_comp.h"
+#include "./BSP/STEPPER_MOTOR/stepper_scope.h"
+#include "./BSP/STEPPER_MOTOR/stepper_home.h"
+#include "./BSP/STEPPER_MOTOR/stepper_unit.h"
+#include "./BSP/ESTOP/estop.h"
+#include "./BSP/STEERING_ENGINE/steering_engine.h"
+#include "./BSP/CHECKPOINT/checkpoint.h"
+#include "./BSP/TELEMETRY/telemetry.h"
+#include "./BSP/BENCH/bench.h"
+#include "./BSP/TIMESYNC/timesync.h"
+#include "./BSP/MACRO/macro.h"
+#include <stdio.h>
+
+
+/**
+ * @brief       verify: 检测模式, 当前偏差, 最大偏差, 堵转可能性(%), 查询后清除统计
+ */
+static uint8_t cmd_verify(const cmd_arg_t *arg, uint8_t argc)
+{
+    atk_mw579_uart_printf("verify:%d,%d,%d,%d\r\n", g_stepper_verify.mode, g_stepper_verify.dev,
+                          g_stepper_verify.max_dev, g_stepper_verify.stall);
+    stepper_verify_clear();
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       slip <N>: 模拟模式下每N步丢1步, 0关闭
+ * @note        不应答, "slip:"留给丢步事件
+ */
+static uint8_t cmd_slip(const cmd_arg_t *arg, uint8_t argc)
+{
+    stepper_verify_set_sim(arg[0].i > 0 ? arg[0].i : 0);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       clear: 解除急停
+ */
+static uint8_t cmd_clear(const cmd_arg_t *arg, uint8_t argc)
+{
+    return estop_clear();
+}
+
+/**
+ * @brief       duty: 各轴驱动器使能时间占比, 千分比
+ */
+static uint8_t cmd_duty(const cmd_arg_t *arg, uint8_t argc)
+{
+    atk_mw579_uart_printf("duty:%d,%d,%d,%d\r\n",
+                          stepper_power_get_duty(STEPPER_MOTOR_1), stepper_power_get_duty(STEPPER_MOTOR_2),
+                          stepper_power_get_duty(STEPPER_MOTOR_3), stepper_power_get_duty(STEPPER_MOTOR_4));
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       lash <电机序号> <反向间隙um>: 现场标定反向间隙
+ */
+static uint8_t cmd_lash(const cmd_arg_t *arg, uint8_t argc)
+{
+    if ((arg[0].i < STEPPER_MOTOR_1) || (arg[0].i > STEPPER_MOTOR_4) || (arg[1].i < 0))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    stepper_comp_set_backlash(arg[0].i, arg[1].i);
+    return STEPPER_EOK;
+}
+
+/**
+ * @brief       limit <电机序号> <下限um> <上限um> <使能>: 设置软限位, 位置相对回零后的坐标
+ * @note        保存在RTC后备寄存器中, 复位后仍有效; 从未设置过的轴使用编译时的默认值
+ */
+static uint8_t cmd_limit(const cmd_arg_t *arg, uint8_t argc)
+{
+    if ((arg[0].i < STEPPER_MOTOR_1) || (arg[0].i > STEPPER_MOTOR_4) || (arg[3].i < 0) || (arg[3].i > 1))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    return stepper_home_set_limit(arg[0].i, stepper_um_to_steps(arg[0].i, arg[1].i),
+                                  stepper_um_to_steps(arg[0].i, arg[2].i), arg[3].i);
+}
+
+/**
+ * @brief       servo <编号1~3> <角度> <时间ms>: 平滑转动, 不阻塞
+ */
+static uint8_t cmd_servo(const cmd_arg_t *arg, uint8_t argc)
+{
+    if ((arg[2].i < 0) || (arg[2].i > 0xFFFF))
+    {
+        return SERVO_EINVAL;
+    }
+
+    return servo_move(arg[0].i, arg[1].f, arg[2].i);
+}
+
+/**
+ * @brief       scope <步数> <最高速度重装载值>: 步进脉冲回环测试, 需要把PI5接到PA5
+ */
+static uint8_t cmd_scope(const cmd_arg_t *arg, uint8_t argc)
+{
+    if ((arg[1].i <= 0) || (arg[1].i > 0xFFFF))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    return stepper_scope_run(arg[0].i, arg[1].i);
+}
+
+/**
+ * @brief       run <编号>: 开始新的测量, 清除网格进度; 编号0表示结束测量
+ */
+static uint8_t cmd_run(const cmd_arg_t *arg, uint8_t argc)
+{
+    checkpoint_run((uint32_t)arg[0].i);
+    return CHECKPOINT_EOK;
+}
+
+/**
+ * @brief       cell <行> <列>: 探头已移到该网格, 下一次完整的下探/回撤记为该网格完成
+ */
+static uint8_t cmd_cell(const cmd_arg_t *arg, uint8_t argc)
+{
+    if ((arg[0].i < 0) || (arg[1].i < 0) || (arg[0].i > 0xFF) || (arg[1].i > 0xFF))
+    {
+        return CHECKPOINT_EINVAL;
+    }
+
+    return checkpoint_cell(arg[0].i, arg[1].i);
+}
+
+/**
+ * @brief       resume: 测量编号, 当前网格, 已完成网格位图(低/高32位), 各轴回零状态
+ */
+static uint8_t cmd_resume(const cmd_arg_t *arg, uint8_t argc)
+{
+    atk_mw579_uart_printf("ckpt:%lu,%d,%d,%08lx,%08lx,%d\r\n", g_checkpoint.run_id,
+                          g_checkpoint.cell_x, g_checkpoint.cell_y, g_checkpoint.done[0],
+                          g_checkpoint.done[1], g_checkpoint.homed);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       tlm [ascii|binary|varint|rice]: 遥测输出模式, 省略时只查询
+ *              应答: 模式, 样本数, 原始帧字节数, 每样本编码周期数
+ */
+static uint8_t cmd_tlm(const cmd_arg_t *arg, uint8_t argc)
+{
+    if (argc > 0)
+    {
+        telemetry_set_mode(arg[0].i);
+    }
+
+    atk_mw579_uart_printf("tlm:%d,%lu,%lu,%lu\r\n", g_telemetry.mode, g_telemetry.samples,
+                          g_telemetry.bytes, telemetry_cycles_per_sample());
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       link: 收到帧数, 接收丢帧, 接收截断, 已发条数, 发送丢弃, 发送队列最大深度
+ */
+static uint8_t cmd_link(const cmd_arg_t *arg, uint8_t argc)
+{
+    atk_mw579_uart_printf("link:%lu,%lu,%lu,%lu,%lu,%d\r\n", g_atk_mw579_uart_rx_sta.frames,
+                          g_atk_mw579_uart_rx_sta.drops, g_atk_mw579_uart_rx_sta.truncs,
+                          g_atk_mw579_uart_tx_sta.sent, g_atk_mw579_uart_tx_sta.drops,
+                          g_atk_mw579_uart_tx_sta.max_depth);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       cmdq: 排队帧数, 已执行帧数, 接收丢帧数, 紧急命令数, 最长排队时间(ms), 查询后清除最长时间
+ */
+static uint8_t cmd_cmdq(const cmd_arg_t *arg, uint8_t argc)
+{
+    atk_mw579_uart_printf("cmdq:%d,%lu,%lu,%lu,%lu\r\n", atk_mw579_uart_rx_get_frame_num() - 1, g_cmd_sta.execs,
+                          g_atk_mw579_uart_rx_sta.drops, g_cmd_sta.urgents, g_cmd_sta.max_wait);
+    g_cmd_sta.max_wait = 0;
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       credit <N>: 授予N帧遥测发送额度, N < 0关闭流量控制, N = 0只查询
+ * @note        紧急命令, 在接收中断中执行, 不占命令队列; 应答值为空闲的命令队列槽数,
+ *              上位机据此决定还能连续发几条命令
+ */
+static uint8_t cmd_credit(const cmd_arg_t *arg, uint8_t argc)
+{
+    telemetry_credit(arg[0].i);
+    return ATK_MW579_UART_RX_FRAME_NUM - 1 - atk_mw579_uart_rx_get_frame_num();
+}
+
+/**
+ * @brief       flow: 剩余遥测额度(-1为未开启), 空闲命令槽数, 发送链路利用率(千分比),
+ *              因无额度/发送队列将满而合并的帧数, 摘要帧数, 发送队列丢弃条数
+ */
+static uint8_t cmd_flow(const cmd_arg_t *arg, uint8_t argc)
+{
+    atk_mw579_uart_printf("flow:%ld,%d,%d,%lu,%lu,%lu,%lu\r\n", telemetry_credit_avail(),
+                          ATK_MW579_UART_RX_FRAME_NUM - atk_mw579_uart_rx_get_frame_num(), atk_mw579_uart_tx_util(),
+                          g_telemetry.credit_stalls, g_telemetry.queue_stalls, g_telemetry.summaries,
+                          g_atk_mw579_uart_tx_sta.drops);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       rtx <seq> <count>: 重发序号范围内的遥测记录; 应答: 重发帧数, 已不在历史缓冲中的记录数
+ */
+static uint8_t cmd_rtx(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint16_t sent;
+    uint16_t missing;
+
+    if ((arg[1].i <= 0) || (arg[1].i > 0x7FFF))
+    {
+        atk_mw579_uart_printf("rtx:earg\r\n");
+        return CMD_NOREPLY;
+    }
+
+    missing = telemetry_retransmit(arg[0].i, arg[1].i, &sent);
+    atk_mw579_uart_printf("rtx:%d,%d\r\n", sent, missing);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       replay: 开始回放断连期间缓存的遥测帧, 上位机重连并订阅通知后发送
+ *              应答: 断开次数, 最近断开/连接时刻(ms), 待回放记录数, 累计缓存记录数, 累计被覆盖的记录数
+ */
+static uint8_t cmd_replay(const cmd_arg_t *arg, uint8_t argc)
+{
+    g_telemetry.replay = 1;
+    atk_mw579_uart_printf("replay:%lu,%lu,%lu,%d,%lu,%lu\r\n", g_atk_mw579_conn.disconnects,
+                          g_atk_mw579_conn.down_tick, g_atk_mw579_conn.up_tick,
+                          (uint16_t)(g_telemetry.spool_end - g_telemetry.spool_seq),
+                          g_telemetry.spooled, g_telemetry.spool_lost);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       bench <大小> <速率帧/秒> <时长ms>: 蓝牙链路基准测试, 时长0停止; 结束时上报"benchend:"
+ */
+static uint8_t cmd_bench(const cmd_arg_t *arg, uint8_t argc)
+{
+    if ((arg[0].i < 0) || (arg[0].i > BENCH_SIZE_MAX) || (arg[1].i < 0) || (arg[1].i > BENCH_RATE_MAX) ||
+        (arg[2].i < 0) || (arg[2].i > BENCH_TIME_MAX))
+    {
+        return BENCH_EINVAL;
+    }
+
+    return bench_start(arg[0].i, arg[1].i, arg[2].i);
+}
+
+/**
+ * @brief       ping <n>: 往返延时测量, 应答: n, 设备时刻(ms)
+ */
+static uint8_t cmd_ping(const cmd_arg_t *arg, uint8_t argc)
+{
+    atk_mw579_uart_printf("ping:%ld,%lu\r\n", arg[0].i, HAL_GetTick());
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       sync <n>: 时钟同步, 紧急命令, 在接收中断中记下到达时刻
+ *              应答(主循环中): "sync:n,到达时刻us,应答时刻us"
+ */
+static uint8_t cmd_sync(const cmd_arg_t *arg, uint8_t argc)
+{
+    timesync_rx(arg[0].i);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       mdef <名称> <步骤>|<步骤>|...: 定义宏, 替换同名的宏; 应答: 结果, 步骤数(出错时为出错步骤的序号)
+ */
+static uint8_t cmd_mdef(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint8_t count;
+    uint8_t ret;
+
+    ret = macro_define(arg[0].s, arg[1].s, 0, &count);
+    atk_mw579_uart_printf("mdef:%d,%d\r\n", ret, count);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       madd <名称> <步骤>|<步骤>|...: 向已有的宏追加步骤, 一帧放不下的宏分几次上传; 应答同mdef
+ */
+static uint8_t cmd_madd(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint8_t count;
+    uint8_t ret;
+
+    ret = macro_define(arg[0].s, arg[1].s, 1, &count);
+    atk_mw579_uart_printf("madd:%d,%d\r\n", ret, count);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       mrun <名称> [次数]: 执行宏, 次数省略为1, 0为一直重复; 之后由"mbegin:"/"mend:"事件上报
+ */
+static uint8_t cmd_mrun(const cmd_arg_t *arg, uint8_t argc)
+{
+    if ((argc > 1) && (arg[1].i < 0))
+    {
+        return MACRO_EINVAL;
+    }
+
+    return macro_run(arg[0].s, (argc > 1) ? arg[1].i : 1);
+}
+
+/**
+ * @brief       mstop: 中止正在执行的宏, 由"mend:"事件报告结束
+ * @note        紧急命令, 在接收中断中执行
+ */
+static uint8_t cmd_mstop(const cmd_arg_t *arg, uint8_t argc)
+{
+    macro_abort();
+    return MACRO_EOK;
+}
+
+/**
+ * @brief       mdel <名称>: 删除宏
+ */
+static uint8_t cmd_mdel(const cmd_arg_t *arg, uint8_t argc)
+{
+    return macro_delete(arg[0].s);
+}
+
+/**
+ * @brief       mls: 正在执行的宏(没有时为空), 当前步骤序号, 累计执行/异常结束次数, 然后是各宏的名称/步骤数
+ */
+static uint8_t cmd_mls(const cmd_arg_t *arg, uint8_t argc)
+{
+    char buf[MACRO_NUM * (MACRO_NAME_MAX + 5) + 1];
+    uint16_t len = 0;
+    uint8_t i;
+
+    buf[0] = '\0';
+    for (i = 0; i < MACRO_NUM; i++)
+    {
+        if (g_macro[i].name[0] != '\0')
+        {
+            len += sprintf(&buf[len], ",%s/%d", g_macro[i].name, g_macro[i].steps);
+        }
+    }
+
+    atk_mw579_uart_printf("mls:%s,%d,%lu,%lu%s\r\n", g_macro_sta.running ? g_macro[g_macro_sta.cur].name : "",
+                          g_macro_sta.pc, g_macro_sta.runs, g_macro_sta.fails, buf);
+    return CMD_NOREPLY;
+}
+
+/* 枚举名, 顺序与TELEMETRY_MODE_xxx一致 */
+static const char *const g_cmd_tlm_modes[] = {"ascii", "binary", "varint", "rice", NULL};
+
+/* 命令表(用户自己添加)
+ * 动词, 参数类型串, 枚举名, 处理函数
+ */
+const cmd_t g_cmd_table[] =
+{
+    {"verify", "",    NULL,            cmd_verify},
+    {"slip",   "i",   NULL,            cmd_slip},
+    {"clear",  "",    NULL,            cmd_clear},
+    {"duty",   "",    NULL,            cmd_duty},
+    {"lash",   "ii",  NULL,            cmd_lash},
+    {"limit",  "iiii", NULL,           cmd_limit},
+    {"servo",  "ifi", NULL,            cmd_servo},
+    {"scope",  "ii",  NULL,            cmd_scope},
+    {"run",    "i",   NULL,            cmd_run},
+    {"cell",   "ii",  NULL,            cmd_cell},
+    {"resume", "",    NULL,            cmd_resume},
+    {"tlm",    "?e",  g_cmd_tlm_modes, cmd_tlm},
+    {"link",   "",    NULL,            cmd_link},
+    {"cmdq",   "",    NULL,            cmd_cmdq},
+    {"credit", "!i",  NULL,            cmd_credit},
+    {"flow",   "",    NULL,            cmd_flow},
+    {"rtx",    "ii",  NULL,            cmd_rtx},
+    {"replay", "",    NULL,            cmd_replay},
+    {"bench",  "iii", NULL,            cmd_bench},
+    {"ping",   "i",   NULL,            cmd_ping},
+    {"sync",   "!i",  NULL,            cmd_sync},
+    {"mdef",   "s*",  NULL,            cmd_mdef},
+    {"madd",   "s*",  NULL,            cmd_madd},
+    {"mrun",   "s?i", NULL,            cmd_mrun},
+    {"mstop",  "!",   NULL,            cmd_mstop},
+    {"mdel",   "s",   NULL,            cmd_mdel},
+    {"mls",    "",    NULL,            cmd_mls},
+};
+
+const uint16_t g_cmd_table_num = sizeof(g_cmd_table) / sizeof(cmd_t);
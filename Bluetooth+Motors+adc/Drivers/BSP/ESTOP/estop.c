@@ -0,0 +1,139 @@
+/**
+ ****************************************************************************************************
+ * @file        estop.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       急停输入 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/ESTOP/estop.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+
+
+estop_sta_t g_estop_sta = {0};              /* 急停状态 */
+
+/**
+ * @brief       急停初始化
+ * @note        急停中断为抢占优先级0, 子优先级0, 系统中唯一的最高优先级中断;
+ *              同时开启DWT周期计数器, 用于测量急停延时;
+ *              上电时急停按钮已经按下则直接进入急停锁存
+ * @param       无
+ * @retval      无
+ */
+void estop_init(void)
+{
+    GPIO_InitTypeDef gpio_init_struct;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;                 /* 使能DWT */
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                            /* 开启周期计数 */
+
+    ESTOP_GPIO_CLK_ENABLE();                                        /* 急停引脚时钟使能 */
+
+    gpio_init_struct.Pin = ESTOP_GPIO_PIN;                          /* 急停引脚 */
+    gpio_init_struct.Mode = GPIO_MODE_IT_FALLING;                   /* 下降沿触发 */
+    gpio_init_struct.Pull = GPIO_PULLUP;                            /* 上拉 */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;                  /* 高速 */
+    HAL_GPIO_Init(ESTOP_GPIO_PORT, &gpio_init_struct);              /* 初始化急停引脚 */
+
+    __HAL_GPIO_EXTI_CLEAR_IT(ESTOP_GPIO_PIN);
+    HAL_NVIC_SetPriority(ESTOP_INT_IRQn, 0, 0);                     /* 抢占优先级0，子优先级0 */
+    HAL_NVIC_EnableIRQ(ESTOP_INT_IRQn);                             /* 使能中断线0 */
+
+    if (ESTOP_ACTIVE())
+    {
+        estop_trigger();
+    }
+}
+
+/**
+ * @brief       急停中断服务函数
+ * @note        先关闭驱动器, 再做计时和锁存, 保证引脚到驱动器失能的路径最短
+ *              延时 = 中断入栈周期 + 中断函数入口到驱动器全部关闭的周期
+ * @param       无
+ * @retval      无
+ */
+void ESTOP_INT_IRQHandler(void)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles;
+
+    stepper_estop_isr();                                            /* 关闭所有驱动器和PWM输出 */
+    cycles = DWT->CYCCNT - start + ESTOP_IRQ_ENTRY;
+
+    __HAL_GPIO_EXTI_CLEAR_IT(ESTOP_GPIO_PIN);
+
+    if (g_estop_sta.latched == 0)                                   /* 按键抖动不覆盖第一次触发的记录 */
+    {
+        g_estop_sta.latched = 1;
+        g_estop_sta.reported = 0;
+        g_estop_sta.count++;
+        g_estop_sta.tick = HAL_GetTick();
+        g_estop_sta.cyccnt = start;
+        g_estop_sta.latency = cycles;
+    }
+}
+
+/**
+ * @brief       软件触发急停
+ * @note        通过EXTI软件中断触发, 与按钮走同一个中断服务函数
+ * @param       无
+ * @retval      无
+ */
+void estop_trigger(void)
+{
+    EXTI->SWIER = ESTOP_GPIO_PIN;
+}
+
+/**
+ * @brief       解除急停锁存
+ * @note        驱动器在下一次启动时重新使能; 解除后各轴需要重新回零
+ * @param       无
+ * @retval      ESTOP_EOK  : 解除成功
+ *              ESTOP_EBUSY: 急停按钮仍处于按下状态
+ */
+uint8_t estop_clear(void)
+{
+    if (ESTOP_ACTIVE())
+    {
+        return ESTOP_EBUSY;
+    }
+
+    HAL_NVIC_DisableIRQ(ESTOP_INT_IRQn);
+    g_estop_sta.latched = 0;
+    stepper_estop_release();
+    HAL_NVIC_EnableIRQ(ESTOP_INT_IRQn);
+
+    return ESTOP_EOK;
+}
+
+/**
+ * @brief       急停是否锁存
+ * @param       无
+ * @retval      0: 正常; 1: 急停锁存中
+ */
+uint8_t estop_is_latched(void)
+{
+    return g_estop_sta.latched;
+}
+
+/**
+ * @brief       获取最近一次急停的延时
+ * @param       无
+ * @retval      引脚到驱动器失能的延时, 单位: ns
+ */
+uint32_t estop_latency_ns(void)
+{
+    return g_estop_sta.latency * 1000 / ESTOP_CPU_MHZ;
+}
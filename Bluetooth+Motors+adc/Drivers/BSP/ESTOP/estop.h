@@ -0,0 +1,71 @@
+/**
+ ****************************************************************************************************
+ * @file        estop.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       急停输入 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 急停按钮接PA0(低电平有效), 下降沿触发最高优先级外部中断, 在中断中直接操作寄存器
+ * 关闭所有步进电机驱动器(EN引脚)并清除TIM8的MOE位, 同时锁存触发时刻.
+ * 锁存之后必须调用estop_clear()解除, 且只有急停按钮已经松开时才能解除.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __ESTOP_H
+#define __ESTOP_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 引脚 和 中断 定义 */
+
+#define ESTOP_GPIO_PORT                 GPIOA
+#define ESTOP_GPIO_PIN                  GPIO_PIN_0
+#define ESTOP_GPIO_CLK_ENABLE()         do{ __HAL_RCC_GPIOA_CLK_ENABLE(); }while(0)   /* PA口时钟使能 */
+#define ESTOP_INT_IRQn                  EXTI0_IRQn
+#define ESTOP_INT_IRQHandler            EXTI0_IRQHandler
+
+/******************************************************************************************/
+
+#define ESTOP_IO            ESTOP_GPIO_PORT, ESTOP_GPIO_PIN, 0              /* 引脚描述符, 低电平有效 */
+#define ESTOP_ACTIVE()      SYS_IO_ACTIVE(ESTOP_IO)                         /* 急停按钮按下 */
+
+#define ESTOP_CPU_MHZ       168                                             /* CPU主频, 用于周期数换算 */
+#define ESTOP_IRQ_ENTRY     12                                              /* Cortex-M4中断入栈周期数 */
+
+/* 错误代码 */
+#define ESTOP_EOK           0               /* 没有错误 */
+#define ESTOP_EBUSY         1               /* 急停按钮仍处于按下状态 */
+
+/* 急停状态结构体 */
+typedef struct
+{
+    volatile uint8_t latched;               /* 急停锁存标志 */
+    volatile uint8_t reported;              /* 本次急停是否已上报 */
+    volatile uint32_t count;                /* 急停触发次数 */
+    volatile uint32_t tick;                 /* 触发时刻, HAL_GetTick(), 单位: ms */
+    volatile uint32_t cyccnt;               /* 触发时刻, DWT周期计数 */
+    volatile uint32_t latency;              /* 引脚到驱动器失能的延时, 单位: CPU周期 */
+} estop_sta_t;
+
+extern estop_sta_t g_estop_sta;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void estop_init(void);                      /* 急停初始化 */
+void estop_trigger(void);                   /* 软件触发急停 */
+uint8_t estop_clear(void);                  /* 解除急停锁存 */
+uint8_t estop_is_latched(void);             /* 急停是否锁存 */
+uint32_t estop_latency_ns(void);            /* 获取急停延时, 单位: ns */
+
+#endif
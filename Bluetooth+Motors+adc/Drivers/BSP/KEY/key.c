@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        key.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief        
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       按键输入 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -27,59 +27,59 @@
 
 
 /**
- * @brief       ʼ
- * @param       
- * @retval      
+ * @brief       按键初始化函数
+ * @param       无
+ * @retval      无
  */
 void key_init(void)
 {
-    GPIO_InitTypeDef gpio_init_struct;                          /* GPIOò洢 */
-    KEY0_GPIO_CLK_ENABLE();                                     /* KEY0ʱʹ */
-    KEY1_GPIO_CLK_ENABLE();                                     /* KEY1ʱʹ */
-    KEY2_GPIO_CLK_ENABLE();                                     /* KEY2ʱʹ */
-
-    gpio_init_struct.Pin = KEY0_GPIO_PIN;                       /* KEY0 */
-    gpio_init_struct.Mode = GPIO_MODE_INPUT;                    /*  */
-    gpio_init_struct.Pull = GPIO_PULLUP;                        /*  */
-    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;              /*  */
-    HAL_GPIO_Init(KEY0_GPIO_PORT, &gpio_init_struct);           /* KEY0ģʽ, */
-
-    gpio_init_struct.Pin = KEY1_GPIO_PIN;                       /* KEY1 */
-    gpio_init_struct.Mode = GPIO_MODE_INPUT;                    /*  */
-    gpio_init_struct.Pull = GPIO_PULLUP;                        /*  */
-    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;              /*  */
-    HAL_GPIO_Init(KEY1_GPIO_PORT, &gpio_init_struct);           /* KEY1ģʽ, */
-
-    gpio_init_struct.Pin = KEY2_GPIO_PIN;                       /* KEY2 */
-    gpio_init_struct.Mode = GPIO_MODE_INPUT;                    /*  */
-    gpio_init_struct.Pull = GPIO_PULLUP;                        /*  */
-    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;              /*  */
-    HAL_GPIO_Init(KEY2_GPIO_PORT, &gpio_init_struct);           /* KEY2ģʽ, */
+    GPIO_InitTypeDef gpio_init_struct;                          /* GPIO配置参数存储变量 */
+    KEY0_GPIO_CLK_ENABLE();                                     /* KEY0时钟使能 */
+    KEY1_GPIO_CLK_ENABLE();                                     /* KEY1时钟使能 */
+    KEY2_GPIO_CLK_ENABLE();                                     /* KEY2时钟使能 */
+
+    gpio_init_struct.Pin = KEY0_GPIO_PIN;                       /* KEY0引脚 */
+    gpio_init_struct.Mode = GPIO_MODE_INPUT;                    /* 输入 */
+    gpio_init_struct.Pull = GPIO_PULLUP;                        /* 上拉 */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;              /* 高速 */
+    HAL_GPIO_Init(KEY0_GPIO_PORT, &gpio_init_struct);           /* KEY0引脚模式设置,上拉输入 */
+
+    gpio_init_struct.Pin = KEY1_GPIO_PIN;                       /* KEY1引脚 */
+    gpio_init_struct.Mode = GPIO_MODE_INPUT;                    /* 输入 */
+    gpio_init_struct.Pull = GPIO_PULLUP;                        /* 上拉 */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;              /* 高速 */
+    HAL_GPIO_Init(KEY1_GPIO_PORT, &gpio_init_struct);           /* KEY1引脚模式设置,上拉输入 */
+
+    gpio_init_struct.Pin = KEY2_GPIO_PIN;                       /* KEY2引脚 */
+    gpio_init_struct.Mode = GPIO_MODE_INPUT;                    /* 输入 */
+    gpio_init_struct.Pull = GPIO_PULLUP;                        /* 上拉 */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;              /* 高速 */
+    HAL_GPIO_Init(KEY2_GPIO_PORT, &gpio_init_struct);           /* KEY2引脚模式设置,上拉输入 */
 }
 
 /**
- * @brief       ɨ躯
- * @note        úӦȼ(ͬʱ¶): WK_UP > KEY2 > KEY1 > KEY0!!
- * @param       mode:0 / 1, 庬:
- *   @arg       0,  ֧(²ʱ, ֻеһεû᷵ؼֵ,
- *                  ɿԺ, ٴΰ²Żֵ᷵)
- *   @arg       1,  ֧(²ʱ, ÿεøú᷵ؼֵ)
- * @retval      ֵ, :
- *              KEY0_PRES, 1, KEY0
- *              KEY1_PRES, 2, KEY1
- *              KEY2_PRES, 3, KEY2
- *              WKUP_PRES, 4, WKUP
+ * @brief       按键扫描函数
+ * @note        该函数有响应优先级(同时按下多个按键): WK_UP > KEY2 > KEY1 > KEY0!!
+ * @param       mode:0 / 1, 具体含义如下:
+ *   @arg       0,  不支持连续按(当按键按下不放时, 只有第一次调用会返回键值,
+ *                  必须松开以后, 再次按下才会返回其他键值)
+ *   @arg       1,  支持连续按(当按键按下不放时, 每次调用该函数都会返回键值)
+ * @retval      键值, 定义如下:
+ *              KEY0_PRES, 1, KEY0按下
+ *              KEY1_PRES, 2, KEY1按下
+ *              KEY2_PRES, 3, KEY2按下
+ *              WKUP_PRES, 4, WKUP按下
  */
 uint8_t key_scan(uint8_t mode)
 {
-    static uint8_t key_up = 1;  /* ɿ־ */
+    static uint8_t key_up = 1;  /* 按键按松开标志 */
     uint8_t keyval = 0;
 
-    if (mode) key_up = 1;       /* ֧ */
+    if (mode) key_up = 1;       /* 支持连按 */
 
-    if (key_up && (KEY0 == 0 || KEY1 == 0 || KEY2 == 0))  /* ɿ־Ϊ1, һ */
+    if (key_up && (KEY0 == 0 || KEY1 == 0 || KEY2 == 0))  /* 按键松开标志为1, 且有任意一个按键按下了 */
     {
-        delay_ms(10);           /* ȥ */
+        delay_ms(10);           /* 去抖动 */
         key_up = 0;
 
         if (KEY0 == 0)  keyval = KEY0_PRES;
@@ -88,12 +88,12 @@ uint8_t key_scan(uint8_t mode)
 
         if (KEY2 == 0)  keyval = KEY2_PRES;
     }
-    else if (KEY0 == 1 && KEY1 == 1 && KEY2 == 1)         /* ûκΰ, ǰɿ */
+    else if (KEY0 == 1 && KEY1 == 1 && KEY2 == 1)         /* 没有任何按键按下, 标记按键松开 */
     {
         key_up = 1;
     }
 
-    return keyval;              /* ؼֵ */
+    return keyval;              /* 返回键值 */
 }
 
 
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        key.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief        
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       按键输入 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -29,33 +29,38 @@
 
 
 /******************************************************************************************/
-/*   */
+/* 引脚 定义 */
 
 #define KEY0_GPIO_PORT                  GPIOE
 #define KEY0_GPIO_PIN                   GPIO_PIN_2
-#define KEY0_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)   /* PEʱʹ */
+#define KEY0_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)   /* PE口时钟使能 */
 
 #define KEY1_GPIO_PORT                  GPIOE
 #define KEY1_GPIO_PIN                   GPIO_PIN_3
-#define KEY1_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)   /* PEʱʹ */
+#define KEY1_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)   /* PE口时钟使能 */
 
 #define KEY2_GPIO_PORT                  GPIOE
 #define KEY2_GPIO_PIN                   GPIO_PIN_4
-#define KEY2_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)   /* PEʱʹ */
+#define KEY2_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)   /* PE口时钟使能 */
 
 /******************************************************************************************/
 
-#define KEY0        HAL_GPIO_ReadPin(KEY0_GPIO_PORT, KEY0_GPIO_PIN)     /* ȡKEY0 */
-#define KEY1        HAL_GPIO_ReadPin(KEY1_GPIO_PORT, KEY1_GPIO_PIN)     /* ȡKEY1 */
-#define KEY2        HAL_GPIO_ReadPin(KEY2_GPIO_PORT, KEY2_GPIO_PIN)     /* ȡKEY2 */
+/* 引脚描述符: 端口, 引脚, 有效电平(按下为低电平) */
+#define KEY0_IO     KEY0_GPIO_PORT, KEY0_GPIO_PIN, 0
+#define KEY1_IO     KEY1_GPIO_PORT, KEY1_GPIO_PIN, 0
+#define KEY2_IO     KEY2_GPIO_PORT, KEY2_GPIO_PIN, 0
 
+#define KEY0        SYS_IO_READ(KEY0_IO)        /* 读取KEY0引脚 */
+#define KEY1        SYS_IO_READ(KEY1_IO)        /* 读取KEY1引脚 */
+#define KEY2        SYS_IO_READ(KEY2_IO)        /* 读取KEY2引脚 */
 
-#define KEY0_PRES    1              /* KEY0 */
-#define KEY1_PRES    2              /* KEY1 */
-#define KEY2_PRES    3              /* KEY2 */
 
-void key_init(void);                /* ʼ */
-uint8_t key_scan(uint8_t mode);     /* ɨ躯 */
+#define KEY0_PRES    1              /* KEY0按下 */
+#define KEY1_PRES    2              /* KEY1按下 */
+#define KEY2_PRES    3              /* KEY2按下 */
+
+void key_init(void);                /* 按键初始化函数 */
+uint8_t key_scan(uint8_t mode);     /* 按键扫描函数 */
 
 #endif
 
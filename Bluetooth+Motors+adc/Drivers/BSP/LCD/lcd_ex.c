@@ -1,28 +1,28 @@
 /**
  ****************************************************************************************************
  * @file        lcd_ex.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.1
  * @date        2023-05-29
- * @brief       lcd_ex.cŸLCDICļĴʼִ,Լlcd.c,.cļ
- *              ֱӼ뵽,ֻlcd.cõ,ͨincludeʽ.(Ҫ
- *              ļٰ.cļ!!ᱨ!)
+ * @brief       lcd_ex.c存放各个LCD驱动IC的寄存器初始化部分代码,以简化lcd.c,该.c文件
+ *              不直接加入到工程里面,只有lcd.c会用到,所以通过include的形式添加.(不要在
+ *              其他文件再包含该.c文件!!否则会报错!)
  * 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211016
- * һη
+ * 第一次发布
  * V1.1 20230529
- * 1ST7796ILI9806 IC֧
+ * 1，新增对ST7796和ILI9806 IC支持
  ****************************************************************************************************
  */
 
@@ -31,9 +31,9 @@
 
 
 /**
- * @brief       ST7789 Ĵʼ
- * @param       
- * @retval      
+ * @brief       ST7789 寄存器初始化代码
+ * @param       无
+ * @retval      无
  */
 void lcd_ex_st7789_reginit(void)
 {
@@ -129,9 +129,9 @@ void lcd_ex_st7789_reginit(void)
 }
 
 /**
- * @brief       ILI9341Ĵʼ
- * @param       
- * @retval      
+ * @brief       ILI9341寄存器初始化代码
+ * @param       无
+ * @retval      无
  */
 void lcd_ex_ili9341_reginit(void)
 {
@@ -231,9 +231,9 @@ void lcd_ex_ili9341_reginit(void)
  
 
 /**
- * @brief       NT35310Ĵʼ 
- * @param       
- * @retval      
+ * @brief       NT35310寄存器初始化代码 
+ * @param       无
+ * @retval      无
  */
 void lcd_ex_nt35310_reginit(void)
 {
@@ -917,9 +917,9 @@ void lcd_ex_nt35310_reginit(void)
 }
 
 /**
- * @brief       ST7796Ĵʼ 
- * @param       
- * @retval      
+ * @brief       ST7796寄存器初始化代码 
+ * @param       无
+ * @retval      无
  */
 void lcd_ex_st7796_reginit(void)
 {
@@ -1021,9 +1021,9 @@ void lcd_ex_st7796_reginit(void)
 }
 
 /**
- * @brief       NT35510Ĵʼ 
- * @param       
- * @retval      
+ * @brief       NT35510寄存器初始化代码 
+ * @param       无
+ * @retval      无
  */
 void lcd_ex_nt35510_reginit(void)
 {
@@ -1440,9 +1440,9 @@ void lcd_ex_nt35510_reginit(void)
 }
 
 /**
- * @brief       ILI9806Ĵʼ 
- * @param       
- * @retval      
+ * @brief       ILI9806寄存器初始化代码 
+ * @param       无
+ * @retval      无
  */
 void lcd_ex_ili9806_reginit(void)
 {
@@ -1608,16 +1608,16 @@ void lcd_ex_ili9806_reginit(void)
 }
 
 /**
- * @brief       SSD1963Ĵʼ 
- * @param       
- * @retval      
+ * @brief       SSD1963寄存器初始化代码 
+ * @param       无
+ * @retval      无
  */
 void lcd_ex_ssd1963_reginit(void)
 {
     lcd_wr_regno(0xE2); /* Set PLL with OSC = 10MHz (hardware),	Multiplier N = 35, 250MHz < VCO < 800MHz = OSC*(N+1), VCO = 300MHz */
-    lcd_wr_data(0x1D);  /* 1 */
-    lcd_wr_data(0x02);  /* 2 Divider M = 2, PLL = 300/(M+1) = 100MHz */
-    lcd_wr_data(0x04);  /* 3 Validate M and N values */
+    lcd_wr_data(0x1D);  /* 参数1 */
+    lcd_wr_data(0x02);  /* 参数2 Divider M = 2, PLL = 300/(M+1) = 100MHz */
+    lcd_wr_data(0x04);  /* 参数3 Validate M and N values */
     delay_us(100);
     lcd_wr_regno(0xE0); /*  Start PLL command */
     lcd_wr_data(0x01);  /*  enable PLL */
@@ -1625,23 +1625,23 @@ void lcd_ex_ssd1963_reginit(void)
     lcd_wr_regno(0xE0); /*  Start PLL command again */
     lcd_wr_data(0x03);  /*  now, use PLL output as system clock */
     delay_ms(12);
-    lcd_wr_regno(0x01); /* λ */
+    lcd_wr_regno(0x01); /* 软复位 */
     delay_ms(10);
 
-    lcd_wr_regno(0xE6); /* Ƶ,33Mhz */
+    lcd_wr_regno(0xE6); /* 设置像素频率,33Mhz */
     lcd_wr_data(0x2F);
     lcd_wr_data(0xFF);
     lcd_wr_data(0xFF);
 
-    lcd_wr_regno(0xB0); /* LCDģʽ */
-    lcd_wr_data(0x20);  /* 24λģʽ */
-    lcd_wr_data(0x00);  /* TFT ģʽ */
+    lcd_wr_regno(0xB0); /* 设置LCD模式 */
+    lcd_wr_data(0x20);  /* 24位模式 */
+    lcd_wr_data(0x00);  /* TFT 模式 */
 
-    lcd_wr_data((SSD_HOR_RESOLUTION - 1) >> 8); /* LCDˮƽ */
+    lcd_wr_data((SSD_HOR_RESOLUTION - 1) >> 8); /* 设置LCD水平像素 */
     lcd_wr_data(SSD_HOR_RESOLUTION - 1);
-    lcd_wr_data((SSD_VER_RESOLUTION - 1) >> 8); /* LCDֱ */
+    lcd_wr_data((SSD_VER_RESOLUTION - 1) >> 8); /* 设置LCD垂直像素 */
     lcd_wr_data(SSD_VER_RESOLUTION - 1);
-    lcd_wr_data(0x00);  /* RGB */
+    lcd_wr_data(0x00);  /* RGB序列 */
 
     lcd_wr_regno(0xB4); /* Set horizontal period */
     lcd_wr_data((SSD_HT - 1) >> 8);
@@ -1661,27 +1661,27 @@ void lcd_ex_ssd1963_reginit(void)
     lcd_wr_data(0x00);
     lcd_wr_data(0x00);
 
-    lcd_wr_regno(0xF0); /* SSD1963CPUӿΪ16bit */
+    lcd_wr_regno(0xF0); /* 设置SSD1963与CPU接口为16bit */
     lcd_wr_data(0x03);  /* 16-bit(565 format) data for 16bpp */
 
-    lcd_wr_regno(0x29); /* ʾ */
-    /* PWM  ͨռձȿɵ */
-    lcd_wr_regno(0xD0); /* ԶƽDBC */
+    lcd_wr_regno(0x29); /* 开启显示 */
+    /* 设置PWM输出  背光通过占空比可调 */
+    lcd_wr_regno(0xD0); /* 设置自动白平衡DBC */
     lcd_wr_data(0x00);  /* disable */
 
-    lcd_wr_regno(0xBE); /* PWM */
-    lcd_wr_data(0x05);  /* 1PWMƵ */
-    lcd_wr_data(0xFE);  /* 2PWMռձ */
-    lcd_wr_data(0x01);  /* 3C */
-    lcd_wr_data(0x00);  /* 4D */
-    lcd_wr_data(0x00);  /* 5E */
-    lcd_wr_data(0x00);  /* 6F */
-
-    lcd_wr_regno(0xB8); /* GPIO */
-    lcd_wr_data(0x03);  /* 2IOó */
-    lcd_wr_data(0x01);  /* GPIOʹIO */
+    lcd_wr_regno(0xBE); /* 配置PWM输出 */
+    lcd_wr_data(0x05);  /* 1设置PWM频率 */
+    lcd_wr_data(0xFE);  /* 2设置PWM占空比 */
+    lcd_wr_data(0x01);  /* 3设置C */
+    lcd_wr_data(0x00);  /* 4设置D */
+    lcd_wr_data(0x00);  /* 5设置E */
+    lcd_wr_data(0x00);  /* 6设置F */
+
+    lcd_wr_regno(0xB8); /* 设置GPIO配置 */
+    lcd_wr_data(0x03);  /* 2个IO口设置成输出 */
+    lcd_wr_data(0x01);  /* GPIO使用正常的IO功能 */
     lcd_wr_regno(0xBA);
-    lcd_wr_data(0x01);  /* GPIO[1:0]=01,LCD */
+    lcd_wr_data(0x01);  /* GPIO[1:0]=01,控制LCD方向 */
 }
 
 
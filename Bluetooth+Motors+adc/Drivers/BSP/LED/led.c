@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        led.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief       LED 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       LED 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -26,26 +26,76 @@
 
 
 /**
- * @brief       ʼLEDIO, ʹʱ
- * @param       
- * @retval      
+ * @brief       初始化LED相关IO口, 并使能时钟
+ * @param       无
+ * @retval      无
  */
 void led_init(void)
 {
     GPIO_InitTypeDef gpio_init_struct;
     
-    LED0_GPIO_CLK_ENABLE();                                 /* LED0ʱʹ */
-    LED1_GPIO_CLK_ENABLE();                                 /* LED1ʱʹ */
+    LED0_GPIO_CLK_ENABLE();                                 /* LED0时钟使能 */
+    LED1_GPIO_CLK_ENABLE();                                 /* LED1时钟使能 */
 
-    gpio_init_struct.Pin = LED0_GPIO_PIN;                   /* LED0 */
-    gpio_init_struct.Mode = GPIO_MODE_OUTPUT_PP;            /*  */
-    gpio_init_struct.Pull = GPIO_PULLUP;                    /*  */
-    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;          /*  */
-    HAL_GPIO_Init(LED0_GPIO_PORT, &gpio_init_struct);       /* ʼLED0 */
+    gpio_init_struct.Pin = LED0_GPIO_PIN;                   /* LED0引脚 */
+    gpio_init_struct.Mode = GPIO_MODE_OUTPUT_PP;            /* 推挽输出 */
+    gpio_init_struct.Pull = GPIO_PULLUP;                    /* 上拉 */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;          /* 高速 */
+    HAL_GPIO_Init(LED0_GPIO_PORT, &gpio_init_struct);       /* 初始化LED0引脚 */
 
-    gpio_init_struct.Pin = LED1_GPIO_PIN;                   /* LED1 */
-    HAL_GPIO_Init(LED1_GPIO_PORT, &gpio_init_struct);       /* ʼLED1 */
+    gpio_init_struct.Pin = LED1_GPIO_PIN;                   /* LED1引脚 */
+    HAL_GPIO_Init(LED1_GPIO_PORT, &gpio_init_struct);       /* 初始化LED1引脚 */
     
-    LED0(1);                                                /* ر LED0 */
-    LED1(1);                                                /* ر LED1 */
+    LED0(1);                                                /* 关闭 LED0 */
+    LED1(1);                                                /* 关闭 LED1 */
+}
+
+/**
+ * @brief       引脚写操作耗时测试
+ * @note        用DWT周期计数器测量在LED1上交替写LED_BENCH_LOOPS次的耗时, 测试期间关闭中断,
+ *              可以通过USMART调用; 结果包含循环本身的开销, 用mode 2的结果扣除
+ * @param       mode: 0, HAL_GPIO_WritePin(); 1, SYS_IO_WRITE()直写BSRR; 2, 空循环
+ * @retval      平均每次的CPU周期数
+ */
+uint32_t led_io_bench(uint8_t mode)
+{
+    uint32_t i;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t primask;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;         /* 使能DWT */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                    /* 开启周期计数 */
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    start = DWT->CYCCNT;
+
+    if (mode == 0)
+    {
+        for (i = 0; i < LED_BENCH_LOOPS; i++)
+        {
+            HAL_GPIO_WritePin(LED1_GPIO_PORT, LED1_GPIO_PIN, (i & 1) ? GPIO_PIN_SET : GPIO_PIN_RESET);
+        }
+    }
+    else if (mode == 1)
+    {
+        for (i = 0; i < LED_BENCH_LOOPS; i++)
+        {
+            LED1(i & 1);
+        }
+    }
+    else
+    {
+        for (i = 0; i < LED_BENCH_LOOPS; i++)
+        {
+            __NOP();
+        }
+    }
+
+    cycles = DWT->CYCCNT - start;
+    __set_PRIMASK(primask);
+    LED1(1);                                                /* 关闭 LED1 */
+
+    return cycles / LED_BENCH_LOOPS;
 }
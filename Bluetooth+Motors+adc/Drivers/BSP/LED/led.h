@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        led.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief       LED 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       LED 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -29,35 +29,35 @@
 
 
 /******************************************************************************************/
-/*   */
+/* 引脚 定义 */
 
 #define LED0_GPIO_PORT                  GPIOE
 #define LED0_GPIO_PIN                   GPIO_PIN_0
-#define LED0_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)             /* PFʱʹ */
+#define LED0_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)             /* PF口时钟使能 */
 
 #define LED1_GPIO_PORT                  GPIOE
 #define LED1_GPIO_PIN                   GPIO_PIN_1
-#define LED1_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)             /* PFʱʹ */
+#define LED1_GPIO_CLK_ENABLE()          do{ __HAL_RCC_GPIOE_CLK_ENABLE(); }while(0)             /* PF口时钟使能 */
 
 /******************************************************************************************/
 
-/* LED˿ڶ */
-#define LED0(x)   do{ x ? \
-                      HAL_GPIO_WritePin(LED0_GPIO_PORT, LED0_GPIO_PIN, GPIO_PIN_SET) : \
-                      HAL_GPIO_WritePin(LED0_GPIO_PORT, LED0_GPIO_PIN, GPIO_PIN_RESET); \
-                  }while(0)       /* LED0 = RED */
+/* 引脚描述符: 端口, 引脚, 有效电平(低电平点亮) */
+#define LED0_IO         LED0_GPIO_PORT, LED0_GPIO_PIN, 0
+#define LED1_IO         LED1_GPIO_PORT, LED1_GPIO_PIN, 0
 
-#define LED1(x)   do{ x ? \
-                      HAL_GPIO_WritePin(LED1_GPIO_PORT, LED1_GPIO_PIN, GPIO_PIN_SET) : \
-                      HAL_GPIO_WritePin(LED1_GPIO_PORT, LED1_GPIO_PIN, GPIO_PIN_RESET); \
-                  }while(0)       /* LED1 = GREEN */
+/* LED端口定义 */
+#define LED0(x)   do{ SYS_IO_WRITE(LED0_IO, x); }while(0)       /* LED0 = RED */
+#define LED1(x)   do{ SYS_IO_WRITE(LED1_IO, x); }while(0)       /* LED1 = GREEN */
 
-/* LEDȡ */
-#define LED0_TOGGLE()    do{ HAL_GPIO_TogglePin(LED0_GPIO_PORT, LED0_GPIO_PIN); }while(0)       /* LED0 = !LED0 */
-#define LED1_TOGGLE()    do{ HAL_GPIO_TogglePin(LED1_GPIO_PORT, LED1_GPIO_PIN); }while(0)       /* LED1 = !LED1 */
+/* LED取反定义 */
+#define LED0_TOGGLE()    do{ SYS_IO_TOGGLE(LED0_IO); }while(0)  /* LED0 = !LED0 */
+#define LED1_TOGGLE()    do{ SYS_IO_TOGGLE(LED1_IO); }while(0)  /* LED1 = !LED1 */
+
+#define LED_BENCH_LOOPS  1000                                   /* 耗时测试的写入次数 */
 
 /******************************************************************************************/
-/* ⲿӿں*/
-void led_init(void);                                                                            /* ʼ */
+/* 外部接口函数*/
+void led_init(void);                                                                            /* 初始化 */
+uint32_t led_io_bench(uint8_t mode);                                                            /* 引脚写操作耗时测试 */
 
 #endif
@@ -0,0 +1,647 @@
+/**
+ ****************************************************************************************************
+ * @file        macro.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       命令宏 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/MACRO/macro.h"
+#include "./BSP/ATK_MW579/atk_mw579_uart.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./BSP/STEPPER_MOTOR/stepper_unit.h"
+#include "./BSP/STEPPER_MOTOR/stepper_home.h"
+#include "./BSP/ESTOP/estop.h"
+#include <string.h>
+#include <stdlib.h>
+
+
+/* 控制步骤, 序号为macro_ctrl()的返回值 - 1 */
+#define MACRO_OP_NONE           0               /* 不是控制步骤, 按命令执行 */
+#define MACRO_OP_DELAY          1
+#define MACRO_OP_WAIT           2
+#define MACRO_OP_UNTIL          3
+#define MACRO_OP_LOOP           4
+#define MACRO_OP_END            5
+#define MACRO_OP_BAD            0xFF            /* 控制步骤的参数错误 */
+
+static const struct
+{
+    const char *verb;
+    uint8_t min;                                /* 最少参数数 */
+    uint8_t max;                                /* 最多参数数 */
+} g_macro_ctrl[] =
+{
+    {"delay", 1, 1},
+    {"wait",  0, 1},
+    {"until", 2, 3},
+    {"loop",  1, 1},
+    {"end",   0, 0},
+};
+
+/* 不能出现在宏中的命令: 定义和执行宏 */
+static const char *const g_macro_forbid[] = {"mdef", "madd", "mrun", "mdel", NULL};
+
+macro_t g_macro[MACRO_NUM];
+macro_sta_t g_macro_sta;
+
+static macro_t g_macro_tmp;                     /* 定义宏时先在这里组装, 全部检查通过才替换 */
+
+/**
+ * @brief       解析控制步骤
+ * @param       text: 步骤文本
+ * @param       arg : 参数
+ * @param       argc: 参数个数
+ * @retval      MACRO_OP_xxx
+ */
+static uint8_t macro_ctrl(const char *text, int32_t *arg, uint8_t *argc)
+{
+    const char *p = text;
+    char *end;
+    uint8_t len = 0;
+    uint8_t op;
+
+    while (*p == ' ')
+    {
+        p++;
+    }
+
+    while ((p[len] != '\0') && (p[len] != ' '))
+    {
+        len++;
+    }
+
+    for (op = 0; op < sizeof(g_macro_ctrl) / sizeof(g_macro_ctrl[0]); op++)
+    {
+        if ((strlen(g_macro_ctrl[op].verb) == len) && (strncmp(g_macro_ctrl[op].verb, p, len) == 0))
+        {
+            break;
+        }
+    }
+
+    if (op == sizeof(g_macro_ctrl) / sizeof(g_macro_ctrl[0]))
+    {
+        return MACRO_OP_NONE;
+    }
+
+    p += len;
+    *argc = 0;
+    while (1)
+    {
+        while (*p == ' ')
+        {
+            p++;
+        }
+
+        if (*p == '\0')
+        {
+            break;
+        }
+
+        if (*argc >= g_macro_ctrl[op].max)
+        {
+            return MACRO_OP_BAD;
+        }
+
+        arg[*argc] = strtol(p, &end, 0);
+        if ((end == p) || ((*end != ' ') && (*end != '\0')) || (arg[*argc] < 0))
+        {
+            return MACRO_OP_BAD;
+        }
+        (*argc)++;
+        p = end;
+    }
+
+    if (*argc < g_macro_ctrl[op].min)
+    {
+        return MACRO_OP_BAD;
+    }
+
+    op++;
+    if ((op == MACRO_OP_UNTIL) && ((arg[0] < STEPPER_MOTOR_1) || (arg[0] > STEPPER_MOTOR_4)))
+    {
+        return MACRO_OP_BAD;
+    }
+
+    if ((op == MACRO_OP_LOOP) && ((arg[0] == 0) || (arg[0] > 0xFFFF)))
+    {
+        return MACRO_OP_BAD;
+    }
+
+    return op;
+}
+
+/**
+ * @brief       按名称查找宏
+ * @param       name: 名称
+ * @retval      序号, 没有时返回MACRO_NUM
+ */
+static uint8_t macro_find(const char *name)
+{
+    uint8_t i;
+
+    for (i = 0; i < MACRO_NUM; i++)
+    {
+        if ((g_macro[i].name[0] != '\0') && (strcmp(g_macro[i].name, name) == 0))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/**
+ * @brief       检查一个步骤并加入宏
+ * @param       m    : 宏
+ * @param       text : 步骤文本, 已去掉首尾空格
+ * @param       len  : 文本长度
+ * @param       depth: 当前loop嵌套层数, 返回时更新
+ * @retval      MACRO_EOK   : 已加入
+ *              MACRO_EINVAL: 步骤错误
+ *              MACRO_EFULL : 步骤数或文本长度超出
+ */
+static uint8_t macro_add_step(macro_t *m, const char *text, uint16_t len, uint8_t *depth)
+{
+    char buf[MACRO_STEP_SIZE];
+    int32_t arg[3];
+    uint8_t argc;
+    uint8_t i;
+
+    if (len >= MACRO_STEP_SIZE)
+    {
+        return MACRO_EINVAL;
+    }
+
+    if ((m->steps >= MACRO_STEP_NUM) || (m->len + len + 1 > MACRO_TEXT_SIZE))
+    {
+        return MACRO_EFULL;
+    }
+
+    memcpy(buf, text, len);
+    buf[len] = '\0';
+
+    switch (macro_ctrl(buf, arg, &argc))
+    {
+        case MACRO_OP_NONE:
+            for (i = 0; g_macro_forbid[i] != NULL; i++)
+            {
+                if ((strncmp(buf, g_macro_forbid[i], strlen(g_macro_forbid[i])) == 0) &&
+                    ((buf[strlen(g_macro_forbid[i])] == ' ') || (buf[strlen(g_macro_forbid[i])] == '\0')))
+                {
+                    return MACRO_EINVAL;
+                }
+            }
+
+            if (cmd_check(buf) != CMD_EOK)  /* 会修改buf, 之后从text复制 */
+            {
+                return MACRO_EINVAL;
+            }
+            break;
+
+        case MACRO_OP_LOOP:
+            if (*depth >= MACRO_LOOP_DEPTH)
+            {
+                return MACRO_EINVAL;
+            }
+            (*depth)++;
+            break;
+
+        case MACRO_OP_END:
+            if (*depth == 0)
+            {
+                return MACRO_EINVAL;
+            }
+            (*depth)--;
+            break;
+
+        case MACRO_OP_BAD:
+            return MACRO_EINVAL;
+
+        default:
+            break;
+    }
+
+    m->step[m->steps++] = m->len;
+    memcpy(&m->text[m->len], text, len);
+    m->len += len;
+    m->text[m->len++] = '\0';
+    return MACRO_EOK;
+}
+
+/**
+ * @brief       计算宏结尾处的loop嵌套层数
+ * @param       m: 宏
+ * @retval      层数, 0表示loop和end成对
+ */
+static uint8_t macro_depth(const macro_t *m)
+{
+    int32_t arg[3];
+    uint8_t argc;
+    uint8_t depth = 0;
+    uint8_t i;
+
+    for (i = 0; i < m->steps; i++)
+    {
+        switch (macro_ctrl(&m->text[m->step[i]], arg, &argc))
+        {
+            case MACRO_OP_LOOP:
+                depth++;
+                break;
+
+            case MACRO_OP_END:
+                depth--;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return depth;
+}
+
+/**
+ * @brief       定义或追加宏
+ * @note        任何一步出错时宏保持原样
+ * @param       name  : 名称
+ * @param       steps : 以MACRO_STEP_SEP分隔的步骤
+ * @param       append: 0: 定义(替换同名的宏); 1: 追加到已有的宏
+ * @param       count : 成功时为宏的步骤数, 出错时为出错步骤的序号
+ * @retval      MACRO_EOK   : 成功
+ *              MACRO_EINVAL: 名称或步骤错误
+ *              MACRO_EFULL : 宏数、步骤数或文本长度超出
+ *              MACRO_ENOENT: 追加时没有该宏
+ *              MACRO_EBUSY : 该宏正在执行
+ */
+uint8_t macro_define(const char *name, const char *steps, uint8_t append, uint8_t *count)
+{
+    const char *p = steps;
+    const char *q;
+    uint16_t len;
+    uint8_t depth;
+    uint8_t slot;
+    uint8_t ret;
+
+    *count = 0;
+    if ((strlen(name) == 0) || (strlen(name) > MACRO_NAME_MAX))
+    {
+        return MACRO_EINVAL;
+    }
+
+    slot = macro_find(name);
+    if ((slot < MACRO_NUM) && g_macro_sta.running && (g_macro_sta.cur == slot))
+    {
+        return MACRO_EBUSY;
+    }
+
+    if (append)
+    {
+        if (slot == MACRO_NUM)
+        {
+            return MACRO_ENOENT;
+        }
+
+        memcpy(&g_macro_tmp, &g_macro[slot], sizeof(macro_t));
+        depth = macro_depth(&g_macro_tmp);
+    }
+    else
+    {
+        if (slot == MACRO_NUM)
+        {
+            slot = 0;
+            while ((slot < MACRO_NUM) && (g_macro[slot].name[0] != '\0'))     /* 找空槽 */
+            {
+                slot++;
+            }
+
+            if (slot == MACRO_NUM)
+            {
+                return MACRO_EFULL;
+            }
+        }
+
+        memset(&g_macro_tmp, 0, sizeof(macro_t));
+        strcpy(g_macro_tmp.name, name);
+        depth = 0;
+    }
+
+    while (*p != '\0')
+    {
+        while ((*p == ' ') || (*p == MACRO_STEP_SEP))
+        {
+            p++;
+        }
+
+        if (*p == '\0')
+        {
+            break;
+        }
+
+        q = strchr(p, MACRO_STEP_SEP);
+        len = (q != NULL) ? (uint16_t)(q - p) : (uint16_t)strlen(p);
+        while ((len > 0) && (p[len - 1] == ' '))
+        {
+            len--;
+        }
+
+        *count = g_macro_tmp.steps;
+        ret = macro_add_step(&g_macro_tmp, p, len, &depth);
+        if (ret != MACRO_EOK)
+        {
+            return ret;
+        }
+
+        p += len;
+    }
+
+    memcpy(&g_macro[slot], &g_macro_tmp, sizeof(macro_t));
+    *count = g_macro[slot].steps;
+    return MACRO_EOK;
+}
+
+/**
+ * @brief       删除宏
+ * @param       name: 名称
+ * @retval      MACRO_EOK: 成功; MACRO_ENOENT: 没有该宏; MACRO_EBUSY: 正在执行
+ */
+uint8_t macro_delete(const char *name)
+{
+    uint8_t slot = macro_find(name);
+
+    if (slot == MACRO_NUM)
+    {
+        return MACRO_ENOENT;
+    }
+
+    if (g_macro_sta.running && (g_macro_sta.cur == slot))
+    {
+        return MACRO_EBUSY;
+    }
+
+    g_macro[slot].name[0] = '\0';
+    return MACRO_EOK;
+}
+
+/**
+ * @brief       开始执行宏, 上报"mbegin:"事件
+ * @param       name  : 名称
+ * @param       repeat: 执行次数, 0为一直重复直到中止
+ * @retval      MACRO_EOK   : 已开始
+ *              MACRO_ENOENT: 没有该宏
+ *              MACRO_EBUSY : 已有宏在执行
+ *              MACRO_EINVAL: 宏为空或loop和end不成对
+ */
+uint8_t macro_run(const char *name, uint32_t repeat)
+{
+    uint8_t slot = macro_find(name);
+
+    if (slot == MACRO_NUM)
+    {
+        return MACRO_ENOENT;
+    }
+
+    if (g_macro_sta.running)
+    {
+        return MACRO_EBUSY;
+    }
+
+    if ((g_macro[slot].steps == 0) || (macro_depth(&g_macro[slot]) != 0))
+    {
+        return MACRO_EINVAL;
+    }
+
+    g_macro_sta.cur = slot;
+    g_macro_sta.pc = 0;
+    g_macro_sta.repeat = repeat;
+    g_macro_sta.depth = 0;
+    g_macro_sta.wait = MACRO_OP_NONE;
+    g_macro_sta.abort = 0;
+    g_macro_sta.execs = 0;
+    g_macro_sta.start = HAL_GetTick();
+    g_macro_sta.runs++;
+    g_macro_sta.running = 1;
+
+    atk_mw579_uart_printf("mbegin:%s,%lu\r\n", g_macro[slot].name, repeat);
+    return MACRO_EOK;
+}
+
+/**
+ * @brief       中止正在执行的宏, 由下一次macro_poll()结束
+ * @note        可在接收中断中调用; 宏自己的步骤(如stop)在主循环中调用时不中止,
+ *              中断中调用(上位机的stop/mstop)总是中止, 即使正好有步骤在执行(如阻塞的home)
+ * @param       无
+ * @retval      无
+ */
+void macro_abort(void)
+{
+    if (g_macro_sta.running && ((g_macro_sta.stepping == 0) || (__get_IPSR() != 0)))
+    {
+        g_macro_sta.abort = 1;
+    }
+}
+
+/**
+ * @brief       结束宏, 异常结束时执行MACRO_FAIL_CMD, 上报"mend:"事件
+ * @param       result: MACRO_Exxx
+ * @param       ret   : 失败步骤的返回值, 其他情况为0
+ * @retval      无
+ */
+static void macro_finish(uint8_t result, uint8_t ret)
+{
+    char buf[sizeof(MACRO_FAIL_CMD)];
+    uint8_t status;
+
+    g_macro_sta.running = 0;
+    g_macro_sta.wait = MACRO_OP_NONE;
+
+    if (result != MACRO_EOK)
+    {
+        g_macro_sta.fails++;
+        strcpy(buf, MACRO_FAIL_CMD);
+        g_macro_sta.stepping = 1;
+        cmd_call(buf, &status);
+        g_macro_sta.stepping = 0;
+    }
+
+    atk_mw579_uart_printf("mend:%s,%d,%d,%d,%lu,%lu\r\n", g_macro[g_macro_sta.cur].name, result, g_macro_sta.pc,
+                          ret, g_macro_sta.execs, HAL_GetTick() - g_macro_sta.start);
+}
+
+/**
+ * @brief       检查等待中的控制步骤
+ * @param       无
+ * @retval      MACRO_EOK: 等待结束; MACRO_EBUSY: 继续等待; MACRO_ETIMEOUT: 超时
+ */
+static uint8_t macro_wait_check(void)
+{
+    uint32_t elapsed = HAL_GetTick() - g_macro_sta.wait_start;
+    uint8_t i;
+
+    switch (g_macro_sta.wait)
+    {
+        case MACRO_OP_DELAY:
+            return (elapsed >= g_macro_sta.wait_ms) ? MACRO_EOK : MACRO_EBUSY;
+
+        case MACRO_OP_WAIT:
+            for (i = STEPPER_MOTOR_1; i <= STEPPER_MOTOR_4; i++)
+            {
+                if (stepper_is_running(i) || stepper_home_busy())   /* 回零各阶段之间电机会短暂停止 */
+                {
+                    return (elapsed >= g_macro_sta.wait_ms) ? MACRO_ETIMEOUT : MACRO_EBUSY;
+                }
+            }
+            return MACRO_EOK;
+
+        case MACRO_OP_UNTIL:
+            if (abs(stepper_get_pos_um(g_macro_sta.wait_motor) - g_macro_sta.wait_from) >= g_macro_sta.wait_dist)
+            {
+                return MACRO_EOK;
+            }
+
+            if (stepper_is_running(g_macro_sta.wait_motor) == 0)
+            {
+                return MACRO_ETIMEOUT;          /* 轴在到达之前停了(限位、丢步或被停止), 不必等到超时 */
+            }
+            return (elapsed >= g_macro_sta.wait_ms) ? MACRO_ETIMEOUT : MACRO_EBUSY;
+
+        default:
+            return MACRO_EOK;
+    }
+}
+
+/**
+ * @brief       推进正在执行的宏, 在主循环中调用
+ * @note        每次最多执行MACRO_BURST个步骤, 遇到等待步骤时返回; 等待的分辨率取决于调用间隔
+ * @param       无
+ * @retval      1: 宏执行中; 0: 没有宏在执行
+ */
+uint8_t macro_poll(void)
+{
+    macro_t *m = &g_macro[g_macro_sta.cur];
+    char buf[MACRO_STEP_SIZE];
+    int32_t arg[3];
+    uint8_t argc;
+    uint8_t op;
+    uint8_t ret;
+    uint8_t res;
+    uint8_t n;
+
+    if (g_macro_sta.running == 0)
+    {
+        return 0;
+    }
+
+    if (g_macro_sta.abort || estop_is_latched())
+    {
+        macro_finish(MACRO_EABORT, 0);
+        return 0;
+    }
+
+    if (g_macro_sta.wait != MACRO_OP_NONE)
+    {
+        res = macro_wait_check();
+        if (res == MACRO_EBUSY)
+        {
+            return 1;
+        }
+
+        if (res != MACRO_EOK)
+        {
+            macro_finish(res, 0);
+            return 0;
+        }
+
+        g_macro_sta.wait = MACRO_OP_NONE;
+        g_macro_sta.pc++;
+    }
+
+    for (n = 0; n < MACRO_BURST; n++)
+    {
+        if (g_macro_sta.pc >= m->steps)
+        {
+            if ((g_macro_sta.repeat != 0) && (--g_macro_sta.repeat == 0))
+            {
+                macro_finish(MACRO_EOK, 0);
+                return 0;
+            }
+
+            g_macro_sta.pc = 0;
+            g_macro_sta.depth = 0;
+        }
+
+        strcpy(buf, &m->text[m->step[g_macro_sta.pc]]);
+        op = macro_ctrl(buf, arg, &argc);
+        g_macro_sta.execs++;
+
+        switch (op)
+        {
+            case MACRO_OP_DELAY:
+            case MACRO_OP_WAIT:
+            case MACRO_OP_UNTIL:
+                g_macro_sta.wait = op;
+                g_macro_sta.wait_start = HAL_GetTick();
+                if (op == MACRO_OP_DELAY)
+                {
+                    g_macro_sta.wait_ms = arg[0];
+                }
+                else if (op == MACRO_OP_WAIT)
+                {
+                    g_macro_sta.wait_ms = (argc > 0) ? arg[0] : MACRO_WAIT_MS;
+                }
+                else
+                {
+                    g_macro_sta.wait_motor = arg[0];
+                    g_macro_sta.wait_dist = arg[1];
+                    g_macro_sta.wait_from = stepper_get_pos_um(arg[0]);
+                    g_macro_sta.wait_ms = (argc > 2) ? arg[2] : MACRO_WAIT_MS;
+                }
+                return 1;                       /* 下一次调用时检查, 让主循环先处理刚开始的运动 */
+
+            case MACRO_OP_LOOP:
+                g_macro_sta.loop[g_macro_sta.depth].start = g_macro_sta.pc + 1;
+                g_macro_sta.loop[g_macro_sta.depth].left = arg[0];
+                g_macro_sta.depth++;
+                g_macro_sta.pc++;
+                break;
+
+            case MACRO_OP_END:
+                if (--g_macro_sta.loop[g_macro_sta.depth - 1].left > 0)
+                {
+                    g_macro_sta.pc = g_macro_sta.loop[g_macro_sta.depth - 1].start;
+                }
+                else
+                {
+                    g_macro_sta.depth--;
+                    g_macro_sta.pc++;
+                }
+                break;
+
+            default:
+                g_macro_sta.stepping = 1;
+                res = cmd_call(buf, &ret);
+                g_macro_sta.stepping = 0;
+
+                if ((res != CMD_EOK) || ((ret != 0) && (ret != CMD_NOREPLY)))
+                {
+                    macro_finish(MACRO_ESTEP, (res != CMD_EOK) ? res : ret);
+                    return 0;
+                }
+                g_macro_sta.pc++;
+                break;
+        }
+    }
+
+    return 1;
+}
@@ -0,0 +1,117 @@
+/**
+ ****************************************************************************************************
+ * @file        macro.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       命令宏 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 上位机把一串已有的命令存成宏, 之后一条"mrun"就由设备按自己的时序执行, 每一步不再等一次蓝牙往返.
+ * 宏保存在RAM中, 复位后丢失, 上位机连接时重新上传.
+ *
+ * 定义: "mdef <名称> <步骤>|<步骤>|...", 同名的宏被替换; 一帧放不下时用"madd <名称> <步骤>|..."追加.
+ * 保存时逐步检查动词和参数, 应答"mdef:<结果>,<步骤数>", 出错时步骤数为出错步骤的序号.
+ * 步骤可以是任何已注册的命令(宏命令本身除外), 以及下列只在宏中使用的控制步骤:
+ *   delay <ms>                     等待
+ *   wait [超时ms]                  等待所有轴停止, 包括回零(home)结束
+ *   until <电机> <距离um> [超时ms] 等待该轴离开本步开始时的位置至少这么远(不分方向)
+ *   loop <次数>  ...  end          重复其间的步骤, 最多嵌套MACRO_LOOP_DEPTH层
+ * 例: 下探20mm, 停留0.5秒, 回撤到起点
+ *   mdef dip start|until 1 20000 60000|stop|delay 500|return|wait 60000
+ *
+ * 执行: "mrun <名称> [次数]", 次数省略为1, 0为一直重复直到mstop. 同一时间只执行一个宏.
+ * 每一步的命令照常应答; 步骤返回非0(CMD_NOREPLY除外)、等待超时、"stop"/"mstop"命令或急停都会
+ * 结束宏, 异常结束时执行MACRO_FAIL_CMD让探头停下. 开始和结束各上报一个事件:
+ *   mbegin:<名称>,<次数>
+ *   mend:<名称>,<结果>,<步骤序号>,<步骤返回值>,<已执行步骤数>,<用时ms>
+ * 结果为MACRO_Exxx, 步骤序号为结束时所在的步骤(正常结束时为步骤数).
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __MACRO_H
+#define __MACRO_H
+
+#include "./SYSTEM/sys/sys.h"
+#include "./BSP/CMD/cmd.h"
+
+/******************************************************************************************/
+/* 配置 */
+
+#define MACRO_NUM               4               /* 最多保存的宏数 */
+#define MACRO_NAME_MAX          CMD_VERB_MAX    /* 名称最大长度 */
+#define MACRO_TEXT_SIZE         256             /* 每个宏的步骤文本总长 */
+#define MACRO_STEP_NUM          32              /* 每个宏最多步骤数 */
+#define MACRO_STEP_SIZE         64              /* 单个步骤最大长度(含结束符) */
+#define MACRO_LOOP_DEPTH        3               /* loop最多嵌套层数 */
+#define MACRO_WAIT_MS           60000           /* wait/until省略超时时的超时时间, 单位: ms */
+#define MACRO_BURST             8               /* 每次macro_poll()最多执行的步骤数, 避免空循环占住主循环 */
+#define MACRO_POLL_MS           5               /* 宏执行中主循环推进宏的间隔, 单位: ms */
+#define MACRO_FAIL_CMD          "stop"          /* 宏异常结束时执行的命令 */
+#define MACRO_STEP_SEP          '|'             /* 步骤分隔符(';'已用于分隔一帧中的命令) */
+
+/* 错误代码 */
+#define MACRO_EOK               0               /* 没有错误 */
+#define MACRO_EINVAL            1               /* 名称、步骤或参数错误 */
+#define MACRO_EFULL             2               /* 宏数、步骤数或文本长度超出 */
+#define MACRO_ENOENT            3               /* 没有该宏 */
+#define MACRO_EBUSY             4               /* 宏正在执行 */
+#define MACRO_ESTEP             5               /* 步骤执行失败 */
+#define MACRO_ETIMEOUT          6               /* 等待超时 */
+#define MACRO_EABORT            7               /* 被stop/mstop或急停中止 */
+
+typedef struct
+{
+    char name[MACRO_NAME_MAX + 1];              /* 名称, 空串表示空槽 */
+    char text[MACRO_TEXT_SIZE];                 /* 各步骤文本, 以'\0'分隔 */
+    uint16_t len;                               /* text已用长度 */
+    uint16_t step[MACRO_STEP_NUM];              /* 各步骤在text中的偏移 */
+    uint8_t steps;                              /* 步骤数 */
+} macro_t;
+
+typedef struct
+{
+    uint8_t running;                            /* 1: 宏执行中 */
+    uint8_t cur;                                /* 正在执行的宏 */
+    uint8_t pc;                                 /* 下一个步骤的序号 */
+    uint32_t repeat;                            /* 整个宏还要执行的次数, 0为一直重复 */
+    uint8_t depth;                              /* loop嵌套层数 */
+    struct
+    {
+        uint8_t start;                          /* 循环体第一个步骤的序号 */
+        uint16_t left;                          /* 剩余次数 */
+    } loop[MACRO_LOOP_DEPTH];
+    uint8_t wait;                               /* 正在等待的控制步骤, 0为不等待 */
+    uint8_t wait_motor;                         /* until的电机 */
+    int32_t wait_from;                          /* until开始时的位置, 单位: um */
+    int32_t wait_dist;                          /* until的距离, 单位: um */
+    uint32_t wait_start;                        /* 等待开始时刻, 单位: ms */
+    uint32_t wait_ms;                           /* 等待时间或超时时间, 单位: ms */
+    volatile uint8_t abort;                     /* 1: 请求中止, 可由接收中断写入 */
+    volatile uint8_t stepping;                  /* 1: 正在执行宏的步骤, 此时主循环中的stop不中止宏 */
+    uint32_t start;                             /* 开始时刻, 单位: ms */
+    uint32_t execs;                             /* 本次已执行的步骤数 */
+    uint32_t runs;                              /* 累计执行次数 */
+    uint32_t fails;                             /* 累计异常结束次数 */
+} macro_sta_t;
+
+extern macro_t g_macro[MACRO_NUM];
+extern macro_sta_t g_macro_sta;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+uint8_t macro_define(const char *name, const char *steps, uint8_t append, uint8_t *count);  /* 定义或追加宏 */
+uint8_t macro_delete(const char *name);                                 /* 删除宏 */
+uint8_t macro_run(const char *name, uint32_t repeat);                   /* 开始执行宏 */
+void macro_abort(void);                                                 /* 中止正在执行的宏, 可在中断中调用 */
+uint8_t macro_poll(void);                                               /* 推进正在执行的宏, 在主循环中调用 */
+
+#endif
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        rtc.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-16
- * @brief       RTC 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       RTC 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211016
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -28,38 +28,38 @@
 #include "./SYSTEM/delay/delay.h"
 
 
-RTC_HandleTypeDef g_rtc_handle;  /* RTC */
+RTC_HandleTypeDef g_rtc_handle;  /* RTC句柄 */
 
 /**
- * @brief       RTCдSRAM
- * @param       bkrx : Ĵ,Χ:0~31
- * @param       data : Ҫд,32λ
- * @retval      
+ * @brief       RTC写入后备区域SRAM
+ * @param       bkrx : 后备区寄存器编号,范围:0~31
+ * @param       data : 要写入的数据,32位长度
+ * @retval      无
  */
 void rtc_write_bkr(uint32_t bkrx, uint32_t data)
 {
-    HAL_PWR_EnableBkUpAccess();     /* ȡд */
+    HAL_PWR_EnableBkUpAccess();     /* 取消备份区写保护 */
     HAL_RTCEx_BKUPWrite(&g_rtc_handle, bkrx, data);
 }
 
 /**
- * @brief       RTCȡSRAM
- * @param       bkrx : Ĵ,Χ:0~31 
- * @retval      ȡֵ
+ * @brief       RTC读取后备区域SRAM
+ * @param       bkrx : 后备区寄存器编号,范围:0~31 
+ * @retval      读取到的值
  */
 uint32_t rtc_read_bkr(uint32_t bkrx)
 {
     uint32_t temp = 0;
     temp = RTC_BASE + 0x50 + bkrx * 4;
-    return (*(uint32_t *)temp); /* ضȡֵ */
+    return (*(uint32_t *)temp); /* 返回读取到的值 */
 }
 
 /**
- * @brief       RTCʱ
- * @param       hour,min,sec: Сʱ,, 
+ * @brief       RTC时间设置
+ * @param       hour,min,sec: 小时,分钟,秒钟 
  * @param       ampm        : AM/PM, 0=AM/24H; 1=PM/12H;
- * @retval      0,ɹ
- *              1,ʼģʽʧ
+ * @retval      0,成功
+ *              1,进入初始化模式失败
  */
 HAL_StatusTypeDef rtc_set_time(uint8_t hour, uint8_t min, uint8_t sec, uint8_t ampm)
 {
@@ -75,11 +75,11 @@ HAL_StatusTypeDef rtc_set_time(uint8_t hour, uint8_t min, uint8_t sec, uint8_t a
 }
 
 /**
- * @brief       RTC
- * @param       year,month,date : (0~99),(1~12),(0~31)
- * @param       week            : (1~7,0,Ƿ!)
- * @retval      0,ɹ
- *              1,ʼģʽʧ
+ * @brief       RTC日期设置
+ * @param       year,month,date : 年(0~99),月(1~12),日(0~31)
+ * @param       week            : 星期(1~7,0,非法!)
+ * @retval      0,成功
+ *              1,进入初始化模式失败
  */
 HAL_StatusTypeDef rtc_set_date(uint8_t year, uint8_t month, uint8_t date, uint8_t week)
 {
@@ -93,10 +93,10 @@ HAL_StatusTypeDef rtc_set_date(uint8_t year, uint8_t month, uint8_t date, uint8_
 }
 
 /**
- * @brief       ȡRTCʱ
- * @param       *hour,*min,*sec : Сʱ,,
+ * @brief       获取RTC时间
+ * @param       *hour,*min,*sec : 小时,分钟,秒钟
  * @param       *ampm           : AM/PM,0=AM/24H,1=PM.
- * @retval      
+ * @retval      无
  */
 void rtc_get_time(uint8_t *hour, uint8_t *min, uint8_t *sec, uint8_t *ampm)
 {
@@ -111,10 +111,10 @@ void rtc_get_time(uint8_t *hour, uint8_t *min, uint8_t *sec, uint8_t *ampm)
 }
 
 /**
- * @brief       ȡRTC
- * @param       *year,*mon,*date: ,,
- * @param       *week           : 
- * @retval      
+ * @brief       获取RTC日期
+ * @param       *year,*mon,*date: 年,月,日
+ * @param       *week           : 星期
+ * @retval      无
  */
 void rtc_get_date(uint8_t *year, uint8_t *month, uint8_t *date, uint8_t *week)
 {
@@ -128,13 +128,13 @@ void rtc_get_date(uint8_t *year, uint8_t *month, uint8_t *date, uint8_t *week)
     *week = rtc_date_handle.WeekDay;
 }
 
-/* ݱ */
+/* 月修正数据表 */
 uint8_t const table_week[12] = {0, 3, 3, 6, 1, 4, 6, 2, 5, 0, 3, 5};
 
 /**
- * @breif       ڼ, 빫ڵõ(ֻ1901-2099)
- * @param       year,month,day
- * @retval      ں(1~7,1~)
+ * @breif       获得现在是星期几, 输入公历日期得到星期(只允许1901-2099年)
+ * @param       year,month,day：公历年月日
+ * @retval      星期号(1~7,代表周1~周日)
  */
 uint8_t rtc_get_week(uint16_t year, uint8_t month, uint8_t day)
 {
@@ -144,13 +144,13 @@ uint8_t rtc_get_week(uint16_t year, uint8_t month, uint8_t day)
     yearH = year / 100;
     yearL = year % 100;
 
-    /*  Ϊ21,100 */
+    /*  如果为21世纪,年份数加100 */
     if (yearH > 19)
     {
         yearL += 100;
     }
 
-    /*  ֻ1900֮ */
+    /*  所过闰年数只算1900年之后的 */
     temp = yearL + yearL / 4;
     temp = temp % 7;
     temp = temp + day + table_week[month - 1];
@@ -170,43 +170,43 @@ uint8_t rtc_get_week(uint16_t year, uint8_t month, uint8_t day)
     return temp;
 }
 /**
- * @brief       RTCʼ
- * @param       
- * @retval      0,ɹ
- *              1,ʼģʽʧ
+ * @brief       RTC初始化
+ * @param       无
+ * @retval      0,成功
+ *              1,进入初始化模式失败
  */
 uint8_t rtc_init(void)
 {
     uint16_t bkpflag = 0;
     g_rtc_handle.Instance = RTC;
-    g_rtc_handle.Init.HourFormat = RTC_HOURFORMAT_24;   /* RTCΪ24Сʱʽ */
-    g_rtc_handle.Init.AsynchPrediv = 0x7F;              /* RTC첽Ƶϵ(1~0x7F) */
-    g_rtc_handle.Init.SynchPrediv = 0xFF;               /* RTCͬƵϵ(0~0x7FFF) */
+    g_rtc_handle.Init.HourFormat = RTC_HOURFORMAT_24;   /* RTC设置为24小时格式 */
+    g_rtc_handle.Init.AsynchPrediv = 0x7F;              /* RTC异步分频系数(1~0x7F) */
+    g_rtc_handle.Init.SynchPrediv = 0xFF;               /* RTC同步分频系数(0~0x7FFF) */
     g_rtc_handle.Init.OutPut = RTC_OUTPUT_DISABLE;     
     g_rtc_handle.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
     g_rtc_handle.Init.OutPutType = RTC_OUTPUT_TYPE_OPENDRAIN;
 
-    /* ǲǵһʱ */
-    bkpflag = rtc_read_bkr(RTC_BKP_DR0);                /* ȡBKP0ֵ */
+    /* 检查是不是第一次配置时钟 */
+    bkpflag = rtc_read_bkr(RTC_BKP_DR0);                /* 读取BKP0的值 */
 
     if (HAL_RTC_Init(&g_rtc_handle) != HAL_OK)
     {
         return 1;
     }
       
-    if ((bkpflag != 0x5050) && (bkpflag != 0x5051))     /* ֮ǰδʼ,  */
+    if ((bkpflag != 0x5050) && (bkpflag != 0x5051))     /* 之前未初始化过, 重新配置 */
     {
-        rtc_set_time(23, 59, 56, RTC_HOURFORMAT12_AM);  /* ʱ, ʵʱ޸ */
-        rtc_set_date(20, 1, 13, 7);                     /*  */
+        rtc_set_time(23, 59, 56, RTC_HOURFORMAT12_AM);  /* 设置时间, 根据实际时间修改 */
+        rtc_set_date(20, 1, 13, 7);                     /* 设置日期 */
     }
     return 0;
 }
 
 /**
- * @brief       RTCײʱ
- * @param       hrtc:RTC
- * @note        ˺ᱻHAL_RTC_Init()
- * @retval      
+ * @brief       RTC底层驱动，时钟配置
+ * @param       hrtc:RTC句柄
+ * @note        此函数会被HAL_RTC_Init()调用
+ * @retval      无
  */
 void HAL_RTC_MspInit(RTC_HandleTypeDef* hrtc)
 {
@@ -215,75 +215,75 @@ void HAL_RTC_MspInit(RTC_HandleTypeDef* hrtc)
     RCC_OscInitTypeDef rcc_osc_init_handle;
     RCC_PeriphCLKInitTypeDef rcc_periphclk_init_handle;
 
-    __HAL_RCC_RTC_ENABLE();     /* RTCʹ */
-    HAL_PWR_EnableBkUpAccess(); /* ȡд */
-    __HAL_RCC_PWR_CLK_ENABLE(); /* ʹܵԴʱPWR */
+    __HAL_RCC_RTC_ENABLE();     /* RTC使能 */
+    HAL_PWR_EnableBkUpAccess(); /* 取消备份区域写保护 */
+    __HAL_RCC_PWR_CLK_ENABLE(); /* 使能电源时钟PWR */
 
-    /* ʹüĴķʽȥLSEǷ */
-    RCC->BDCR |= 1 << 0;        /* ԿLSE */
+    /* 使用寄存器的方式去检测LSE是否可以正常工作 */
+    RCC->BDCR |= 1 << 0;        /* 尝试开启LSE */
 
-    while (retry && ((RCC->BDCR & 0x02) == 0))  /* ȴLSE׼ */
+    while (retry && ((RCC->BDCR & 0x02) == 0))  /* 等待LSE准备好 */
     {
         retry--;
         delay_ms(5);
     }
 
-    if (retry == 0)     /* LSEʧ ʹLSI */
+    if (retry == 0)     /* LSE起振失败 使用LSI */
     {
-        rcc_osc_init_handle.OscillatorType = RCC_OSCILLATORTYPE_LSI;        /* ѡҪõ */
-        rcc_osc_init_handle.PLL.PLLState = RCC_PLL_NONE;                    /* PLL */
-        rcc_osc_init_handle.LSIState = RCC_LSI_ON;                          /* LSI״̬: */
-        HAL_RCC_OscConfig(&rcc_osc_init_handle);                            /* õrcc_oscinitstruct */
-
-        rcc_periphclk_init_handle.PeriphClockSelection = RCC_PERIPHCLK_RTC; /* ѡҪ RTC */
-        rcc_periphclk_init_handle.RTCClockSelection = RCC_RTCCLKSOURCE_LSI; /* RTCʱԴѡLSI */
-        HAL_RCCEx_PeriphCLKConfig(&rcc_periphclk_init_handle);              /* õrcc_periphclkinitstruct */
+        rcc_osc_init_handle.OscillatorType = RCC_OSCILLATORTYPE_LSI;        /* 选择要配置的振荡器 */
+        rcc_osc_init_handle.PLL.PLLState = RCC_PLL_NONE;                    /* PLL不配置 */
+        rcc_osc_init_handle.LSIState = RCC_LSI_ON;                          /* LSI状态:开启 */
+        HAL_RCC_OscConfig(&rcc_osc_init_handle);                            /* 配置设置的rcc_oscinitstruct */
+
+        rcc_periphclk_init_handle.PeriphClockSelection = RCC_PERIPHCLK_RTC; /* 选择要配置外设 RTC */
+        rcc_periphclk_init_handle.RTCClockSelection = RCC_RTCCLKSOURCE_LSI; /* RTC时钟源选择LSI */
+        HAL_RCCEx_PeriphCLKConfig(&rcc_periphclk_init_handle);              /* 配置设置的rcc_periphclkinitstruct */
         rtc_write_bkr(0, 0x5051);
     }
     else
     {
-        rcc_osc_init_handle.OscillatorType = RCC_OSCILLATORTYPE_LSE;        /* ѡҪõ */
-        rcc_osc_init_handle.PLL.PLLState = RCC_PLL_NONE;                    /* PLL */
-        rcc_osc_init_handle.LSEState = RCC_LSE_ON;                          /* LSE״̬: */
-        HAL_RCC_OscConfig(&rcc_osc_init_handle);                            /* õrcc_oscinitstruct */
-
-        rcc_periphclk_init_handle.PeriphClockSelection = RCC_PERIPHCLK_RTC; /* ѡҪRTC */
-        rcc_periphclk_init_handle.RTCClockSelection = RCC_RTCCLKSOURCE_LSE; /* RTCʱԴѡLSE */
-        HAL_RCCEx_PeriphCLKConfig(&rcc_periphclk_init_handle);              /* õrcc_periphclkinitstruct */
+        rcc_osc_init_handle.OscillatorType = RCC_OSCILLATORTYPE_LSE;        /* 选择要配置的振荡器 */
+        rcc_osc_init_handle.PLL.PLLState = RCC_PLL_NONE;                    /* PLL不配置 */
+        rcc_osc_init_handle.LSEState = RCC_LSE_ON;                          /* LSE状态:开启 */
+        HAL_RCC_OscConfig(&rcc_osc_init_handle);                            /* 配置设置的rcc_oscinitstruct */
+
+        rcc_periphclk_init_handle.PeriphClockSelection = RCC_PERIPHCLK_RTC; /* 选择要配置外设RTC */
+        rcc_periphclk_init_handle.RTCClockSelection = RCC_RTCCLKSOURCE_LSE; /* RTC时钟源选择LSE */
+        HAL_RCCEx_PeriphCLKConfig(&rcc_periphclk_init_handle);              /* 配置设置的rcc_periphclkinitstruct */
         rtc_write_bkr(0, 0x5050);
     }
     
-    __HAL_RCC_RTC_ENABLE(); /* RTCʹ */
+    __HAL_RCC_RTC_ENABLE(); /* RTC使能 */
 }
 
 /**
- * @breif       ʱ(,24Сʱ)
- * @param       week        : ڼ(1~7) 
- * @param       hour,min,sec: Сʱ,,
- * @retval      
+ * @breif       设置闹钟时间(按星期闹铃,24小时制)
+ * @param       week        : 星期几(1~7) 
+ * @param       hour,min,sec: 小时,分钟,秒钟
+ * @retval      无
  */
 void rtc_set_alarma(uint8_t week, uint8_t hour, uint8_t min, uint8_t sec)
 {
     RTC_AlarmTypeDef rtc_alarm_handle;
     
-    rtc_alarm_handle.AlarmTime.Hours = hour;    /* Сʱ */
-    rtc_alarm_handle.AlarmTime.Minutes = min;   /*  */
-    rtc_alarm_handle.AlarmTime.Seconds = sec;   /*  */
+    rtc_alarm_handle.AlarmTime.Hours = hour;    /* 小时 */
+    rtc_alarm_handle.AlarmTime.Minutes = min;   /* 分钟 */
+    rtc_alarm_handle.AlarmTime.Seconds = sec;   /* 秒 */
     rtc_alarm_handle.AlarmTime.SubSeconds = 0;
     rtc_alarm_handle.AlarmTime.TimeFormat = RTC_HOURFORMAT12_AM;
     
-    rtc_alarm_handle.AlarmMask = RTC_ALARMMASK_NONE;    /* ȷƥڣʱ */
+    rtc_alarm_handle.AlarmMask = RTC_ALARMMASK_NONE;    /* 精确匹配星期，时分秒 */
     rtc_alarm_handle.AlarmSubSecondMask = RTC_ALARMSUBSECONDMASK_NONE;
-    rtc_alarm_handle.AlarmDateWeekDaySel = RTC_ALARMDATEWEEKDAYSEL_WEEKDAY; /*  */
-    rtc_alarm_handle.AlarmDateWeekDay = week;   /*  */
-    rtc_alarm_handle.Alarm = RTC_ALARM_A;       /* A */
+    rtc_alarm_handle.AlarmDateWeekDaySel = RTC_ALARMDATEWEEKDAYSEL_WEEKDAY; /* 按星期 */
+    rtc_alarm_handle.AlarmDateWeekDay = week;   /* 星期 */
+    rtc_alarm_handle.Alarm = RTC_ALARM_A;       /* 闹钟A */
     HAL_RTC_SetAlarm_IT(&g_rtc_handle, &rtc_alarm_handle, RTC_FORMAT_BIN);
     
-    HAL_NVIC_SetPriority(RTC_Alarm_IRQn, 1, 2); /* ռȼ1,ȼ2 */
+    HAL_NVIC_SetPriority(RTC_Alarm_IRQn, 1, 2); /* 抢占优先级1,子优先级2 */
     HAL_NVIC_EnableIRQ(RTC_Alarm_IRQn);
 }
 /**
- * @breif       ԻѶʱ
+ * @breif       周期性唤醒定时器设置
  * @param       wksel
  *   @arg       RTC_WAKEUPCLOCK_RTCCLK_DIV16        ((uint32_t)0x00000000)
  *   @arg       RTC_WAKEUPCLOCK_RTCCLK_DIV8         ((uint32_t)0x00000001)
@@ -292,24 +292,24 @@ void rtc_set_alarma(uint8_t week, uint8_t hour, uint8_t min, uint8_t sec)
  *   @arg       RTC_WAKEUPCLOCK_CK_SPRE_16BITS      ((uint32_t)0x00000004)
  *   @arg       RTC_WAKEUPCLOCK_CK_SPRE_17BITS      ((uint32_t)0x00000006)
  * @note        000,RTC/16;001,RTC/8;010,RTC/4;011,RTC/2;
- * @note        ע:RTCRTCʱƵ,RTCCLK!
- * @param       cnt: Զװֵ.0,ж.
- * @retval      
+ * @note        注意:RTC就是RTC的时钟频率,即RTCCLK!
+ * @param       cnt: 自动重装载值.减到0,产生中断.
+ * @retval      无
  */
 void rtc_set_wakeup(uint8_t wksel, uint16_t cnt)
 { 
-    __HAL_RTC_WAKEUPTIMER_CLEAR_FLAG(&g_rtc_handle, RTC_FLAG_WUTF);  /* RTC WAKE UPı־ */
+    __HAL_RTC_WAKEUPTIMER_CLEAR_FLAG(&g_rtc_handle, RTC_FLAG_WUTF);  /* 清除RTC WAKE UP的标志 */
 
-    HAL_RTCEx_SetWakeUpTimer_IT(&g_rtc_handle, cnt, wksel);          /* װֵʱ */
+    HAL_RTCEx_SetWakeUpTimer_IT(&g_rtc_handle, cnt, wksel);          /* 设置重装载值和时钟 */
 
-    HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 2, 2);                       /* ռȼ2,ȼ2 */
+    HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 2, 2);                       /* 抢占优先级2,子优先级2 */
     HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
 }
 
 /**
- * @breif       RTCжϷ
- * @param       
- * @retval      
+ * @breif       RTC闹钟中断服务函数
+ * @param       无
+ * @retval      无
  */
 void RTC_Alarm_IRQHandler(void)
 {
@@ -317,9 +317,9 @@ void RTC_Alarm_IRQHandler(void)
 }
 
 /**
- * @breif       RTCAжϴص
- * @param       hrtc:RTC
- * @retval      
+ * @breif       RTC闹钟A中断处理回调函数
+ * @param       hrtc:RTC句柄
+ * @retval      无
  */
 void HAL_RTC_AlarmAEventCallback(RTC_HandleTypeDef *hrtc)
 {
@@ -327,9 +327,9 @@ void HAL_RTC_AlarmAEventCallback(RTC_HandleTypeDef *hrtc)
 }
 
 /**
- * @breif       RTC WAKE UPжϷ
- * @param       
- * @retval      
+ * @breif       RTC WAKE UP中断服务函数
+ * @param       无
+ * @retval      无
  */
 void RTC_WKUP_IRQHandler(void)
 {
@@ -337,9 +337,9 @@ void RTC_WKUP_IRQHandler(void)
 }
 
 /**
- * @breif       RTC WAKE UPжϴص
- * @param       hrtc : RTC
- * @retval      
+ * @breif       RTC WAKE UP中断处理处理回调函数
+ * @param       hrtc : RTC句柄
+ * @retval      无
  */
 void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc)
 {
@@ -1,36 +1,61 @@
 /**
  ****************************************************************************************************
  * @file        steering_engine.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief       PWMģʽ 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       舵机 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
 #include "./BSP/STEERING_ENGINE/steering_engine.h"
-#include "./BSP/TIMER/atim.h"
+#include "./BSP/TIMER/servo_tim.h"
 
 /***************************************************************************************************/
-extern TIM_HandleTypeDef g_atimx_pwm_chy_handle;      /* ʱx */
+
+servo_axis_t g_servo_axis[SERVO_NUM];                       /* 各舵机轨迹状态 */
+
+/* 舵机编号(1~3)对应的定时器通道 */
+static const uint32_t g_servo_channel[SERVO_NUM] = {TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3};
+
+/**
+ * @brief       舵机初始化
+ * @note        各通道在第一次设置角度时才开启输出, 上电时舵机不会被拉到中位
+ * @param       无
+ * @retval      无
+ */
+void servo_init(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < SERVO_NUM; i++)
+    {
+        g_servo_axis[i].frames = 0;
+        g_servo_axis[i].frame = 0;
+        g_servo_axis[i].pulse = 1500;
+        g_servo_axis[i].enabled = 0;
+    }
+
+    gtim_timx_servo_init();
+}
 
 /**
- * @brief       Ƕתʱװֵ
- * @param       angle:Ƕ
- * @retval      ʱװֵ
+ * @brief       舵机角度转定时器装载值
+ * @param       angle:角度
+ * @retval      定时器装载值
  */
 uint16_t angle_to_tim_val(float angle)
 {
@@ -41,7 +66,7 @@ uint16_t angle_to_tim_val(float angle)
     }
     else
     {
-        ret = 1500 + (int)((float)((angle - 90.0) * 100 / 9));      /* 0 -- 50045 -- 100090 -- 1500135 -- 2000180 -- 2500 */
+        ret = 1500 + (int)((float)((angle - 90.0) * 100 / 9));      /* 0° -- 500，45° -- 1000，90° -- 1500，135° -- 2000，180° -- 2500 */
         if((ret < 500)||(ret > 2500))
         {
             ret = 0;
@@ -51,38 +76,151 @@ uint16_t angle_to_tim_val(float angle)
 }
 
 /**
- * @brief       Ƕ趨
- * @param       id:ŶӦĽӿڣ1~3; angle:Ƕ
- * @retval      0:ɹ
+ * @brief       开启通道输出
+ * @note        第一次输出前舵机位置未知, 直接输出目标脉宽
+ * @param       index: 舵机下标, 0~2
+ * @param       val  : 脉宽, 单位: us
+ * @retval      无
+ */
+static void servo_enable(uint8_t index, uint16_t val)
+{
+    g_servo_axis[index].pulse = val;
+    __HAL_TIM_SET_COMPARE(&g_timx_servo_handle, g_servo_channel[index], val);
+    HAL_TIM_PWM_Start(&g_timx_servo_handle, g_servo_channel[index]);
+    g_servo_axis[index].enabled = 1;
+}
+
+/**
+ * @brief       舵机角度设定, 立即到位
+ * @note        会中止该舵机正在进行的轨迹
+ * @param       id:舵机编号对应舵机的接口：1~3; angle:角度
+ * @retval      SERVO_EOK   : 成功
+ *              SERVO_EINVAL: 参数错误
  */
 uint8_t servo_angle_set(uint8_t id,float angle)
 {
     uint16_t val;
-    switch(id)
+
+    if ((id < 1) || (id > SERVO_NUM))
+    {
+        return SERVO_EINVAL;
+    }
+
+    val = angle_to_tim_val(angle);                          /* 得到角度转换的比较值 */
+    if (val == 0)
+    {
+        return SERVO_EINVAL;
+    }
+
+    g_servo_axis[id - 1].frames = 0;                        /* 先停止轨迹, 中断不再改写比较值 */
+
+    if (g_servo_axis[id - 1].enabled == 0)
+    {
+        servo_enable(id - 1, val);
+    }
+    else
+    {
+        g_servo_axis[id - 1].pulse = val;
+        __HAL_TIM_SET_COMPARE(&g_timx_servo_handle, g_servo_channel[id - 1], val);    /* 设置比较值 */
+    }
+
+    return SERVO_EOK;
+}
+
+/**
+ * @brief       按最小加加速度轨迹运动到指定角度
+ * @note        立即返回, 轨迹在定时器更新中断中按50Hz逐帧计算; 起点为当前输出脉宽,
+ *              运动中再次调用会从当前位置开始新的轨迹. 通道尚未输出时直接到位
+ * @param       id   : 舵机编号, 1~3
+ * @param       angle: 目标角度, 0~180
+ * @param       ms   : 运动时间, 单位: ms, 小于一帧时直接到位
+ * @retval      SERVO_EOK   : 成功
+ *              SERVO_EINVAL: 参数错误
+ */
+uint8_t servo_move(uint8_t id, float angle, uint16_t ms)
+{
+    servo_axis_t *axis;
+    uint16_t val;
+    uint16_t frames;
+
+    if ((id < 1) || (id > SERVO_NUM))
+    {
+        return SERVO_EINVAL;
+    }
+
+    val = angle_to_tim_val(angle);
+    frames = ms / SERVO_FRAME_MS;
+    axis = &g_servo_axis[id - 1];
+
+    if ((val == 0) || (frames == 0) || (axis->enabled == 0))
+    {
+        return servo_angle_set(id, angle);
+    }
+
+    axis->frames = 0;                                       /* 先停止轨迹, 再修改参数 */
+    axis->start = axis->pulse;
+    axis->delta = (float)val - axis->pulse;
+    axis->inv = 1.0f / frames;
+    axis->frame = 0;
+    axis->frames = frames;                                  /* 最后写入, 中断从下一帧开始执行 */
+
+    return SERVO_EOK;
+}
+
+/**
+ * @brief       舵机是否在运动
+ * @param       id: 舵机编号, 1~3
+ * @retval      0: 静止; 1: 运动中
+ */
+uint8_t servo_is_busy(uint8_t id)
+{
+    if ((id < 1) || (id > SERVO_NUM))
     {
-        case 1:
-            val = angle_to_tim_val(angle);  /* õǶתıȽֵ */
-            if(val != 0)
-            {
-                __HAL_TIM_SetCompare(&g_atimx_pwm_chy_handle,TIM_CHANNEL_1,val);    /* ñȽֵ */
-            }
-            break;
-        case 2:
-            val = angle_to_tim_val(angle);
-            if(val != 0)
-            {
-                __HAL_TIM_SetCompare(&g_atimx_pwm_chy_handle,TIM_CHANNEL_2,val);
-            }
-            break;
-        case 3:
-            val = angle_to_tim_val(angle);
-            if(val != 0)
-            {
-                __HAL_TIM_SetCompare(&g_atimx_pwm_chy_handle,TIM_CHANNEL_3,val);
-            }
-            break;
-        default:
-            break;
+        return 0;
+    }
+
+    return (g_servo_axis[id - 1].frames != 0) ? 1 : 0;
+}
+
+/**
+ * @brief       舵机定时器更新中断服务函数
+ * @note        每20ms进入一次, 计算各舵机轨迹的下一帧; 比较值带预装载,
+ *              新脉宽在下一个PWM周期开始时生效, 不会产生毛刺
+ * @param       无
+ * @retval      无
+ */
+void GTIM_TIMX_SERVO_IRQHandler(void)
+{
+    uint8_t i;
+    float t, s;
+    servo_axis_t *axis;
+
+    if (__HAL_TIM_GET_FLAG(&g_timx_servo_handle, TIM_FLAG_UPDATE) == RESET)
+    {
+        return;
+    }
+    __HAL_TIM_CLEAR_IT(&g_timx_servo_handle, TIM_IT_UPDATE);
+
+    for (i = 0; i < SERVO_NUM; i++)
+    {
+        axis = &g_servo_axis[i];
+        if (axis->frames == 0)
+        {
+            continue;
+        }
+
+        if (++axis->frame >= axis->frames)                  /* 最后一帧直接到终点, 消除舍入误差 */
+        {
+            axis->pulse = (uint16_t)(axis->start + axis->delta + 0.5f);
+            axis->frames = 0;
+        }
+        else
+        {
+            t = axis->frame * axis->inv;
+            s = t * t * t * (10.0f + t * (-15.0f + t * 6.0f));
+            axis->pulse = (uint16_t)(axis->start + axis->delta * s + 0.5f);
+        }
+
+        __HAL_TIM_SET_COMPARE(&g_timx_servo_handle, g_servo_channel[i], axis->pulse);
     }
-    return 0;
 }
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        steering_engine.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief        
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       舵机 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ STM32F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 STM32F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -28,7 +28,36 @@
 
 
 /******************************************************************************************/
-/* ⲿӿں*/
-uint16_t angle_to_tim_val(float angle);                     /* ǶתȽֵ */
-uint8_t servo_angle_set(uint8_t id,float angle);            /* ýǶ */
+/* 舵机参数定义 */
+
+#define SERVO_NUM           3               /* 舵机数量, 对应定时器通道1~3 */
+#define SERVO_FRAME_MS      20              /* 轨迹更新周期, 与PWM周期相同(50Hz) */
+
+/* 错误代码 */
+#define SERVO_EOK           0               /* 没有错误 */
+#define SERVO_EINVAL        1               /* 参数错误 */
+
+/* 舵机轨迹状态, 由定时器更新中断维护
+ * 最小加加速度轨迹: p(t) = p0 + (p1 - p0) * (10t^3 - 15t^4 + 6t^5), t = frame / frames
+ */
+typedef struct
+{
+    float start;                            /* 起点脉宽, 单位: us */
+    float delta;                            /* 终点与起点之差, 单位: us */
+    float inv;                              /* 1 / frames, 启动时计算 */
+    volatile uint16_t frame;                /* 已运行的帧数 */
+    volatile uint16_t frames;               /* 总帧数, 0表示静止 */
+    volatile uint16_t pulse;                /* 当前输出脉宽, 单位: us */
+    uint8_t enabled;                        /* 通道已开启输出 */
+} servo_axis_t;
+
+extern servo_axis_t g_servo_axis[SERVO_NUM];
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void servo_init(void);                                      /* 舵机初始化 */
+uint16_t angle_to_tim_val(float angle);                     /* 角度转比较值 */
+uint8_t servo_angle_set(uint8_t id,float angle);            /* 设置角度, 立即到位 */
+uint8_t servo_move(uint8_t id, float angle, uint16_t ms);   /* 按最小加加速度轨迹运动到指定角度, 不阻塞 */
+uint8_t servo_is_busy(uint8_t id);                          /* 舵机是否在运动 */
 #endif
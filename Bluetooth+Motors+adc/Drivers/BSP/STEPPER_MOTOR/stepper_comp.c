@@ -0,0 +1,150 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_comp.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机反向间隙及丝杠螺距误差补偿
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/STEPPER_MOTOR/stepper_comp.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./BSP/STEPPER_MOTOR/stepper_unit.h"
+
+
+/* 螺距误差表, 单位: um, 第i项对应位置(i << STEPPER_COMP_PITCH_SHIFT)步, 第0项为原点
+ * 实际位置 = 指令位置 - 误差, 即表中为正表示丝杠走得不够, 需要多走
+ * 只有一项时不做螺距补偿
+ */
+static const int16_t g_pitch_um_axis1[] = {0};
+static const int16_t g_pitch_um_axis2[] = {0};
+static const int16_t g_pitch_um_axis3[] = {0};
+static const int16_t g_pitch_um_axis4[] = {0};
+
+static const int16_t *const g_pitch_um[STEPPER_AXIS_NUM] = {g_pitch_um_axis1, g_pitch_um_axis2, g_pitch_um_axis3, g_pitch_um_axis4};
+static const uint8_t g_pitch_um_len[STEPPER_AXIS_NUM] =
+{
+    sizeof(g_pitch_um_axis1) / sizeof(g_pitch_um_axis1[0]),
+    sizeof(g_pitch_um_axis2) / sizeof(g_pitch_um_axis2[0]),
+    sizeof(g_pitch_um_axis3) / sizeof(g_pitch_um_axis3[0]),
+    sizeof(g_pitch_um_axis4) / sizeof(g_pitch_um_axis4[0]),
+};
+
+static const uint16_t g_backlash_um[STEPPER_AXIS_NUM] =
+{
+    STEPPER_COMP_AXIS1_BACKLASH_UM, STEPPER_COMP_AXIS2_BACKLASH_UM,
+    STEPPER_COMP_AXIS3_BACKLASH_UM, STEPPER_COMP_AXIS4_BACKLASH_UM,
+};
+
+static stepper_comp_t g_stepper_comp[STEPPER_AXIS_NUM];     /* 各轴补偿参数, 单位已换算为步 */
+
+/**
+ * @brief       由编译期参数生成补偿表
+ * @note        在stepper_init()中调用, 微米到步的换算(含乘法和移位)都在这里完成
+ * @param       无
+ * @retval      无
+ */
+void stepper_comp_init(void)
+{
+    uint8_t i, j;
+    uint8_t len;
+
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        g_stepper_comp[i].backlash = (uint16_t)stepper_um_to_steps(i + 1, g_backlash_um[i]);
+
+        len = g_pitch_um_len[i];
+        if (len > STEPPER_COMP_PITCH_LEN)
+        {
+            len = STEPPER_COMP_PITCH_LEN;
+        }
+
+        for (j = 0; j < len; j++)                                  /* um -> 步(Q8) */
+        {
+            g_stepper_comp[i].pitch[j] = (int32_t)(((int64_t)g_pitch_um[i][j] * g_stepper_unit[i].steps_per_um) >> (STEPPER_UNIT_Q - 8));
+        }
+
+        g_stepper_comp[i].pitch_len = (len >= 2) ? len : 0;         /* 至少两点才能插值 */
+    }
+}
+
+/**
+ * @brief       获取反向间隙
+ * @param       index: 轴下标, 0~3
+ * @retval      反向间隙, 单位: 步
+ */
+uint16_t stepper_comp_backlash(uint8_t index)
+{
+    return g_stepper_comp[index].backlash;
+}
+
+/**
+ * @brief       计算位置pos处的螺距补偿量
+ * @note        在TIM8更新中断中每走一步调用一次, 表间隔为2的幂,
+ *              下标和插值系数都由移位得到, 没有除法; 超出表范围时取端点值
+ * @param       index: 轴下标, 0~3
+ * @param       pos  : 逻辑位置, 单位: 步
+ * @retval      需要额外输出的步数
+ */
+int32_t stepper_comp_pitch(uint8_t index, int32_t pos)
+{
+    const stepper_comp_t *c = &g_stepper_comp[index];
+    uint32_t k;
+    int32_t frac;
+    int32_t q8;
+
+    if (c->pitch_len == 0)
+    {
+        return 0;
+    }
+
+    if (pos <= 0)
+    {
+        q8 = c->pitch[0];
+    }
+    else
+    {
+        k = (uint32_t)pos >> STEPPER_COMP_PITCH_SHIFT;
+        if (k >= (uint32_t)(c->pitch_len - 1))
+        {
+            q8 = c->pitch[c->pitch_len - 1];
+        }
+        else
+        {
+            frac = pos & ((1 << STEPPER_COMP_PITCH_SHIFT) - 1);
+            q8 = c->pitch[k] + (((c->pitch[k + 1] - c->pitch[k]) * frac) >> STEPPER_COMP_PITCH_SHIFT);
+        }
+    }
+
+    return (q8 + 128) >> 8;                                         /* Q8 -> 步, 四舍五入 */
+}
+
+/**
+ * @brief       设置反向间隙
+ * @note        用于现场标定, 下一次换向时生效, 掉电后恢复为编译期参数
+ * @param       motor_num: 步进电机接口序号
+ * @param       um       : 反向间隙, 单位: um
+ * @retval      无
+ */
+void stepper_comp_set_backlash(uint8_t motor_num, uint32_t um)
+{
+    int32_t steps;
+
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return;
+    }
+
+    steps = stepper_um_to_steps(motor_num, (int32_t)um);
+    g_stepper_comp[motor_num - 1].backlash = (steps > 0xFFFF) ? 0xFFFF : (uint16_t)steps;
+}
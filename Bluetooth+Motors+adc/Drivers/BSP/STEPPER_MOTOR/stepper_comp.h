@@ -0,0 +1,59 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_comp.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机反向间隙及丝杠螺距误差补偿
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 1, 反向间隙: 运动方向改变时先多走backlash步, 这些脉冲不计入逻辑位置
+ * 2, 螺距误差: 按固定间隔(2^shift步)给出的误差表, 在步进中断中线性插值,
+ *    误差每变化1步就插入一个补偿脉冲或让一个脉冲前进两步
+ * 误差表在编译时以微米给出, stepper_comp_init()中换算为Q8定点步数,
+ * 中断中的插值只用乘法和移位. 螺距补偿只在轴已回零时生效.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STEPPER_COMP_H
+#define __STEPPER_COMP_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 补偿参数定义, 请按实测结果修改 */
+
+/* 反向间隙, 单位: um */
+#define STEPPER_COMP_AXIS1_BACKLASH_UM      0
+#define STEPPER_COMP_AXIS2_BACKLASH_UM      0
+#define STEPPER_COMP_AXIS3_BACKLASH_UM      0
+#define STEPPER_COMP_AXIS4_BACKLASH_UM      0
+
+/* 螺距误差表间隔 = 2^SHIFT 步, 14即16384步(贯入轴约51mm) */
+#define STEPPER_COMP_PITCH_SHIFT            14
+#define STEPPER_COMP_PITCH_LEN              16      /* 每轴误差表最大点数 */
+
+/* 单轴补偿参数(运行时) */
+typedef struct
+{
+    uint16_t backlash;                              /* 反向间隙, 单位: 步 */
+    uint8_t pitch_len;                              /* 误差表点数, 0表示不做螺距补偿 */
+    int32_t pitch[STEPPER_COMP_PITCH_LEN];          /* 误差表, 单位: 步, Q8 */
+} stepper_comp_t;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void stepper_comp_init(void);                                           /* 由编译期参数生成补偿表 */
+uint16_t stepper_comp_backlash(uint8_t index);                          /* 获取反向间隙, 单位: 步 */
+int32_t stepper_comp_pitch(uint8_t index, int32_t pos);                 /* 位置pos处的螺距补偿量, 单位: 步 */
+void stepper_comp_set_backlash(uint8_t motor_num, uint32_t um);         /* 设置反向间隙, 单位: um */
+
+#endif
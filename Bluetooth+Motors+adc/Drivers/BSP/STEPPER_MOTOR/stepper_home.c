@@ -0,0 +1,392 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_home.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机回零及位置保存 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/STEPPER_MOTOR/stepper_home.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./BSP/RTC/rtc.h"
+#include "./BSP/CHECKPOINT/checkpoint.h"
+#include "./SYSTEM/delay/delay.h"
+
+
+static int32_t g_home_offset[STEPPER_AXIS_NUM];             /* 各轴原点偏移, 回零后原点处的位置值 */
+stepper_home_sta_t g_stepper_home = {STEPPER_HOME_IDLE};   /* 回零流程状态 */
+
+/**
+ * @brief       恢复回零状态、原点偏移、软限位和位置
+ * @note        需要在rtc_init()、stepper_init()和checkpoint_init()之后调用.
+ *              原点偏移和软限位来自RTC后备寄存器, 回零状态和位置来自后备SRAM中的断电续测记录
+ * @param       无
+ * @retval      无
+ */
+void stepper_home_init(void)
+{
+    uint8_t i;
+    uint32_t flag;
+    
+    if ((rtc_read_bkr(STEPPER_HOME_BKP_FLAG) & 0xFFFF0000) != STEPPER_HOME_BKP_MAGIC)  /* 第一次上电, 后备寄存器无效 */
+    {
+        for (i = 0; i < STEPPER_AXIS_NUM; i++)
+        {
+            rtc_write_bkr(STEPPER_HOME_BKP_OFFSET + i, 0);
+        }
+        rtc_write_bkr(STEPPER_HOME_BKP_FLAG, STEPPER_HOME_BKP_MAGIC);
+    }
+    
+    flag = rtc_read_bkr(STEPPER_HOME_BKP_FLAG);
+    
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        g_home_offset[i] = (int32_t)rtc_read_bkr(STEPPER_HOME_BKP_OFFSET + i);
+        
+        if (flag & (1 << i))                                      /* 设置过软限位, 否则保留默认值 */
+        {
+            stepper_set_soft_limit(i + 1, (int32_t)rtc_read_bkr(STEPPER_HOME_BKP_LIMIT + 2 * i),
+                                   (int32_t)rtc_read_bkr(STEPPER_HOME_BKP_LIMIT + 2 * i + 1), (flag >> (4 + i)) & 1);
+        }
+        
+        if (g_checkpoint.homed & (1 << i))                        /* 掉电前处于静止状态, 位置可信 */
+        {
+            stepper_set_pos(i + 1, g_checkpoint.pos[i]);
+            g_stepper_axis[i].homed = 1;
+        }
+    }
+}
+
+/**
+ * @brief       等待电机停止
+ * @param       motor_num: 步进电机接口序号
+ * @param       timeout  : 等待超时时间, 单位: ms
+ * @retval      STEPPER_EOK     : 电机已停止
+ *              STEPPER_ETIMEOUT: 等待超时, 电机已被强制停止
+ */
+uint8_t stepper_home_wait(uint8_t motor_num, uint32_t timeout)
+{
+    while (stepper_is_running(motor_num))
+    {
+        if (timeout == 0)
+        {
+            stepper_stop(motor_num);
+            return STEPPER_ETIMEOUT;
+        }
+        timeout--;
+        delay_ms(1);
+    }
+    
+    return STEPPER_EOK;
+}
+
+/**
+ * @brief       开始回零的一个阶段
+ * @note        靠近阶段开始时限位开关已经触发则直接记为触发, 由下一次stepper_home_poll()进入下一阶段
+ * @param       state: STEPPER_HOME_FAST/STEPPER_HOME_BACK/STEPPER_HOME_SLOW
+ * @retval      STEPPER_EOK: 已开始; 其他: stepper_move_steps()的错误代码
+ */
+static uint8_t stepper_home_enter(uint8_t state)
+{
+    uint8_t ret;
+    uint8_t motor_num = g_stepper_home.motor;
+    stepper_axis_t *axis = &g_stepper_axis[motor_num - 1];
+    
+    g_stepper_home.state = state;
+    g_stepper_home.start = HAL_GetTick();
+    
+    if (state == STEPPER_HOME_BACK)                                 /* 回退, 离开限位开关 */
+    {
+        stepper_pwmt_speed(STEPPER_HOME_FAST_ARR, stepper_get_channel(motor_num));
+        return stepper_move_steps(motor_num, !STEPPER_HOME_DIR, STEPPER_HOME_BACKOFF_STEPS);
+    }
+    
+    axis->endstop_hit = 0;
+    if (stepper_endstop(motor_num))
+    {
+        axis->endstop_hit = 1;
+        return STEPPER_EOK;
+    }
+    
+    /* 快速靠近的行程为最大行程, 慢速再次靠近不超过两倍回退距离 */
+    stepper_pwmt_speed((state == STEPPER_HOME_FAST) ? STEPPER_HOME_FAST_ARR : STEPPER_HOME_SLOW_ARR,
+                       stepper_get_channel(motor_num));
+    axis->seek = 1;
+    ret = stepper_move_steps(motor_num, STEPPER_HOME_DIR,
+                             (state == STEPPER_HOME_FAST) ? STEPPER_HOME_MAX_STEPS : STEPPER_HOME_BACKOFF_STEPS * 2);
+    if (ret != STEPPER_EOK)
+    {
+        axis->seek = 0;
+    }
+    
+    return ret;
+}
+
+/**
+ * @brief       结束回零, 成功时设置原点
+ * @param       ret: 回零结果
+ * @retval      无
+ */
+static void stepper_home_finish(uint8_t ret)
+{
+    uint8_t motor_num = g_stepper_home.motor;
+    
+    g_stepper_home.state = STEPPER_HOME_IDLE;
+    g_stepper_home.result = ret;
+    
+    if (ret == STEPPER_EOK)
+    {
+        stepper_set_pos(motor_num, g_home_offset[motor_num - 1]);
+        g_stepper_axis[motor_num - 1].homed = 1;
+        stepper_pwmt_speed(STEPPER_HOME_RUN_ARR, stepper_get_channel(motor_num));
+    }
+}
+
+/**
+ * @brief       开始单轴回零: 快速靠近 -> 回退 -> 慢速再次靠近, 不阻塞
+ * @note        之后由主循环中的stepper_home_poll()推进, 结束时返回1, 结果在g_stepper_home.result中.
+ *              回零过程中软限位不生效; 回零成功后当前位置被设置为原点偏移值.
+ *              正在回零时再次调用会放弃之前的回零
+ * @param       motor_num: 步进电机接口序号, 只有带限位开关的电机1~3可以回零
+ * @retval      STEPPER_EOK     : 已开始回零
+ *              STEPPER_EINVAL  : 该电机没有限位开关
+ *              STEPPER_ESTOP   : 急停锁定中
+ *              STEPPER_ESTOPPED: 启动途中被stepper_stop()取消
+ */
+uint8_t stepper_home(uint8_t motor_num)
+{
+    uint8_t ret;
+    
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_3))
+    {
+        return STEPPER_EINVAL;
+    }
+    
+    if (g_stepper_home.state != STEPPER_HOME_IDLE)
+    {
+        stepper_stop(g_stepper_home.motor);
+        g_stepper_home.state = STEPPER_HOME_IDLE;
+    }
+    
+    stepper_stop(motor_num);
+    g_stepper_axis[motor_num - 1].homed = 0;
+    g_checkpoint.homed &= ~(1 << (motor_num - 1));
+    checkpoint_save();
+    
+    g_stepper_home.motor = motor_num;
+    g_stepper_home.stops = g_stepper_axis[motor_num - 1].stops;    /* 之后被stepper_stop()打断时中止回零 */
+    ret = stepper_home_enter(STEPPER_HOME_FAST);
+    if (ret != STEPPER_EOK)
+    {
+        g_stepper_home.state = STEPPER_HOME_IDLE;
+        g_stepper_home.result = ret;
+    }
+    
+    return ret;
+}
+
+/**
+ * @brief       是否正在回零
+ * @param       无
+ * @retval      0: 没有回零; 1: 回零中
+ */
+uint8_t stepper_home_busy(void)
+{
+    return (g_stepper_home.state != STEPPER_HOME_IDLE) ? 1 : 0;
+}
+
+/**
+ * @brief       推进回零流程
+ * @note        电机停下后检查本阶段的结果并开始下一阶段; 被stop打断、急停或超时都结束回零
+ * @param       无
+ * @retval      1: 回零刚刚结束; 0: 没有回零或仍在进行
+ */
+static uint8_t stepper_home_step(void)
+{
+    uint8_t ret;
+    uint8_t motor_num = g_stepper_home.motor;
+    stepper_axis_t *axis;
+    
+    if (g_stepper_home.state == STEPPER_HOME_IDLE)
+    {
+        return 0;
+    }
+    
+    axis = &g_stepper_axis[motor_num - 1];
+    if (axis->stops != g_stepper_home.stops)                        /* 被stop打断, 回退被打断时不能当作回退完成 */
+    {
+        stepper_home_finish(STEPPER_ESTOPPED);
+        return 1;
+    }
+    
+    if (stepper_estop_latched())
+    {
+        stepper_home_finish(STEPPER_ESTOP);
+        return 1;
+    }
+    
+    if (stepper_is_running(motor_num))
+    {
+        if ((HAL_GetTick() - g_stepper_home.start) >= STEPPER_HOME_TIMEOUT_MS)
+        {
+            stepper_stop(motor_num);
+            stepper_home_finish(STEPPER_ETIMEOUT);
+            return 1;
+        }
+        return 0;
+    }
+    
+    switch (g_stepper_home.state)
+    {
+        case STEPPER_HOME_FAST:
+            ret = axis->endstop_hit ? stepper_home_enter(STEPPER_HOME_BACK) : STEPPER_ERROR;
+            break;
+        
+        case STEPPER_HOME_BACK:
+            /* 回退后仍处于触发状态 */
+            ret = stepper_endstop(motor_num) ? STEPPER_ERROR : stepper_home_enter(STEPPER_HOME_SLOW);
+            break;
+        
+        default:
+            stepper_home_finish(axis->endstop_hit ? STEPPER_EOK : STEPPER_ERROR);
+            return 1;
+    }
+    
+    if (ret != STEPPER_EOK)
+    {
+        stepper_home_finish(ret);
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief       设置原点偏移, 即回零完成时原点处的位置值
+ * @param       motor_num: 步进电机接口序号
+ * @param       offset   : 原点偏移, 单位: 步
+ * @retval      无
+ */
+void stepper_home_set_offset(uint8_t motor_num, int32_t offset)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return;
+    }
+    
+    g_home_offset[motor_num - 1] = offset;
+    rtc_write_bkr(STEPPER_HOME_BKP_OFFSET + motor_num - 1, (uint32_t)offset);
+}
+
+/**
+ * @brief       获取原点偏移
+ * @param       motor_num: 步进电机接口序号
+ * @retval      原点偏移, 单位: 步
+ */
+int32_t stepper_home_get_offset(uint8_t motor_num)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return 0;
+    }
+    
+    return g_home_offset[motor_num - 1];
+}
+
+/**
+ * @brief       设置软限位并保存到RTC后备寄存器, 复位后由stepper_home_init()恢复
+ * @param       motor_num: 步进电机接口序号
+ * @param       min      : 下限, 单位: 步
+ * @param       max      : 上限, 单位: 步
+ * @param       en       : 0, 关闭软限位; 1, 使能软限位
+ * @retval      STEPPER_EOK   : 设置成功
+ *              STEPPER_EINVAL: 参数错误
+ */
+uint8_t stepper_home_set_limit(uint8_t motor_num, int32_t min, int32_t max, uint8_t en)
+{
+    uint8_t ret;
+    uint32_t flag;
+    
+    ret = stepper_set_soft_limit(motor_num, min, max, en);
+    if (ret != STEPPER_EOK)
+    {
+        return ret;
+    }
+    
+    rtc_write_bkr(STEPPER_HOME_BKP_LIMIT + 2 * (motor_num - 1), (uint32_t)min);
+    rtc_write_bkr(STEPPER_HOME_BKP_LIMIT + 2 * (motor_num - 1) + 1, (uint32_t)max);
+    
+    flag = rtc_read_bkr(STEPPER_HOME_BKP_FLAG);
+    flag |= 1 << (motor_num - 1);
+    flag &= ~(1 << (4 + motor_num - 1));
+    flag |= (en ? 1 : 0) << (4 + motor_num - 1);
+    rtc_write_bkr(STEPPER_HOME_BKP_FLAG, flag);
+    
+    return STEPPER_EOK;
+}
+
+/**
+ * @brief       把各轴状态同步到断电续测记录
+ * @note        电机运行时清除该轴的回零状态, 停止后写入位置并恢复回零状态,
+ *              这样运行中掉电的轴在下次上电时会被认为需要重新回零; 有变化时才保存
+ * @param       无
+ * @retval      无
+ */
+static void stepper_home_save(void)
+{
+    uint8_t i;
+    uint8_t mask = 0;
+    uint8_t changed = 0;
+    int32_t pos;
+    
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        if ((g_stepper_axis[i].homed == 0) || stepper_is_running(i + 1))
+        {
+            continue;
+        }
+        
+        pos = stepper_get_pos(i + 1);
+        if (pos != g_checkpoint.pos[i])
+        {
+            g_checkpoint.pos[i] = pos;
+            changed = 1;
+        }
+        mask |= 1 << i;
+    }
+    
+    if (mask != g_checkpoint.homed)
+    {
+        g_checkpoint.homed = mask;
+        changed = 1;
+    }
+    
+    if (changed)
+    {
+        checkpoint_save();
+    }
+}
+
+/**
+ * @brief       推进回零流程并把各轴状态同步到断电续测记录, 在主循环中调用
+ * @param       无
+ * @retval      1: 回零刚刚结束, 结果在g_stepper_home.result中; 0: 其他
+ */
+uint8_t stepper_home_poll(void)
+{
+    uint8_t done = stepper_home_step();
+    
+    stepper_home_save();
+    return done;
+}
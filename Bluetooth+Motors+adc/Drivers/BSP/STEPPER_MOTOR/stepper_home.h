@@ -0,0 +1,77 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_home.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机回零及位置保存 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 回零流程: 快速靠近限位开关 -> 回退 -> 慢速再次靠近 -> 设置原点偏移
+ * stepper_home()只开始回零, 各阶段由主循环中的stepper_home_poll()推进, 不阻塞主循环
+ * 原点偏移和用"limit"命令设置的软限位保存在RTC后备寄存器中, 回零状态和各轴停止时的位置保存在
+ * 后备SRAM的断电续测记录中, 掉电(有纽扣电池)不丢失. 没有设置过软限位的轴使用编译时的默认值
+ * STEPPER_SOFT_MIN_DEFAULT/STEPPER_SOFT_MAX_DEFAULT
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STEPPER_HOME_H
+#define __STEPPER_HOME_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 回零参数定义 */
+
+#define STEPPER_HOME_DIR                0           /* 回零方向, 向负方向(上升)寻找限位开关 */
+#define STEPPER_HOME_FAST_ARR           500         /* 快速靠近速度, 定时器重装载值(1MHz计数, 即2kHz) */
+#define STEPPER_HOME_SLOW_ARR           4000        /* 慢速再次靠近速度(250Hz) */
+#define STEPPER_HOME_RUN_ARR            1000        /* 回零结束后恢复的运行速度 */
+#define STEPPER_HOME_BACKOFF_STEPS      400         /* 触发后回退的步数 */
+#define STEPPER_HOME_MAX_STEPS          200000      /* 快速靠近的最大行程, 超过则认为回零失败 */
+#define STEPPER_HOME_TIMEOUT_MS         120000      /* 单个阶段的最长等待时间 */
+
+/* 回零阶段 */
+#define STEPPER_HOME_IDLE               0           /* 没有回零 */
+#define STEPPER_HOME_FAST               1           /* 快速靠近 */
+#define STEPPER_HOME_BACK               2           /* 回退 */
+#define STEPPER_HOME_SLOW               3           /* 慢速再次靠近 */
+
+/* RTC后备寄存器分配, DR0已被rtc.c用于记录时钟源 */
+#define STEPPER_HOME_BKP_FLAG           RTC_BKP_DR1 /* [31:16]标志, 原点偏移有效; [3:0]各轴软限位已保存; [7:4]各轴软限位使能 */
+#define STEPPER_HOME_BKP_OFFSET         RTC_BKP_DR6 /* DR6~DR9: 各轴原点偏移 */
+#define STEPPER_HOME_BKP_LIMIT          RTC_BKP_DR10 /* DR10~DR17: 各轴软限位下限、上限 */
+#define STEPPER_HOME_BKP_MAGIC          0x5AA50000
+
+/* 回零流程状态 */
+typedef struct
+{
+    uint8_t state;                          /* 回零阶段, STEPPER_HOME_IDLE表示没有回零 */
+    uint8_t motor;                          /* 正在(或最近一次)回零的电机 */
+    uint8_t stops;                          /* 开始时该轴的stop计数, 变化时中止回零 */
+    uint8_t result;                         /* 最近一次回零的结果 */
+    uint32_t start;                         /* 当前阶段的开始时刻, 单位: ms */
+} stepper_home_sta_t;
+
+extern stepper_home_sta_t g_stepper_home;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void stepper_home_init(void);                                           /* 恢复回零状态和位置 */
+uint8_t stepper_home(uint8_t motor_num);                                /* 开始单轴回零, 不阻塞 */
+uint8_t stepper_home_busy(void);                                        /* 是否正在回零 */
+uint8_t stepper_home_wait(uint8_t motor_num, uint32_t timeout);         /* 等待电机停止 */
+void stepper_home_set_offset(uint8_t motor_num, int32_t offset);        /* 设置原点偏移 */
+int32_t stepper_home_get_offset(uint8_t motor_num);                     /* 获取原点偏移 */
+uint8_t stepper_home_set_limit(uint8_t motor_num, int32_t min, int32_t max, uint8_t en);  /* 设置并保存软限位 */
+uint8_t stepper_home_poll(void);                                        /* 推进回零并保存停止后的位置, 在主循环中调用 */
+
+#endif
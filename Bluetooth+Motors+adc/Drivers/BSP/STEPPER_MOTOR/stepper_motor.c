@@ -1,93 +1,466 @@
 /**
  ****************************************************************************************************
  * @file        stepper_motor.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief        
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       步进电机 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
  
 #include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./BSP/STEPPER_MOTOR/stepper_comp.h"
+#include "./BSP/STEPPER_MOTOR/stepper_power.h"
+#include "./BSP/STEPPER_MOTOR/stepper_scope.h"
+#include "./BSP/STEPPER_MOTOR/stepper_verify.h"
 #include "./BSP/TIMER/stepper_tim.h"
 
+
+stepper_axis_t g_stepper_axis[STEPPER_AXIS_NUM];            /* 各轴状态 */
+
+/* 电机编号(1~4)对应的定时器通道 */
+static const uint32_t g_stepper_channel[STEPPER_AXIS_NUM] = {ATIM_TIMX_PWM_CH1, ATIM_TIMX_PWM_CH2, ATIM_TIMX_PWM_CH3, ATIM_TIMX_PWM_CH4};
+
+static volatile uint8_t g_stepper_estop = 0;                /* 急停锁定标志, 置位后禁止启动电机 */
+
 /**
- * @brief       ʼIO, ʹʱ
- * @param       arr: Զװֵ
- * @param       psc: ʱԤƵ
- * @retval      
+ * @brief       初始化步进电机相关IO口, 并使能时钟
+ * @param       arr: 自动重装值
+ * @param       psc: 时钟预分频数
+ * @retval      无
  */
 void stepper_init(uint16_t arr, uint16_t psc)
 {
     GPIO_InitTypeDef gpio_init_struct;
+    uint8_t i;
 
-    STEPPER_DIR1_GPIO_CLK_ENABLE();                                 /* DIR1ʱʹ */
-    STEPPER_DIR2_GPIO_CLK_ENABLE();                                 /* DIR2ʱʹ */
-    STEPPER_DIR3_GPIO_CLK_ENABLE();                                 /* DIR3ʱʹ */
-    STEPPER_DIR4_GPIO_CLK_ENABLE();                                 /* DIR4ʱʹ */
+    STEPPER_DIR1_GPIO_CLK_ENABLE();                                 /* DIR1时钟使能 */
+    STEPPER_DIR2_GPIO_CLK_ENABLE();                                 /* DIR2时钟使能 */
+    STEPPER_DIR3_GPIO_CLK_ENABLE();                                 /* DIR3时钟使能 */
+    STEPPER_DIR4_GPIO_CLK_ENABLE();                                 /* DIR4时钟使能 */
             
-    STEPPER_EN1_GPIO_CLK_ENABLE();                                  /* EN1ʱʹ */
-    STEPPER_EN2_GPIO_CLK_ENABLE();                                  /* EN2ʱʹ */
-    STEPPER_EN3_GPIO_CLK_ENABLE();                                  /* EN3ʱʹ */
-    STEPPER_EN4_GPIO_CLK_ENABLE();                                  /* EN4ʱʹ */
+    STEPPER_EN1_GPIO_CLK_ENABLE();                                  /* EN1时钟使能 */
+    STEPPER_EN2_GPIO_CLK_ENABLE();                                  /* EN2时钟使能 */
+    STEPPER_EN3_GPIO_CLK_ENABLE();                                  /* EN3时钟使能 */
+    STEPPER_EN4_GPIO_CLK_ENABLE();                                  /* EN4时钟使能 */
+    
+
+    gpio_init_struct.Pin = STEPPER_DIR1_GPIO_PIN;                   /* DIR1引脚 */
+    gpio_init_struct.Mode = GPIO_MODE_OUTPUT_PP;                    /* 推挽输出 */
+    gpio_init_struct.Pull = GPIO_PULLDOWN;                          /* 下拉 */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_LOW;                   /* 低速 */
+    HAL_GPIO_Init(STEPPER_DIR1_GPIO_PORT, &gpio_init_struct);       /* 初始化DIR1引脚 */
+
+    gpio_init_struct.Pin = STEPPER_DIR2_GPIO_PIN;                   /* DIR2引脚 */
+    HAL_GPIO_Init(STEPPER_DIR2_GPIO_PORT, &gpio_init_struct);       /* 初始化DIR2引脚 */
+
+    gpio_init_struct.Pin = STEPPER_DIR3_GPIO_PIN;                   /* DIR3引脚 */
+    HAL_GPIO_Init(STEPPER_DIR3_GPIO_PORT, &gpio_init_struct);       /* 初始化DIR3引脚 */
+
+    gpio_init_struct.Pin = STEPPER_DIR4_GPIO_PIN;                   /* DIR4引脚 */
+    HAL_GPIO_Init(STEPPER_DIR4_GPIO_PORT, &gpio_init_struct);       /* 初始化DIR4引脚 */
+    
+    /*   脱机引脚初始化   */
+    
+    gpio_init_struct.Pin = STEPPER_EN1_GPIO_PIN;                    /* EN1引脚 */
+    HAL_GPIO_Init(STEPPER_EN1_GPIO_PORT, &gpio_init_struct);        /* 初始化EN1引脚 */
+    
+    gpio_init_struct.Pin = STEPPER_EN2_GPIO_PIN;                    /* EN2引脚 */
+    HAL_GPIO_Init(STEPPER_EN2_GPIO_PORT, &gpio_init_struct);        /* 初始化EN2引脚 */
+    
+    gpio_init_struct.Pin = STEPPER_EN3_GPIO_PIN;                    /* EN3引脚 */
+    HAL_GPIO_Init(STEPPER_EN3_GPIO_PORT, &gpio_init_struct);        /* 初始化EN3引脚 */
+    
+    gpio_init_struct.Pin = STEPPER_EN4_GPIO_PIN;                    /* EN4引脚 */
+    HAL_GPIO_Init(STEPPER_EN4_GPIO_PORT, &gpio_init_struct);        /* 初始化EN4引脚 */
+    
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        g_stepper_axis[i].pos = 0;
+        g_stepper_axis[i].mpos = 0;
+        g_stepper_axis[i].remain = 0;
+        g_stepper_axis[i].comp = 0;
+        g_stepper_axis[i].lash = 0;
+        g_stepper_axis[i].pitch = 0;
+        g_stepper_axis[i].last_dir = STEPPER_DIR_NONE;
+        g_stepper_axis[i].step = 0;
+        g_stepper_axis[i].seek = 0;
+        g_stepper_axis[i].endstop_hit = 0;
+        g_stepper_axis[i].limit_hit = 0;
+        g_stepper_axis[i].ramp = NULL;
+        g_stepper_axis[i].total = 0;
+        g_stepper_axis[i].soft_min = STEPPER_SOFT_MIN_DEFAULT;
+        g_stepper_axis[i].soft_max = STEPPER_SOFT_MAX_DEFAULT;
+        g_stepper_axis[i].limit_en = 1;
+        g_stepper_axis[i].homed = 0;
+    }
+    
+    stepper_comp_init();                                            /* 生成反向间隙和螺距补偿表 */
+    stepper_power_init();                                           /* 驱动器默认关闭, 运动前再使能 */
+    atim_timx_oc_chy_init(arr, psc);                                /* 初始化PUL引脚，以及脉冲模式等 */
+}
+
+/**
+ * @brief       判断软限位是否禁止向指定方向运动
+ * @param       axis: 轴状态
+ * @param       dir : 运动方向
+ * @retval      0: 允许; 1: 禁止
+ */
+static uint8_t stepper_limit_block(stepper_axis_t *axis, uint8_t dir)
+{
+    if ((axis->homed == 0) || (axis->limit_en == 0))
+    {
+        return 0;
+    }
+    
+    if (dir)
+    {
+        return (axis->pos >= axis->soft_max) ? 1 : 0;
+    }
     
+    return (axis->pos <= axis->soft_min) ? 1 : 0;
+}
 
-    gpio_init_struct.Pin = STEPPER_DIR1_GPIO_PIN;                   /* DIR1 */
-    gpio_init_struct.Mode = GPIO_MODE_OUTPUT_PP;                    /*  */
-    gpio_init_struct.Pull = GPIO_PULLDOWN;                          /*  */
-    gpio_init_struct.Speed = GPIO_SPEED_FREQ_LOW;                   /*  */
-    HAL_GPIO_Init(STEPPER_DIR1_GPIO_PORT, &gpio_init_struct);       /* ʼDIR1 */
+/**
+ * @brief       设置TIM8周期, 各通道的比较值同时设为周期的一半
+ * @note        各通道共用周期, 只改一个通道的比较值时, 周期小于其他运行通道的比较值会使该通道
+ *              不再输出脉冲, 而更新中断仍在为它计步. 供加减速在中断中调用
+ * @param       arr: 重装载值
+ * @retval      无
+ */
+static void stepper_set_period(uint16_t arr)
+{
+    uint8_t i;
+    
+    __HAL_TIM_SET_AUTORELOAD(&g_atimx_handle, arr);
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        __HAL_TIM_SET_COMPARE(&g_atimx_handle, g_stepper_channel[i], arr >> 1);
+    }
+}
 
-    gpio_init_struct.Pin = STEPPER_DIR2_GPIO_PIN;                   /* DIR2 */
-    HAL_GPIO_Init(STEPPER_DIR2_GPIO_PORT, &gpio_init_struct);       /* ʼDIR2 */
+/**
+ * @brief       放弃尚未输出的补偿脉冲
+ * @note        螺距补偿脉冲在插入时已计入pitch, 没输出的部分从pitch中扣除, 下次运动时重新补偿;
+ *              反向间隙没走完的部分留在lash中, 下次启动时按方向补足或退回. 需在关中断或中断中调用
+ * @param       axis: 轴状态
+ * @retval      无
+ */
+static void stepper_comp_drop(stepper_axis_t *axis)
+{
+    int16_t left = axis->comp - axis->lash;                         /* 未输出的螺距补偿脉冲 */
+    
+    if (left > 0)
+    {
+        axis->pitch -= axis->last_dir ? left : -left;
+    }
+    axis->comp = 0;
+}
 
-    gpio_init_struct.Pin = STEPPER_DIR3_GPIO_PIN;                   /* DIR3 */
-    HAL_GPIO_Init(STEPPER_DIR3_GPIO_PORT, &gpio_init_struct);       /* ʼDIR3 */
+/**
+ * @brief       在中断中关闭某一轴的PWM输出
+ * @note        只操作寄存器并同步HAL通道状态, 保证之后stepper_star仍可正常启动
+ * @param       index: 轴下标, 0~3
+ * @retval      无
+ */
+static void stepper_halt_isr(uint8_t index)
+{
+    uint32_t channel = g_stepper_channel[index];
+    
+    g_stepper_axis[index].step = 0;
+    g_stepper_axis[index].remain = 0;
+    g_stepper_axis[index].seek = 0;
+    g_stepper_axis[index].ramp = NULL;
+    stepper_comp_drop(&g_stepper_axis[index]);
+    ATIM_TIMX_PWM->CCER &= ~(TIM_CCER_CC1E << (channel & 0x1FU));   /* 关闭通道输出 */
+    TIM_CHANNEL_STATE_SET(&g_atimx_handle, channel, HAL_TIM_CHANNEL_STATE_READY);
+    __HAL_TIM_MOE_DISABLE(&g_atimx_handle);                         /* 所有通道都关闭时才会真正关闭 */
+    __HAL_TIM_DISABLE(&g_atimx_handle);
+}
 
-    gpio_init_struct.Pin = STEPPER_DIR4_GPIO_PIN;                   /* DIR4 */
-    HAL_GPIO_Init(STEPPER_DIR4_GPIO_PORT, &gpio_init_struct);       /* ʼDIR4 */
+/**
+ * @brief       急停: 立即关闭所有驱动器和PWM输出
+ * @note        供急停中断调用, 全部为寄存器操作, 不经过HAL库:
+ *              1, 所有EN(脱机)引脚置1, 驱动器失能
+ *              2, 清除MOE并关闭各通道和计数器, 冻结TIM8输出
+ *              驱动器失电后位置不再可信, 各轴回零标志同时清除
+ *              调用stepper_estop_release()之前, 所有启动请求都返回STEPPER_ESTOP
+ * @param       无
+ * @retval      无
+ */
+void stepper_estop_isr(void)
+{
+    uint8_t i;
     
-    /*   ѻųʼ   */
+    SYS_IO_ON(STEPPER_EN1_IO);                                      /* 直接写BSRR, 每个引脚一条存储指令 */
+    SYS_IO_ON(STEPPER_EN2_IO);
+    SYS_IO_ON(STEPPER_EN3_IO);
+    SYS_IO_ON(STEPPER_EN4_IO);
+    ATIM_TIMX_PWM->BDTR &= ~TIM_BDTR_MOE;                           /* 主输出关闭 */
+    ATIM_TIMX_PWM->CCER &= ~(TIM_CCER_CC1E | TIM_CCER_CC2E | TIM_CCER_CC3E | TIM_CCER_CC4E);
+    ATIM_TIMX_PWM->CR1 &= ~TIM_CR1_CEN;
     
-    gpio_init_struct.Pin = STEPPER_EN1_GPIO_PIN;                    /* EN1 */
-    HAL_GPIO_Init(STEPPER_EN1_GPIO_PORT, &gpio_init_struct);        /* ʼEN1 */
+    g_stepper_estop = 1;
     
-    gpio_init_struct.Pin = STEPPER_EN2_GPIO_PIN;                    /* EN2 */
-    HAL_GPIO_Init(STEPPER_EN2_GPIO_PORT, &gpio_init_struct);        /* ʼEN2 */
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        g_stepper_axis[i].step = 0;
+        g_stepper_axis[i].remain = 0;
+        g_stepper_axis[i].seek = 0;
+        g_stepper_axis[i].ramp = NULL;
+        g_stepper_axis[i].comp = 0;
+        g_stepper_axis[i].lash = 0;
+        g_stepper_axis[i].last_dir = STEPPER_DIR_NONE;              /* 驱动器失电后间隙状态未知 */
+        g_stepper_axis[i].homed = 0;
+        TIM_CHANNEL_STATE_SET(&g_atimx_handle, g_stepper_channel[i], HAL_TIM_CHANNEL_STATE_READY);
+    }
     
-    gpio_init_struct.Pin = STEPPER_EN3_GPIO_PIN;                    /* EN3 */
-    HAL_GPIO_Init(STEPPER_EN3_GPIO_PORT, &gpio_init_struct);        /* ʼEN3 */
+    stepper_power_lost();
+}
+
+/**
+ * @brief       解除急停锁定
+ * @note        驱动器保持关闭, 下一次启动时由电源管理重新使能
+ * @param       无
+ * @retval      无
+ */
+void stepper_estop_release(void)
+{
+    g_stepper_estop = 0;
+}
+
+/**
+ * @brief       是否处于急停锁定
+ * @param       无
+ * @retval      0: 未锁定; 1: 锁定中
+ */
+uint8_t stepper_estop_latched(void)
+{
+    return g_stepper_estop;
+}
+
+/**
+ * @brief       步进电机定时器更新中断服务函数
+ * @note        各通道共用TIM8的周期, 每个更新事件即为各运行通道输出了一个脉冲,
+ *              在这里完成位置计数、丢步检测、间隙/螺距补偿、定长运动、回零限位开关和软限位检测
+ * @param       无
+ * @retval      无
+ */
+void ATIM_TIMX_UP_IRQHandler(void)
+{
+    uint8_t i;
+    uint32_t k;
+    uint16_t arr;
+    int32_t d;
+    stepper_axis_t *axis;
     
-    gpio_init_struct.Pin = STEPPER_EN4_GPIO_PIN;                    /* EN4 */
-    HAL_GPIO_Init(STEPPER_EN4_GPIO_PORT, &gpio_init_struct);        /* ʼEN4 */
+    if (__HAL_TIM_GET_FLAG(&g_atimx_handle, TIM_FLAG_UPDATE) == RESET)
+    {
+        return;
+    }
+    __HAL_TIM_CLEAR_IT(&g_atimx_handle, TIM_IT_UPDATE);
     
-    atim_timx_oc_chy_init(arr, psc);                                /* ʼPULţԼģʽ */
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        axis = &g_stepper_axis[i];
+        if (axis->step == 0)
+        {
+            continue;
+        }
+        
+        if ((i == STEPPER_SCOPE_AXIS - 1) && (g_stepper_scope.armed != 0))
+        {
+            stepper_scope_plan(ATIM_TIMX_PWM->ARR);                 /* 回环测试: 记录刚结束的周期 */
+        }
+        
+        axis->mpos += axis->step;
+        
+        if (stepper_verify_check(i, axis->mpos, axis->step) != 0)  /* 丢步, 位置不再可信 */
+        {
+            axis->homed = 0;
+            stepper_halt_isr(i);
+            continue;
+        }
+        
+        if (axis->comp != 0)                                        /* 补偿脉冲: 逻辑位置和剩余步数不变 */
+        {
+            axis->comp--;
+            if (axis->lash != 0)                                    /* 反向间隙总是排在螺距补偿之前 */
+            {
+                axis->lash--;
+            }
+            
+            if ((axis->comp == 0) && (axis->remain == 0) && (axis->total != 0))
+            {
+                stepper_halt_isr(i);                                /* 定长运动最后一步的螺距补偿已输出 */
+            }
+            continue;
+        }
+        
+        axis->pos += axis->step;
+        
+        if (axis->homed != 0)                                       /* 螺距补偿, 误差每变化1步修正一次 */
+        {
+            d = stepper_comp_pitch(i, axis->pos) - axis->pitch;
+            if (d == axis->step)                                    /* 需要多走一步: 插入补偿脉冲 */
+            {
+                axis->pitch += d;
+                axis->comp++;
+            }
+            else if (d == -axis->step)                              /* 需要少走一步: 本脉冲前进两步 */
+            {
+                axis->pitch += d;
+                axis->pos += axis->step;
+                if (axis->remain > 1)
+                {
+                    axis->remain--;
+                }
+            }
+        }
+        
+        if ((axis->remain != 0) && (--axis->remain == 0))           /* 定长运动完成 */
+        {
+            if (axis->comp == 0)                                    /* 最后一步插入了补偿脉冲时, 输出完再停止 */
+            {
+                stepper_halt_isr(i);
+            }
+            continue;
+        }
+        
+        if (axis->ramp != NULL)                                     /* 加减速: 按距离起点和终点较近的一端查表 */
+        {
+            k = axis->total - axis->remain;
+            if (k > axis->remain)
+            {
+                k = axis->remain;
+            }
+            k >>= axis->ramp->shift;
+            if (k >= axis->ramp->len)
+            {
+                k = axis->ramp->len - 1;
+            }
+            
+            arr = axis->ramp->arr[k];
+            stepper_set_period(arr);                                /* 同时运行的其他轴跟着变速, 但不会丢脉冲 */
+        }
+        
+        if ((axis->seek != 0) && (stepper_endstop(i + 1) != 0))     /* 回零时碰到限位开关 */
+        {
+            axis->endstop_hit = 1;
+            stepper_halt_isr(i);
+            continue;
+        }
+        
+        if ((axis->homed != 0) && (axis->limit_en != 0))            /* 软限位 */
+        {
+            if (((axis->step > 0) && (axis->pos >= axis->soft_max)) ||
+                ((axis->step < 0) && (axis->pos <= axis->soft_min)))
+            {
+                axis->limit_hit = 1;
+                stepper_halt_isr(i);
+            }
+        }
+    }
 }
 
 /**
- * @brief       
- * @param       motor_num: ӿ
- * @retval      
+ * @brief       启动步进电机
+ * @note        驱动器关闭时先使能并等待稳定(阻塞数ms), 急停或紧急stop命令(接收中断)可能在这期间发生,
+ *              所以等待之后关中断再检查一次急停锁定和stop计数, 直到通道开启; 已应答的停止不会被启动过程覆盖
+ * @param       motor_num: 步进电机接口序号
+ * @param       dir      : 运动方向
+ * @param       steps    : 运动步数, 0表示连续运行直到stepper_stop
+ * @retval      STEPPER_EOK   : 启动成功
+ *              STEPPER_EINVAL: 参数错误
+ *              STEPPER_ELIMIT: 已到达该方向的软限位
+ *              STEPPER_ESTOP : 急停锁定中
+ *              STEPPER_ESTOPPED: 等待驱动器稳定期间被stepper_stop()取消
  */
-void stepper_star(uint8_t motor_num, uint8_t dir)
+static uint8_t stepper_start(uint8_t motor_num, uint8_t dir, uint32_t steps, const stepper_ramp_t *ramp)
 {
+    stepper_axis_t *axis;
+    uint32_t primask;
+    uint16_t backlash;
+    uint8_t stops;
+    
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return STEPPER_EINVAL;
+    }
+    
+    if (g_stepper_estop != 0)
+    {
+        return STEPPER_ESTOP;
+    }
+    
+    axis = &g_stepper_axis[motor_num - 1];
+    if (stepper_limit_block(axis, dir) != 0)
+    {
+        axis->limit_hit = 1;
+        return STEPPER_ELIMIT;
+    }
+    
+    stops = axis->stops;
+    stepper_power_wake(motor_num);                                  /* 驱动器关闭时先使能并等待稳定 */
+    
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (g_stepper_estop != 0)                                       /* 等待稳定期间发生了急停 */
+    {
+        stepper_power_enable(motor_num, 0);                         /* 确保EN无效, 不依赖中断与唤醒的先后 */
+        __set_PRIMASK(primask);
+        return STEPPER_ESTOP;
+    }
+    
+    if (axis->stops != stops)                                       /* 等待稳定期间被停止 */
+    {
+        __set_PRIMASK(primask);
+        return STEPPER_ESTOPPED;
+    }
+    
+    axis->limit_hit = 0;
+    stepper_comp_drop(axis);                                        /* 运行中重新启动: 先结算没输出的补偿 */
+    backlash = stepper_comp_backlash(motor_num - 1);
+    if (axis->last_dir == STEPPER_DIR_NONE)
+    {
+        axis->comp = 0;
+    }
+    else if (axis->last_dir != dir)                                 /* 换向: 先走完反向间隙, 上次被打断时只退回已走的部分 */
+    {
+        axis->comp = (axis->lash < backlash) ? (backlash - axis->lash) : 0;
+    }
+    else
+    {
+        axis->comp = axis->lash;                                    /* 同向: 补足上次被打断的间隙 */
+    }
+    axis->lash = axis->comp;
+    axis->last_dir = dir;
+    axis->remain = steps;
+    axis->total = steps;
+    axis->ramp = (steps != 0) ? ramp : NULL;                        /* 连续运行不使用加减速表 */
+    if (axis->ramp != NULL)
+    {
+        stepper_set_period(ramp->arr[0]);                           /* 从最慢速度起步 */
+    }
+    axis->step = dir ? 1 : -1;                                      /* 先登记方向, 再开启输出 */
+    
     switch(motor_num)
     {
-        /* ӦPWMͨ */
+        /* 开启对应PWM通道 */
         case STEPPER_MOTOR_1 :
         {
             ST1_DIR(dir);
@@ -103,6 +476,7 @@ void stepper_star(uint8_t motor_num, uint8_t dir)
         }
         case STEPPER_MOTOR_2 :
         {
+            ST2_DIR(dir);
             if(g_atimx_oc_chy_handle.OCMode == TIM_OCMODE_PWM1||g_atimx_oc_chy_handle.OCMode == TIM_OCMODE_PWM2) 
             {
                 HAL_TIM_PWM_Start(&g_atimx_handle, ATIM_TIMX_PWM_CH2);       
@@ -115,6 +489,7 @@ void stepper_star(uint8_t motor_num, uint8_t dir)
         }
         case STEPPER_MOTOR_3 :
         {
+            ST3_DIR(dir);
             if(g_atimx_oc_chy_handle.OCMode == TIM_OCMODE_PWM1||g_atimx_oc_chy_handle.OCMode == TIM_OCMODE_PWM2) 
             {
                 HAL_TIM_PWM_Start(&g_atimx_handle, ATIM_TIMX_PWM_CH3);       
@@ -127,6 +502,7 @@ void stepper_star(uint8_t motor_num, uint8_t dir)
         }
         case STEPPER_MOTOR_4 :
         {
+            ST4_DIR(dir);
             if(g_atimx_oc_chy_handle.OCMode == TIM_OCMODE_PWM1||g_atimx_oc_chy_handle.OCMode == TIM_OCMODE_PWM2) 
             {
                 HAL_TIM_PWM_Start(&g_atimx_handle, ATIM_TIMX_PWM_CH4);        
@@ -139,20 +515,91 @@ void stepper_star(uint8_t motor_num, uint8_t dir)
         }
         default : break;
     }
+    __set_PRIMASK(primask);
+    
+    return STEPPER_EOK;
+}
+
+/**
+ * @brief       开启步进电机(连续运行)
+ * @param       motor_num: 步进电机接口序号
+ * @param       dir      : 运动方向
+ * @retval      STEPPER_EOK   : 启动成功
+ *              STEPPER_EINVAL: 参数错误
+ *              STEPPER_ELIMIT: 已到达该方向的软限位
+ *              STEPPER_ESTOP : 急停锁定中
+ */
+uint8_t stepper_star(uint8_t motor_num, uint8_t dir)
+{
+    return stepper_start(motor_num, dir, 0, NULL);
+}
+
+/**
+ * @brief       步进电机定长运动, 走完指定步数后在中断中自动停止
+ * @param       motor_num: 步进电机接口序号
+ * @param       dir      : 运动方向
+ * @param       steps    : 运动步数
+ * @retval      STEPPER_EOK   : 启动成功
+ *              STEPPER_EINVAL: 参数错误
+ *              STEPPER_ELIMIT: 已到达该方向的软限位
+ *              STEPPER_ESTOP : 急停锁定中
+ */
+uint8_t stepper_move_steps(uint8_t motor_num, uint8_t dir, uint32_t steps)
+{
+    if (steps == 0)
+    {
+        return STEPPER_EINVAL;
+    }
+    
+    return stepper_start(motor_num, dir, steps, NULL);
+}
+
+/**
+ * @brief       带加减速的定长运动
+ * @note        速度由加减速表决定, 起步和停止前都按表中的加速度变化;
+ *              各轴共用TIM8周期, 运动期间会改变所有运行轴的速度
+ * @param       motor_num: 步进电机接口序号
+ * @param       dir      : 运动方向
+ * @param       steps    : 运动步数
+ * @param       ramp     : 加减速表, 运动结束前必须保持有效
+ * @retval      同stepper_move_steps()
+ */
+uint8_t stepper_move_ramp(uint8_t motor_num, uint8_t dir, uint32_t steps, const stepper_ramp_t *ramp)
+{
+    if ((steps == 0) || (ramp == NULL) || (ramp->len == 0))
+    {
+        return STEPPER_EINVAL;
+    }
+    
+    return stepper_start(motor_num, dir, steps, ramp);
 }
 
 /**
- * @brief       رղ
- * @param       motor_num: ӿ
- * @retval      
+ * @brief       关闭步进电机
+ * @note        可在中断中调用(紧急stop命令); 关中断操作, 不会与主循环中的启动交错
+ * @param       motor_num: 步进电机接口序号
+ * @retval      无
  */
 void stepper_stop(uint8_t motor_num)
 {
+    uint32_t primask = __get_PRIMASK();
+    
+    __disable_irq();
+    if ((motor_num >= STEPPER_MOTOR_1) && (motor_num <= STEPPER_MOTOR_4))
+    {
+        g_stepper_axis[motor_num - 1].stops++;                      /* 取消正在等待驱动器稳定的启动 */
+        g_stepper_axis[motor_num - 1].step = 0;                     /* 先停止计数, 再关闭输出 */
+        g_stepper_axis[motor_num - 1].remain = 0;
+        g_stepper_axis[motor_num - 1].seek = 0;
+        g_stepper_axis[motor_num - 1].ramp = NULL;
+        stepper_comp_drop(&g_stepper_axis[motor_num - 1]);
+    }
+    
     switch(motor_num)
     {
         case STEPPER_MOTOR_1 :
         {
-            /* رնӦPWMͨ */
+            /* 关闭对应PWM通道 */
             if(g_atimx_oc_chy_handle.OCMode == TIM_OCMODE_PWM1||g_atimx_oc_chy_handle.OCMode == TIM_OCMODE_PWM2) 
             {
                 HAL_TIM_PWM_Stop(&g_atimx_handle, ATIM_TIMX_PWM_CH1);       
@@ -201,13 +648,14 @@ void stepper_stop(uint8_t motor_num)
         }
         default : break;
     }
+    __set_PRIMASK(primask);
 }
 
 /**
- * @brief       õٶ
- * @param       speed  : װֵС
- * @param       Channel: öʱͨ
- * @retval      
+ * @brief       设置电机速度
+ * @param       speed  : 设置重装载值大小
+ * @param       Channel: 设置定时器通道
+ * @retval      无
 */
 void stepper_pwmt_speed(uint16_t speed,uint32_t Channel)
 {
@@ -215,3 +663,109 @@ void stepper_pwmt_speed(uint16_t speed,uint32_t Channel)
     __HAL_TIM_SetCompare(&g_atimx_handle,Channel,__HAL_TIM_GET_AUTORELOAD(&g_atimx_handle)>>1);
 }
 
+/**
+ * @brief       获取电机对应的定时器通道
+ * @param       motor_num: 步进电机接口序号
+ * @retval      定时器通道
+ */
+uint32_t stepper_get_channel(uint8_t motor_num)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return ATIM_TIMX_PWM_CH1;
+    }
+    
+    return g_stepper_channel[motor_num - 1];
+}
+
+/**
+ * @brief       电机是否在运行
+ * @param       motor_num: 步进电机接口序号
+ * @retval      0: 停止; 1: 运行中
+ */
+uint8_t stepper_is_running(uint8_t motor_num)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return 0;
+    }
+    
+    return (g_stepper_axis[motor_num - 1].step != 0) ? 1 : 0;
+}
+
+/**
+ * @brief       读取限位开关
+ * @param       motor_num: 步进电机接口序号
+ * @retval      0: 未触发; 1: 触发
+ */
+uint8_t stepper_endstop(uint8_t motor_num)
+{
+    switch (motor_num)
+    {
+        case STEPPER_MOTOR_1: return ST1_ENDSTOP() ? 1 : 0;
+        case STEPPER_MOTOR_2: return ST2_ENDSTOP() ? 1 : 0;
+        case STEPPER_MOTOR_3: return ST3_ENDSTOP() ? 1 : 0;
+        case STEPPER_MOTOR_4: return ST4_ENDSTOP() ? 1 : 0;
+        default: return 0;
+    }
+}
+
+/**
+ * @brief       获取当前位置
+ * @param       motor_num: 步进电机接口序号
+ * @retval      当前位置, 单位: 步
+ */
+int32_t stepper_get_pos(uint8_t motor_num)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return 0;
+    }
+    
+    return g_stepper_axis[motor_num - 1].pos;
+}
+
+/**
+ * @brief       设置当前位置(电机停止时调用)
+ * @param       motor_num: 步进电机接口序号
+ * @param       pos      : 新的位置, 单位: 步
+ * @retval      无
+ */
+void stepper_set_pos(uint8_t motor_num, int32_t pos)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return;
+    }
+    
+    g_stepper_axis[motor_num - 1].pos = pos;
+    g_stepper_axis[motor_num - 1].pitch = stepper_comp_pitch(motor_num - 1, pos);  /* 以新位置的误差为基准, 不产生跳变 */
+    stepper_verify_sync(motor_num - 1);                             /* 丢步检测以新位置为基准 */
+}
+
+/**
+ * @brief       设置软限位
+ * @param       motor_num: 步进电机接口序号
+ * @param       min      : 下限, 单位: 步
+ * @param       max      : 上限, 单位: 步
+ * @param       en       : 0, 关闭软限位; 1, 使能软限位
+ * @retval      STEPPER_EOK   : 设置成功
+ *              STEPPER_EINVAL: 参数错误
+ */
+uint8_t stepper_set_soft_limit(uint8_t motor_num, int32_t min, int32_t max, uint8_t en)
+{
+    stepper_axis_t *axis;
+    
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4) || (min >= max))
+    {
+        return STEPPER_EINVAL;
+    }
+    
+    axis = &g_stepper_axis[motor_num - 1];
+    axis->limit_en = 0;                                             /* 修改期间先关闭检测 */
+    axis->soft_min = min;
+    axis->soft_max = max;
+    axis->limit_en = en;
+    
+    return STEPPER_EOK;
+}
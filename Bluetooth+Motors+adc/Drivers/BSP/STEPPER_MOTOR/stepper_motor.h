@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        stepper_motor.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief        
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       步进电机 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ STM32F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 STM32F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -25,99 +25,152 @@
 #define __STEPPER_MOTOR_H
 
 #include "./SYSTEM/sys/sys.h"
+#include "./BSP/KEY/key.h"
 
 /******************************************************************************************/
-/* Ŷ*/
+/* 步进电机引脚定义*/
 
-#define STEPPER_MOTOR_1       1              /* ӿ */
+#define STEPPER_MOTOR_1       1              /* 步进电机接口序号 */
 #define STEPPER_MOTOR_2       2
 #define STEPPER_MOTOR_3       3
 #define STEPPER_MOTOR_4       4
-/*     Ŷ     */
+#define STEPPER_AXIS_NUM      4              /* 步进电机轴数 */
+
+#define STEPPER_DIR_NEG       0              /* 负方向(上升/回零方向) */
+#define STEPPER_DIR_POS       1              /* 正方向(下探方向) */
+#define STEPPER_DIR_NONE      0xFF           /* 上电后尚未运动 */
+/*     步进电机方向引脚定义     */
 
 #define STEPPER_DIR1_GPIO_PIN                  GPIO_PIN_14
 #define STEPPER_DIR1_GPIO_PORT                 GPIOF
-#define STEPPER_DIR1_GPIO_CLK_ENABLE()         do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PFʱʹ */
+#define STEPPER_DIR1_GPIO_CLK_ENABLE()         do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PF口时钟使能 */
 
 #define STEPPER_DIR2_GPIO_PIN                  GPIO_PIN_12
 #define STEPPER_DIR2_GPIO_PORT                 GPIOF
-#define STEPPER_DIR2_GPIO_CLK_ENABLE()         do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PFʱʹ */
+#define STEPPER_DIR2_GPIO_CLK_ENABLE()         do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PF口时钟使能 */
 
 #define STEPPER_DIR3_GPIO_PIN                  GPIO_PIN_2
 #define STEPPER_DIR3_GPIO_PORT                 GPIOB
-#define STEPPER_DIR3_GPIO_CLK_ENABLE()         do{  __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)    /* PBʱʹ */
+#define STEPPER_DIR3_GPIO_CLK_ENABLE()         do{  __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)    /* PB口时钟使能 */
 
 #define STEPPER_DIR4_GPIO_PIN                  GPIO_PIN_2
 #define STEPPER_DIR4_GPIO_PORT                 GPIOH
-#define STEPPER_DIR4_GPIO_CLK_ENABLE()         do{  __HAL_RCC_GPIOH_CLK_ENABLE(); }while(0)    /* PHʱʹ */
+#define STEPPER_DIR4_GPIO_CLK_ENABLE()         do{  __HAL_RCC_GPIOH_CLK_ENABLE(); }while(0)    /* PH口时钟使能 */
 
-/*     ѻŶ     */
+/*     步进电机脱机引脚定义     */
 
 #define STEPPER_EN1_GPIO_PIN                   GPIO_PIN_15
 #define STEPPER_EN1_GPIO_PORT                  GPIOF
-#define STEPPER_EN1_GPIO_CLK_ENABLE()          do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PFʱʹ */
+#define STEPPER_EN1_GPIO_CLK_ENABLE()          do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PF口时钟使能 */
 
 #define STEPPER_EN2_GPIO_PIN                   GPIO_PIN_13
 #define STEPPER_EN2_GPIO_PORT                  GPIOF
-#define STEPPER_EN2_GPIO_CLK_ENABLE()          do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PFʱʹ */
+#define STEPPER_EN2_GPIO_CLK_ENABLE()          do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PF口时钟使能 */
 
 #define STEPPER_EN3_GPIO_PIN                   GPIO_PIN_11
 #define STEPPER_EN3_GPIO_PORT                  GPIOF
-#define STEPPER_EN3_GPIO_CLK_ENABLE()          do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PFʱʹ */
+#define STEPPER_EN3_GPIO_CLK_ENABLE()          do{  __HAL_RCC_GPIOF_CLK_ENABLE(); }while(0)    /* PF口时钟使能 */
  
 #define STEPPER_EN4_GPIO_PIN                   GPIO_PIN_3
 #define STEPPER_EN4_GPIO_PORT                  GPIOH
-#define STEPPER_EN4_GPIO_CLK_ENABLE()          do{  __HAL_RCC_GPIOH_CLK_ENABLE(); }while(0)    /* PHʱʹ */
-
-/*----------------------- ſ -----------------------------------*/
-/* ʹõǹⷨӲԵƽȡԵ x = 1 Чx = 0ʱЧ*/  
-#define ST1_DIR(x)    do{ x ? \
-                              HAL_GPIO_WritePin(STEPPER_DIR1_GPIO_PORT, STEPPER_DIR1_GPIO_PIN, GPIO_PIN_SET) : \
-                              HAL_GPIO_WritePin(STEPPER_DIR1_GPIO_PORT, STEPPER_DIR1_GPIO_PIN, GPIO_PIN_RESET); \
-                          }while(0)  
-
-#define ST2_DIR(x)    do{ x ? \
-                              HAL_GPIO_WritePin(STEPPER_DIR2_GPIO_PORT, STEPPER_DIR2_GPIO_PIN, GPIO_PIN_SET) : \
-                              HAL_GPIO_WritePin(STEPPER_DIR2_GPIO_PORT, STEPPER_DIR2_GPIO_PIN, GPIO_PIN_RESET); \
-                          }while(0)  
-
-#define ST3_DIR(x)    do{ x ? \
-                              HAL_GPIO_WritePin(STEPPER_DIR3_GPIO_PORT, STEPPER_DIR3_GPIO_PIN, GPIO_PIN_SET) : \
-                              HAL_GPIO_WritePin(STEPPER_DIR3_GPIO_PORT, STEPPER_DIR3_GPIO_PIN, GPIO_PIN_RESET); \
-                          }while(0)  
-
-#define ST4_DIR(x)    do{ x ? \
-                              HAL_GPIO_WritePin(STEPPER_DIR4_GPIO_PORT, STEPPER_DIR4_GPIO_PIN, GPIO_PIN_SET) : \
-                              HAL_GPIO_WritePin(STEPPER_DIR4_GPIO_PORT, STEPPER_DIR4_GPIO_PIN, GPIO_PIN_RESET); \
-                          }while(0)  
-
-/*----------------------- ѻſ -----------------------------------*/
-/* ʹõǹⷨӲԵƽȡԵ x = 1 Чx = 0ʱЧ*/                       
-#define ST1_EN(x)      do{ x ? \
-                          HAL_GPIO_WritePin(STEPPER_EN1_GPIO_PORT, STEPPER_EN1_GPIO_PIN, GPIO_PIN_SET) : \
-                          HAL_GPIO_WritePin(STEPPER_EN1_GPIO_PORT, STEPPER_EN1_GPIO_PIN, GPIO_PIN_RESET); \
-                        }while(0)    
-
-#define ST2_EN(x)      do{ x ? \
-                          HAL_GPIO_WritePin(STEPPER_EN2_GPIO_PORT, STEPPER_EN2_GPIO_PIN, GPIO_PIN_SET) : \
-                          HAL_GPIO_WritePin(STEPPER_EN2_GPIO_PORT, STEPPER_EN2_GPIO_PIN, GPIO_PIN_RESET); \
-                        }while(0)    
-
-#define ST3_EN(x)      do{ x ? \
-                          HAL_GPIO_WritePin(STEPPER_EN3_GPIO_PORT, STEPPER_EN3_GPIO_PIN, GPIO_PIN_SET) : \
-                          HAL_GPIO_WritePin(STEPPER_EN3_GPIO_PORT, STEPPER_EN3_GPIO_PIN, GPIO_PIN_RESET); \
-                        }while(0)    
-
-#define ST4_EN(x)      do{ x ? \
-                          HAL_GPIO_WritePin(STEPPER_EN4_GPIO_PORT, STEPPER_EN4_GPIO_PIN, GPIO_PIN_SET) : \
-                          HAL_GPIO_WritePin(STEPPER_EN4_GPIO_PORT, STEPPER_EN4_GPIO_PIN, GPIO_PIN_RESET); \
-                        }while(0)                            
-                        
+#define STEPPER_EN4_GPIO_CLK_ENABLE()          do{  __HAL_RCC_GPIOH_CLK_ENABLE(); }while(0)    /* PH口时钟使能 */
+
+/*----------------------- 引脚描述符 -----------------------------------*/
+/* 端口, 引脚, 有效电平; 由SYS_IO_xxx()宏直接写BSRR, 可在中断中使用 */
+#define STEPPER_DIR1_IO         STEPPER_DIR1_GPIO_PORT, STEPPER_DIR1_GPIO_PIN, 1
+#define STEPPER_DIR2_IO         STEPPER_DIR2_GPIO_PORT, STEPPER_DIR2_GPIO_PIN, 1
+#define STEPPER_DIR3_IO         STEPPER_DIR3_GPIO_PORT, STEPPER_DIR3_GPIO_PIN, 1
+#define STEPPER_DIR4_IO         STEPPER_DIR4_GPIO_PORT, STEPPER_DIR4_GPIO_PIN, 1
+
+#define STEPPER_EN1_IO          STEPPER_EN1_GPIO_PORT, STEPPER_EN1_GPIO_PIN, 1      /* 高电平脱机 */
+#define STEPPER_EN2_IO          STEPPER_EN2_GPIO_PORT, STEPPER_EN2_GPIO_PIN, 1
+#define STEPPER_EN3_IO          STEPPER_EN3_GPIO_PORT, STEPPER_EN3_GPIO_PIN, 1
+#define STEPPER_EN4_IO          STEPPER_EN4_GPIO_PORT, STEPPER_EN4_GPIO_PIN, 1
+
+/*----------------------- 方向引脚控制 -----------------------------------*/
+/* 由于我们使用的是共阳极解法，并且硬件对电平做了取反操作，所以当 x = 1 有效，x = 0时无效*/  
+#define ST1_DIR(x)    do{ SYS_IO_WRITE(STEPPER_DIR1_IO, x); }while(0)
+#define ST2_DIR(x)    do{ SYS_IO_WRITE(STEPPER_DIR2_IO, x); }while(0)
+#define ST3_DIR(x)    do{ SYS_IO_WRITE(STEPPER_DIR3_IO, x); }while(0)
+#define ST4_DIR(x)    do{ SYS_IO_WRITE(STEPPER_DIR4_IO, x); }while(0)
+
+/*----------------------- 脱机引脚控制 -----------------------------------*/
+/* 由于我们使用的是共阳极解法，并且硬件对电平做了取反操作，所以当 x = 1 有效，x = 0时无效*/                       
+#define ST1_EN(x)     do{ SYS_IO_WRITE(STEPPER_EN1_IO, x); }while(0)
+#define ST2_EN(x)     do{ SYS_IO_WRITE(STEPPER_EN2_IO, x); }while(0)
+#define ST3_EN(x)     do{ SYS_IO_WRITE(STEPPER_EN3_IO, x); }while(0)
+#define ST4_EN(x)     do{ SYS_IO_WRITE(STEPPER_EN4_IO, x); }while(0)
+
+/*----------------------- 限位开关定义 -----------------------------------*/
+/* 暂用板载KEY0~KEY2作为电机1~3的原点限位开关, 低电平表示触发; 电机4没有限位开关 */
+#define ST1_ENDSTOP()   SYS_IO_ACTIVE(KEY0_IO)
+#define ST2_ENDSTOP()   SYS_IO_ACTIVE(KEY1_IO)
+#define ST3_ENDSTOP()   SYS_IO_ACTIVE(KEY2_IO)
+#define ST4_ENDSTOP()   (0)
+
+/* 软限位默认值, 单位: 步, 回零之后才生效 */
+#define STEPPER_SOFT_MIN_DEFAULT        0
+#define STEPPER_SOFT_MAX_DEFAULT        160000
+
+/* 错误代码 */
+#define STEPPER_EOK         0               /* 没有错误 */
+#define STEPPER_ERROR       1               /* 错误 */
+#define STEPPER_ETIMEOUT    2               /* 超时错误 */
+#define STEPPER_EINVAL      3               /* 参数错误 */
+#define STEPPER_ELIMIT      4               /* 超出软限位 */
+#define STEPPER_ESTOP       5               /* 急停锁定中 */
+#define STEPPER_ESTOPPED    6               /* 启动途中被stepper_stop()取消 */
+
+/* 加减速表, 由stepper_ramp_build()在启动前生成, 步进中断只查表不做除法 */
+#define STEPPER_RAMP_LEN    64              /* 加减速表最大长度 */
+
+typedef struct
+{
+    uint16_t arr[STEPPER_RAMP_LEN];         /* 第(i << shift)步使用的重装载值, arr[0]最慢 */
+    uint16_t len;                           /* 有效长度 */
+    uint8_t shift;                          /* 步数到表下标的右移位数 */
+} stepper_ramp_t;
+
+/* 步进电机轴状态结构体, 由TIM8更新中断维护 */
+typedef struct
+{
+    volatile int32_t pos;                   /* 当前绝对位置, 单位: 步 */
+    volatile int32_t mpos;                  /* 实际输出的脉冲计数(含补偿脉冲), 用于丢步检测 */
+    volatile uint32_t remain;               /* 定长运动剩余步数, 0表示连续运行 */
+    volatile uint16_t comp;                 /* 待输出的补偿脉冲数, 这些脉冲不改变pos */
+    volatile uint16_t lash;                 /* comp中属于反向间隙的部分; 停止后为last_dir方向还没走完的间隙 */
+    volatile int16_t pitch;                 /* 已施加的螺距补偿量, 单位: 步 */
+    uint8_t last_dir;                       /* 上一次运动方向, 用于反向间隙补偿 */
+    volatile int8_t step;                   /* 每个脉冲的位置增量, +1/-1, 0表示停止 */
+    volatile uint8_t seek;                  /* 1: 限位开关触发时停止(回零用) */
+    volatile uint8_t endstop_hit;           /* 限位开关触发标志 */
+    volatile uint8_t limit_hit;             /* 软限位触发标志 */
+    const stepper_ramp_t *volatile ramp;    /* 加减速表, NULL表示匀速 */
+    volatile uint32_t total;                /* 定长运动总步数 */
+    int32_t soft_min;                       /* 软限位下限 */
+    int32_t soft_max;                       /* 软限位上限 */
+    uint8_t limit_en;                       /* 软限位使能 */
+    uint8_t homed;                          /* 已回零标志 */
+    volatile uint8_t stops;                 /* stepper_stop()调用计数, 启动途中变化时放弃启动 */
+} stepper_axis_t;
+
+extern stepper_axis_t g_stepper_axis[STEPPER_AXIS_NUM];
 
 /******************************************************************************************/
-/* ⲿӿں*/
-void stepper_init(uint16_t arr, uint16_t psc);              /* ӿڳʼ */
-void stepper_star(uint8_t motor_num, uint8_t dir);                       /*  */
-void stepper_stop(uint8_t motor_num);                       /* رղ */        
-void stepper_pwmt_speed(uint16_t speed,uint32_t Channel);   /* ٶ */                                                
+/* 外部接口函数*/
+void stepper_init(uint16_t arr, uint16_t psc);              /* 步进电机接口初始化 */
+uint8_t stepper_star(uint8_t motor_num, uint8_t dir);       /* 开启步进电机 */
+uint8_t stepper_move_steps(uint8_t motor_num, uint8_t dir, uint32_t steps); /* 步进电机定长运动 */
+uint8_t stepper_move_ramp(uint8_t motor_num, uint8_t dir, uint32_t steps, const stepper_ramp_t *ramp); /* 带加减速的定长运动 */
+void stepper_stop(uint8_t motor_num);                       /* 关闭步进电机 */        
+void stepper_pwmt_speed(uint16_t speed,uint32_t Channel);   /* 设置速度 */                                                
+uint32_t stepper_get_channel(uint8_t motor_num);            /* 获取电机对应的定时器通道 */
+uint8_t stepper_is_running(uint8_t motor_num);              /* 电机是否在运行 */
+uint8_t stepper_endstop(uint8_t motor_num);                 /* 读取限位开关 */
+int32_t stepper_get_pos(uint8_t motor_num);                 /* 获取当前位置 */
+void stepper_set_pos(uint8_t motor_num, int32_t pos);       /* 设置当前位置 */
+uint8_t stepper_set_soft_limit(uint8_t motor_num, int32_t min, int32_t max, uint8_t en); /* 设置软限位 */
+void stepper_estop_isr(void);                               /* 急停, 关闭所有驱动器和PWM输出 */
+void stepper_estop_release(void);                           /* 解除急停锁定 */
+uint8_t stepper_estop_latched(void);                        /* 是否处于急停锁定 */
 #endif
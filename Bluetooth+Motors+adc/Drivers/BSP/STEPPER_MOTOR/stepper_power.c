@@ -0,0 +1,271 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_power.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机驱动器电源管理 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/STEPPER_MOTOR/stepper_power.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./SYSTEM/delay/delay.h"
+
+
+static stepper_power_t g_stepper_power[STEPPER_AXIS_NUM];   /* 各轴电源管理状态 */
+static uint32_t g_stepper_power_start;                      /* 统计起始时刻 */
+
+/**
+ * @brief       设置EN(脱机)引脚
+ * @param       index: 轴下标, 0~3
+ * @param       en   : 1, 使能驱动器; 0, 关闭驱动器
+ * @retval      无
+ */
+static void stepper_power_pin(uint8_t index, uint8_t en)
+{
+    switch (index)
+    {
+        case 0: ST1_EN(!en); break;     /* EN = 1时驱动器脱机 */
+        case 1: ST2_EN(!en); break;
+        case 2: ST3_EN(!en); break;
+        case 3: ST4_EN(!en); break;
+        default: break;
+    }
+}
+
+/**
+ * @brief       电源管理初始化, 关闭所有驱动器
+ * @note        由stepper_init()调用
+ * @param       无
+ * @retval      无
+ */
+void stepper_power_init(void)
+{
+    uint8_t i;
+
+    g_stepper_power_start = HAL_GetTick();
+
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        stepper_power_pin(i, 0);
+        g_stepper_power[i].enabled = 0;
+        g_stepper_power[i].idle_ms = STEPPER_POWER_IDLE_MS;
+        g_stepper_power[i].last_active = g_stepper_power_start;
+        g_stepper_power[i].on_since = g_stepper_power_start;
+        g_stepper_power[i].on_ms = 0;
+    }
+}
+
+/**
+ * @brief       使能/关闭驱动器
+ * @note        状态和EN引脚在关中断下一起修改, 不会与急停中断交错; 急停锁定中不允许使能,
+ *              此时按关闭处理. 关闭时总是重写EN引脚, 可用于确保驱动器已失能
+ * @param       motor_num: 步进电机接口序号
+ * @param       en       : 1, 使能; 0, 关闭
+ * @retval      0: 驱动器关闭; 1: 驱动器使能
+ */
+uint8_t stepper_power_enable(uint8_t motor_num, uint8_t en)
+{
+    stepper_power_t *pwr;
+    uint32_t now;
+    uint32_t primask;
+
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return 0;
+    }
+
+    pwr = &g_stepper_power[motor_num - 1];
+    now = HAL_GetTick();
+    en = en ? 1 : 0;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (stepper_estop_latched() != 0)                               /* 急停锁定中所有EN保持无效 */
+    {
+        en = 0;
+    }
+
+    if (pwr->enabled != en)
+    {
+        if (en)
+        {
+            pwr->on_since = now;
+            pwr->last_active = now;
+        }
+        else
+        {
+            pwr->on_ms += now - pwr->on_since;
+        }
+
+        pwr->enabled = en;
+    }
+
+    stepper_power_pin(motor_num - 1, en);
+    __set_PRIMASK(primask);
+
+    return en;
+}
+
+/**
+ * @brief       启动前唤醒驱动器
+ * @note        驱动器已经关闭时重新使能, 并等待STEPPER_POWER_SETTLE_MS再返回
+ * @param       motor_num: 步进电机接口序号
+ * @retval      无
+ */
+void stepper_power_wake(uint8_t motor_num)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return;
+    }
+
+    g_stepper_power[motor_num - 1].last_active = HAL_GetTick();
+
+    if ((g_stepper_power[motor_num - 1].enabled == 0) && (stepper_power_enable(motor_num, 1) != 0))
+    {
+        delay_ms(STEPPER_POWER_SETTLE_MS);                          /* 等待驱动器稳定 */
+    }
+}
+
+/**
+ * @brief       驱动器已被强制关闭
+ * @note        急停中断已直接把EN引脚置为关闭, 这里只同步状态和统计
+ * @param       无
+ * @retval      无
+ */
+void stepper_power_lost(void)
+{
+    uint8_t i;
+    uint32_t now = HAL_GetTick();
+
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        if (g_stepper_power[i].enabled)
+        {
+            g_stepper_power[i].on_ms += now - g_stepper_power[i].on_since;
+            g_stepper_power[i].enabled = 0;
+        }
+    }
+}
+
+/**
+ * @brief       空闲检测, 在主循环中调用
+ * @note        运行中的轴刷新活动时刻, 停止超过空闲时间的轴关闭驱动器
+ * @param       无
+ * @retval      无
+ */
+void stepper_power_poll(void)
+{
+    uint8_t i;
+    uint32_t now = HAL_GetTick();
+    stepper_power_t *pwr;
+
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        pwr = &g_stepper_power[i];
+
+        if (stepper_is_running(i + 1))
+        {
+            pwr->last_active = now;
+            continue;
+        }
+
+        if (pwr->enabled && (pwr->idle_ms != 0) && ((now - pwr->last_active) >= pwr->idle_ms))
+        {
+            stepper_power_enable(i + 1, 0);
+        }
+    }
+}
+
+/**
+ * @brief       设置空闲关闭时间
+ * @param       motor_num: 步进电机接口序号
+ * @param       idle_ms  : 空闲关闭时间, 单位: ms, 0表示一直保持使能
+ * @retval      无
+ */
+void stepper_power_set_idle(uint8_t motor_num, uint32_t idle_ms)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return;
+    }
+
+    g_stepper_power[motor_num - 1].idle_ms = idle_ms;
+}
+
+/**
+ * @brief       驱动器是否使能
+ * @param       motor_num: 步进电机接口序号
+ * @retval      0: 关闭; 1: 使能
+ */
+uint8_t stepper_power_is_enabled(uint8_t motor_num)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return 0;
+    }
+
+    return g_stepper_power[motor_num - 1].enabled;
+}
+
+/**
+ * @brief       获取驱动器使能时间占比
+ * @param       motor_num: 步进电机接口序号
+ * @retval      自上次清除统计以来的使能时间占比, 单位: 千分比
+ */
+uint16_t stepper_power_get_duty(uint8_t motor_num)
+{
+    stepper_power_t *pwr;
+    uint32_t now = HAL_GetTick();
+    uint32_t total;
+    uint32_t on;
+
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return 0;
+    }
+
+    pwr = &g_stepper_power[motor_num - 1];
+    total = now - g_stepper_power_start;
+    if (total == 0)
+    {
+        return pwr->enabled ? 1000 : 0;
+    }
+
+    on = pwr->on_ms;
+    if (pwr->enabled)
+    {
+        on += now - pwr->on_since;
+    }
+
+    return (uint16_t)(((uint64_t)on * 1000) / total);
+}
+
+/**
+ * @brief       清除使能时间统计
+ * @param       无
+ * @retval      无
+ */
+void stepper_power_reset_stats(void)
+{
+    uint8_t i;
+
+    g_stepper_power_start = HAL_GetTick();
+
+    for (i = 0; i < STEPPER_AXIS_NUM; i++)
+    {
+        g_stepper_power[i].on_ms = 0;
+        g_stepper_power[i].on_since = g_stepper_power_start;
+    }
+}
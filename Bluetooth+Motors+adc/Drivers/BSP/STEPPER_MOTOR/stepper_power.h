@@ -0,0 +1,59 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_power.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机驱动器电源管理 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 通过EN(脱机)引脚管理驱动器保持电流:
+ * 1, 电机停止超过空闲时间后自动关闭驱动器, 不再保持满电流
+ * 2, 下一次启动前重新使能驱动器, 并等待驱动器稳定后再输出脉冲
+ * 3, 统计各轴驱动器使能时间占比(千分比), 用于评估电池续航
+ * 空闲时间设为0表示该轴一直保持使能(例如需要保持力矩的轴)
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STEPPER_POWER_H
+#define __STEPPER_POWER_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 电源管理参数定义 */
+
+#define STEPPER_POWER_IDLE_MS           2000        /* 默认空闲关闭时间, 单位: ms */
+#define STEPPER_POWER_SETTLE_MS         5           /* 驱动器使能后的稳定时间, 单位: ms */
+
+/* 单轴电源管理状态 */
+typedef struct
+{
+    uint8_t enabled;                        /* 驱动器是否使能 */
+    uint32_t idle_ms;                       /* 空闲关闭时间, 0表示不自动关闭 */
+    uint32_t last_active;                   /* 最近一次运行的时刻 */
+    uint32_t on_since;                      /* 本次使能的起始时刻 */
+    uint32_t on_ms;                         /* 已结束的使能时间累计 */
+} stepper_power_t;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void stepper_power_init(void);                                          /* 电源管理初始化, 所有驱动器关闭 */
+uint8_t stepper_power_enable(uint8_t motor_num, uint8_t en);            /* 使能/关闭驱动器, 急停锁定中不能使能 */
+void stepper_power_wake(uint8_t motor_num);                             /* 启动前唤醒驱动器 */
+void stepper_power_lost(void);                                          /* 驱动器已被强制关闭(急停) */
+void stepper_power_poll(void);                                          /* 空闲检测, 在主循环中调用 */
+void stepper_power_set_idle(uint8_t motor_num, uint32_t idle_ms);       /* 设置空闲关闭时间 */
+uint8_t stepper_power_is_enabled(uint8_t motor_num);                    /* 驱动器是否使能 */
+uint16_t stepper_power_get_duty(uint8_t motor_num);                     /* 获取使能时间占比, 单位: 千分比 */
+void stepper_power_reset_stats(void);                                   /* 清除统计 */
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_ramp.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机加减速及回撤 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/STEPPER_MOTOR/stepper_ramp.h"
+#include "./BSP/STEPPER_MOTOR/stepper_unit.h"
+#include <math.h>
+
+
+static stepper_ramp_t g_retract_ramp;                       /* 回撤用加减速表 */
+
+/**
+ * @brief       生成恒加速度的加减速表
+ * @note        v(i)^2 = v0^2 + (v1^2 - v0^2) * i / (len - 1), 只在启动运动前调用,
+ *              浮点运算和除法都在这里完成
+ * @param       ramp       : 加减速表
+ * @param       arr_start  : 起步速度对应的重装载值
+ * @param       arr_run    : 最高速度对应的重装载值, 不大于arr_start
+ * @param       accel_steps: 从起步速度加速到最高速度的步数
+ * @retval      STEPPER_EOK   : 生成成功
+ *              STEPPER_EINVAL: 参数错误
+ */
+uint8_t stepper_ramp_build(stepper_ramp_t *ramp, uint16_t arr_start, uint16_t arr_run, uint32_t accel_steps)
+{
+    uint16_t i;
+    float f0, f1, f;
+    float frac;
+    uint32_t arr;
+
+    if ((ramp == NULL) || (arr_run > arr_start) || (arr_run < STEPPER_UNIT_ARR_MIN))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    ramp->shift = 0;
+    while ((accel_steps >> ramp->shift) >= STEPPER_RAMP_LEN)
+    {
+        ramp->shift++;
+    }
+    ramp->len = (accel_steps >> ramp->shift) + 1;
+
+    f0 = (float)STEPPER_UNIT_TICK_HZ / (arr_start + 1);         /* 起步频率 */
+    f1 = (float)STEPPER_UNIT_TICK_HZ / (arr_run + 1);           /* 最高频率 */
+
+    for (i = 0; i < ramp->len; i++)
+    {
+        frac = (ramp->len > 1) ? (float)i / (ramp->len - 1) : 1.0f;
+        f = sqrtf(f0 * f0 + (f1 * f1 - f0 * f0) * frac);
+        arr = (uint32_t)((float)STEPPER_UNIT_TICK_HZ / f + 0.5f) - 1;
+        ramp->arr[i] = (arr > arr_start) ? arr_start : ((arr < arr_run) ? arr_run : (uint16_t)arr);
+    }
+
+    return STEPPER_EOK;
+}
+
+/**
+ * @brief       带加减速返回到目标位置
+ * @note        立即返回, 运动在TIM8中断中完成, 可以用stepper_is_running()查询,
+ *              用stepper_stop()中止
+ * @param       motor_num: 步进电机接口序号
+ * @param       target   : 目标位置, 单位: 步
+ * @retval      同stepper_move_ramp(), 已在目标位置时返回STEPPER_EOK
+ */
+uint8_t stepper_retract(uint8_t motor_num, int32_t target)
+{
+    int32_t steps;
+
+    if (g_retract_ramp.len == 0)                                /* 第一次使用时生成 */
+    {
+        stepper_ramp_build(&g_retract_ramp, STEPPER_RETRACT_START_ARR, STEPPER_RETRACT_RUN_ARR, STEPPER_RETRACT_ACCEL_STEPS);
+    }
+
+    stepper_stop(motor_num);
+    steps = target - stepper_get_pos(motor_num);
+
+    if (steps == 0)
+    {
+        return STEPPER_EOK;
+    }
+
+    if (steps > 0)
+    {
+        return stepper_move_ramp(motor_num, STEPPER_DIR_POS, (uint32_t)steps, &g_retract_ramp);
+    }
+
+    return stepper_move_ramp(motor_num, STEPPER_DIR_NEG, (uint32_t)(-steps), &g_retract_ramp);
+}
@@ -0,0 +1,41 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_ramp.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机加减速及回撤 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 按恒加速度生成重装载值表, 表中第i项对应第(i << shift)步, 步进中断只做查表;
+ * 回撤在后台运行, 按下探时记录的起点位置以最高安全速度返回, 主循环不被阻塞.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STEPPER_RAMP_H
+#define __STEPPER_RAMP_H
+
+#include "./SYSTEM/sys/sys.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+
+/******************************************************************************************/
+/* 回撤参数定义 */
+
+#define STEPPER_RETRACT_START_ARR       999         /* 起步/停止速度, 1kHz */
+#define STEPPER_RETRACT_RUN_ARR         249         /* 最高安全速度, 4kHz */
+#define STEPPER_RETRACT_ACCEL_STEPS     800         /* 加速(减速)段步数 */
+
+/******************************************************************************************/
+/* 外部接口函数*/
+uint8_t stepper_ramp_build(stepper_ramp_t *ramp, uint16_t arr_start, uint16_t arr_run, uint32_t accel_steps); /* 生成加减速表 */
+uint8_t stepper_retract(uint8_t motor_num, int32_t target);                 /* 带加减速返回到目标位置, 不阻塞 */
+
+#endif
@@ -0,0 +1,207 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_scope.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进脉冲回环测试
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/STEPPER_MOTOR/stepper_scope.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./BSP/STEPPER_MOTOR/stepper_ramp.h"
+#include "./BSP/STEPPER_MOTOR/stepper_unit.h"
+#include "./BSP/TIMER/stepper_tim.h"
+#include "./BSP/TIMER/capture_tim.h"
+#include <math.h>
+
+
+#define STEPPER_SCOPE_RATIO     (GTIM_TIMX_CAP_HZ / STEPPER_UNIT_TICK_HZ)   /* 捕获计数 / TIM8计数 */
+
+stepper_scope_t g_stepper_scope;
+
+static uint32_t g_scope_edge[STEPPER_SCOPE_LEN];            /* 上升沿时间戳, 由DMA写入 */
+static uint16_t g_scope_plan[STEPPER_SCOPE_LEN];            /* 每个周期的计划重装载值 */
+static stepper_ramp_t g_scope_ramp;                         /* 测试用加减速表 */
+
+/* 直方图各格的|误差|上限, 单位: ns, 最后一格为其余 */
+static const uint32_t g_scope_hist_ns[STEPPER_SCOPE_HIST - 1] = {12, 50, 100, 500, 1000, 10000, 100000};
+
+/**
+ * @brief       初始化回环测试
+ * @param       无
+ * @retval      无
+ */
+void stepper_scope_init(void)
+{
+    g_stepper_scope.armed = 0;
+    g_stepper_scope.plan_cnt = 0;
+    gtim_timx_cap_init();
+}
+
+/**
+ * @brief       开始一次回环测试
+ * @note        要求所有电机都停止: 测试前把TIM8计数器清零, 保证第一个上升沿就是第一个周期的起点.
+ *              加减速表从STEPPER_RETRACT_START_ARR加速到arr_run, 加速段为总步数的1/4
+ * @param       steps  : 测试步数, 正数向下, 负数向上, 绝对值不超过STEPPER_SCOPE_LEN
+ * @param       arr_run: 最高速度对应的重装载值
+ * @retval      STEPPER_EOK   : 已开始
+ *              STEPPER_ERROR : 有电机正在运行
+ *              其他          : 同stepper_move_ramp()
+ */
+uint8_t stepper_scope_run(int32_t steps, uint16_t arr_run)
+{
+    uint8_t i;
+    uint8_t dir;
+    uint8_t ret;
+
+    dir = (steps > 0) ? STEPPER_DIR_POS : STEPPER_DIR_NEG;
+    steps = (steps > 0) ? steps : -steps;
+
+    if ((steps < 2) || (steps > STEPPER_SCOPE_LEN))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    for (i = STEPPER_MOTOR_1; i <= STEPPER_MOTOR_4; i++)
+    {
+        if (stepper_is_running(i))
+        {
+            return STEPPER_ERROR;
+        }
+    }
+
+    ret = stepper_ramp_build(&g_scope_ramp, STEPPER_RETRACT_START_ARR, arr_run, steps >> 2);
+    if (ret != STEPPER_EOK)
+    {
+        return ret;
+    }
+
+    g_stepper_scope.plan_cnt = 0;
+    gtim_timx_cap_start(g_scope_edge, STEPPER_SCOPE_LEN);
+    __HAL_TIM_SET_COUNTER(&g_atimx_handle, 0);                  /* 计数器停止时清零, 第一个周期完整输出 */
+    g_stepper_scope.armed = 1;
+
+    ret = stepper_move_ramp(STEPPER_SCOPE_AXIS, dir, steps, &g_scope_ramp);
+    if (ret != STEPPER_EOK)
+    {
+        g_stepper_scope.armed = 0;
+        gtim_timx_cap_stop();
+    }
+
+    return ret;
+}
+
+/**
+ * @brief       记录一个周期的计划值
+ * @note        在TIM8更新中断开头调用, 此时ARR还没有被修改, 就是刚结束的那个周期实际使用的值
+ * @param       arr: 刚结束的周期的重装载值
+ * @retval      无
+ */
+void stepper_scope_plan(uint16_t arr)
+{
+    if (g_stepper_scope.plan_cnt < STEPPER_SCOPE_LEN)
+    {
+        g_scope_plan[g_stepper_scope.plan_cnt++] = arr;
+    }
+}
+
+/**
+ * @brief       检查测试是否结束, 结束后统计结果
+ * @note        在主循环中调用. 第k个周期的实际间隔为第k+1和第k个上升沿之差,
+ *              计划间隔为(g_scope_plan[k] + 1) * STEPPER_SCOPE_RATIO个捕获计数
+ * @param       无
+ * @retval      0: 没有新结果; 1: 本次调用完成了统计, 结果在g_stepper_scope中
+ */
+uint8_t stepper_scope_poll(void)
+{
+    stepper_scope_t *r = &g_stepper_scope;
+    uint16_t k;
+    uint8_t b;
+    uint32_t meas;
+    uint32_t min_meas = 0xFFFFFFFF;
+    int32_t err;
+    uint32_t abs_err;
+    int64_t sum = 0;
+    int64_t sum_sq = 0;
+    float mean;
+    float var;
+
+    if ((r->armed == 0) || stepper_is_running(STEPPER_SCOPE_AXIS))
+    {
+        return 0;
+    }
+
+    r->armed = 0;
+    gtim_timx_cap_stop();
+
+    r->edges = gtim_timx_cap_count();
+    r->intervals = (r->edges > 0) ? (r->edges - 1) : 0;
+    if (r->intervals > r->plan_cnt)
+    {
+        r->intervals = r->plan_cnt;                                 /* 停止时多出的边沿不参与统计 */
+    }
+
+    r->max_err_ns = 0;
+    for (b = 0; b < STEPPER_SCOPE_HIST; b++)
+    {
+        r->hist[b] = 0;
+    }
+
+    for (k = 0; k < r->intervals; k++)
+    {
+        meas = g_scope_edge[k + 1] - g_scope_edge[k];
+        err = (int32_t)(meas - (g_scope_plan[k] + 1) * STEPPER_SCOPE_RATIO);
+        err = (int32_t)((int64_t)err * 1000000000 / GTIM_TIMX_CAP_HZ);     /* 计数 -> ns */
+
+        if (meas < min_meas)
+        {
+            min_meas = meas;
+        }
+
+        sum += err;
+        sum_sq += (int64_t)err * err;
+
+        abs_err = (err < 0) ? -err : err;
+        if (abs_err > (uint32_t)r->max_err_ns)
+        {
+            r->max_err_ns = (int32_t)abs_err;
+        }
+
+        for (b = 0; b < STEPPER_SCOPE_HIST - 1; b++)
+        {
+            if (abs_err <= g_scope_hist_ns[b])
+            {
+                break;
+            }
+        }
+        r->hist[b]++;
+    }
+
+    if ((r->intervals != 0) && (min_meas != 0))
+    {
+        mean = (float)sum / r->intervals;
+        var = (float)sum_sq / r->intervals - mean * mean;
+        r->mean_ns = (int32_t)mean;
+        r->jitter_ns = (var > 0.0f) ? (int32_t)sqrtf(var) : 0;
+        r->max_rate = GTIM_TIMX_CAP_HZ / min_meas;
+    }
+    else
+    {
+        r->mean_ns = 0;
+        r->jitter_ns = 0;
+        r->max_rate = 0;
+    }
+
+    return 1;
+}
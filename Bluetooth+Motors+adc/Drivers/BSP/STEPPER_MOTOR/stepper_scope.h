@@ -0,0 +1,61 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_scope.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进脉冲回环测试
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 测试方法: 用杜邦线把PI5(TIM8_CH1, 电机1的PUL)接到PA5(TIM2_CH1), 发送"scope"命令.
+ * 电机1按加减速表走一段定长运动, TIM2用DMA记录每个上升沿的时间戳, 同时TIM8更新中断
+ * 记录每个周期计划的重装载值. 运动结束后在主循环中逐个比较实际间隔和计划间隔,
+ * 统计间隔误差(均值/标准差/最大值)、误差分布直方图和实际达到的最高步频.
+ * 修改步进脉冲生成代码后用同样的参数重跑, 作为回归基准.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STEPPER_SCOPE_H
+#define __STEPPER_SCOPE_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 回环测试参数定义 */
+
+#define STEPPER_SCOPE_AXIS      1               /* 测试的电机, 脉冲输出为TIM8_CH1 */
+#define STEPPER_SCOPE_LEN       512             /* 最多记录的边沿数(步数) */
+#define STEPPER_SCOPE_HIST      8               /* 误差直方图的格数 */
+
+/* 测试结果 */
+typedef struct
+{
+    volatile uint8_t armed;                     /* 1: 正在记录 */
+    volatile uint16_t plan_cnt;                 /* 已记录的计划周期数 */
+    uint16_t edges;                             /* 捕获到的边沿数 */
+    uint16_t intervals;                         /* 参与统计的间隔数 */
+    uint32_t max_rate;                          /* 实际达到的最高步频, 单位: Hz */
+    int32_t mean_ns;                            /* 间隔误差均值, 单位: ns */
+    int32_t jitter_ns;                          /* 间隔误差标准差, 单位: ns */
+    int32_t max_err_ns;                         /* 间隔误差绝对值最大值, 单位: ns */
+    uint16_t hist[STEPPER_SCOPE_HIST];          /* |误差|分布, 各格上限: 12/50/100/500/1000/10000/100000ns/其余 */
+} stepper_scope_t;
+
+extern stepper_scope_t g_stepper_scope;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void stepper_scope_init(void);                                  /* 初始化捕获定时器 */
+uint8_t stepper_scope_run(int32_t steps, uint16_t arr_run);     /* 开始一次回环测试 */
+void stepper_scope_plan(uint16_t arr);                          /* 步进中断中记录一个周期的计划值 */
+uint8_t stepper_scope_poll(void);                               /* 主循环中调用, 测试结束时完成统计 */
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_unit.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机物理单位(微米)运动接口
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/STEPPER_MOTOR/stepper_unit.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+
+
+/* 各轴换算表, 编译时计算 */
+const stepper_unit_t g_stepper_unit[STEPPER_AXIS_NUM] =
+{
+    STEPPER_UNIT_ENTRY(STEPPER_AXIS1_FULL_STEPS, STEPPER_AXIS1_MICROSTEP, STEPPER_AXIS1_LEAD_UM),
+    STEPPER_UNIT_ENTRY(STEPPER_AXIS2_FULL_STEPS, STEPPER_AXIS2_MICROSTEP, STEPPER_AXIS2_LEAD_UM),
+    STEPPER_UNIT_ENTRY(STEPPER_AXIS3_FULL_STEPS, STEPPER_AXIS3_MICROSTEP, STEPPER_AXIS3_LEAD_UM),
+    STEPPER_UNIT_ENTRY(STEPPER_AXIS4_FULL_STEPS, STEPPER_AXIS4_MICROSTEP, STEPPER_AXIS4_LEAD_UM),
+};
+
+/**
+ * @brief       Q24定点乘法, 四舍五入
+ * @param       x: 被乘数
+ * @param       k: Q24系数
+ * @retval      x * k
+ */
+static int32_t stepper_unit_mul(int32_t x, uint32_t k)
+{
+    return (int32_t)(((int64_t)x * k + (1 << (STEPPER_UNIT_Q - 1))) >> STEPPER_UNIT_Q);
+}
+
+/**
+ * @brief       微米转换为步数
+ * @param       motor_num: 步进电机接口序号
+ * @param       um       : 距离, 单位: um
+ * @retval      步数
+ */
+int32_t stepper_um_to_steps(uint8_t motor_num, int32_t um)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return 0;
+    }
+
+    return stepper_unit_mul(um, g_stepper_unit[motor_num - 1].steps_per_um);
+}
+
+/**
+ * @brief       步数转换为微米
+ * @param       motor_num: 步进电机接口序号
+ * @param       steps    : 步数
+ * @retval      距离, 单位: um
+ */
+int32_t stepper_steps_to_um(uint8_t motor_num, int32_t steps)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4))
+    {
+        return 0;
+    }
+
+    return stepper_unit_mul(steps, g_stepper_unit[motor_num - 1].um_per_step);
+}
+
+/**
+ * @brief       速度转换为TIM8重装载值
+ * @note        周期 = 计数频率 * 微米/步 / 速度, 结果限制在ARR_MIN~ARR_MAX之间
+ * @param       motor_num: 步进电机接口序号
+ * @param       um_s     : 速度, 单位: um/s
+ * @retval      重装载值
+ */
+uint16_t stepper_speed_to_arr(uint8_t motor_num, uint32_t um_s)
+{
+    uint64_t period;
+
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4) || (um_s == 0))
+    {
+        return STEPPER_UNIT_ARR_MAX;
+    }
+
+    period = ((uint64_t)STEPPER_UNIT_TICK_HZ * g_stepper_unit[motor_num - 1].um_per_step / um_s) >> STEPPER_UNIT_Q;
+
+    if (period > (uint64_t)STEPPER_UNIT_ARR_MAX + 1)
+    {
+        return STEPPER_UNIT_ARR_MAX;
+    }
+
+    if (period < (uint64_t)STEPPER_UNIT_ARR_MIN + 1)
+    {
+        return STEPPER_UNIT_ARR_MIN;
+    }
+
+    return (uint16_t)(period - 1);
+}
+
+/**
+ * @brief       设置速度
+ * @param       motor_num: 步进电机接口序号
+ * @param       um_s     : 速度, 单位: um/s
+ * @retval      无
+ */
+void stepper_set_speed_um(uint8_t motor_num, uint32_t um_s)
+{
+    stepper_pwmt_speed(stepper_speed_to_arr(motor_num, um_s), stepper_get_channel(motor_num));
+}
+
+/**
+ * @brief       获取当前位置
+ * @param       motor_num: 步进电机接口序号
+ * @retval      当前位置, 单位: um
+ */
+int32_t stepper_get_pos_um(uint8_t motor_num)
+{
+    return stepper_steps_to_um(motor_num, stepper_get_pos(motor_num));
+}
+
+/**
+ * @brief       按步数增量运动
+ * @param       motor_num: 步进电机接口序号
+ * @param       steps    : 步数增量, 正数为正方向
+ * @param       um_s     : 速度, 单位: um/s
+ * @retval      同stepper_move_steps()
+ */
+static uint8_t stepper_unit_move(uint8_t motor_num, int32_t steps, uint32_t um_s)
+{
+    if (steps == 0)
+    {
+        return STEPPER_EOK;
+    }
+
+    stepper_set_speed_um(motor_num, um_s);
+
+    if (steps > 0)
+    {
+        return stepper_move_steps(motor_num, STEPPER_DIR_POS, (uint32_t)steps);
+    }
+
+    return stepper_move_steps(motor_num, STEPPER_DIR_NEG, (uint32_t)(-steps));
+}
+
+/**
+ * @brief       相对运动
+ * @param       motor_num: 步进电机接口序号
+ * @param       um       : 运动距离, 单位: um, 正数为正方向(下探)
+ * @param       um_s     : 速度, 单位: um/s
+ * @retval      STEPPER_EOK   : 启动成功(距离不足一步时不运动)
+ *              STEPPER_EINVAL: 参数错误
+ *              STEPPER_ELIMIT: 已到达该方向的软限位
+ *              STEPPER_ESTOP : 急停锁定中
+ */
+uint8_t stepper_move_um(uint8_t motor_num, int32_t um, uint32_t um_s)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4) || (um_s == 0))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    return stepper_unit_move(motor_num, stepper_um_to_steps(motor_num, um), um_s);
+}
+
+/**
+ * @brief       绝对运动
+ * @note        在步数域内求差, 多次运动不会累积换算误差
+ * @param       motor_num: 步进电机接口序号
+ * @param       um       : 目标位置, 单位: um
+ * @param       um_s     : 速度, 单位: um/s
+ * @retval      同stepper_move_um()
+ */
+uint8_t stepper_move_to_um(uint8_t motor_num, int32_t um, uint32_t um_s)
+{
+    if ((motor_num < STEPPER_MOTOR_1) || (motor_num > STEPPER_MOTOR_4) || (um_s == 0))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    return stepper_unit_move(motor_num, stepper_um_to_steps(motor_num, um) - stepper_get_pos(motor_num), um_s);
+}
@@ -0,0 +1,91 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_unit.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机物理单位(微米)运动接口
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 各轴的机构参数(整步数/圈, 细分数, 导程)在编译时确定, 由此预先算出Q24定点的
+ * 步/微米和微米/步两个系数, 换算只需一次乘法和移位, 步进中断中不做任何除法.
+ * 速度换算成定时器重装载值只在启动运动时做一次除法.
+ * 注意: 各轴共用TIM8的周期, 设置某一轴的速度会影响所有正在运行的轴.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STEPPER_UNIT_H
+#define __STEPPER_UNIT_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 各轴机构参数, 请按实际机构修改 */
+
+/* 电机1: 贯入轴(Z), 1.8°电机, 8细分(0.225°/步), 导程5mm */
+#define STEPPER_AXIS1_FULL_STEPS        200
+#define STEPPER_AXIS1_MICROSTEP         8
+#define STEPPER_AXIS1_LEAD_UM           5000
+
+/* 电机2: X轴 */
+#define STEPPER_AXIS2_FULL_STEPS        200
+#define STEPPER_AXIS2_MICROSTEP         8
+#define STEPPER_AXIS2_LEAD_UM           5000
+
+/* 电机3: Y轴 */
+#define STEPPER_AXIS3_FULL_STEPS        200
+#define STEPPER_AXIS3_MICROSTEP         8
+#define STEPPER_AXIS3_LEAD_UM           5000
+
+/* 电机4: 备用 */
+#define STEPPER_AXIS4_FULL_STEPS        200
+#define STEPPER_AXIS4_MICROSTEP         8
+#define STEPPER_AXIS4_LEAD_UM           5000
+
+#define STEPPER_UNIT_TICK_HZ            1000000     /* TIM8计数频率, 与stepper_init(arr, 168 - 1)对应 */
+#define STEPPER_UNIT_ARR_MIN            100         /* 最小重装载值, 即最高10kHz步进频率 */
+#define STEPPER_UNIT_ARR_MAX            0xFFFF      /* 最大重装载值 */
+
+/******************************************************************************************/
+
+#define STEPPER_UNIT_Q                  24          /* 定点小数位数 */
+
+/* 单轴换算参数, 全部为编译期常量 */
+typedef struct
+{
+    uint32_t steps_per_rev;                 /* 每圈步数 = 整步数 * 细分数 */
+    uint32_t lead_um;                       /* 导程, 单位: um */
+    uint32_t steps_per_um;                  /* 步/微米, Q24 */
+    uint32_t um_per_step;                   /* 微米/步, Q24 */
+} stepper_unit_t;
+
+/* 由机构参数生成换算表项 */
+#define STEPPER_UNIT_ENTRY(full, micro, lead)                                                   \
+    {                                                                                           \
+        (uint32_t)(full) * (micro),                                                             \
+        (uint32_t)(lead),                                                                       \
+        (uint32_t)((((uint64_t)(full) * (micro)) << STEPPER_UNIT_Q) / (lead)),                  \
+        (uint32_t)((((uint64_t)(lead)) << STEPPER_UNIT_Q) / ((uint64_t)(full) * (micro)))       \
+    }
+
+extern const stepper_unit_t g_stepper_unit[];
+
+/******************************************************************************************/
+/* 外部接口函数*/
+int32_t stepper_um_to_steps(uint8_t motor_num, int32_t um);                     /* 微米转换为步数 */
+int32_t stepper_steps_to_um(uint8_t motor_num, int32_t steps);                  /* 步数转换为微米 */
+uint16_t stepper_speed_to_arr(uint8_t motor_num, uint32_t um_s);                /* 速度转换为重装载值 */
+void stepper_set_speed_um(uint8_t motor_num, uint32_t um_s);                    /* 设置速度, 单位: um/s */
+int32_t stepper_get_pos_um(uint8_t motor_num);                                  /* 获取当前位置, 单位: um */
+uint8_t stepper_move_um(uint8_t motor_num, int32_t um, uint32_t um_s);          /* 相对运动, 单位: um */
+uint8_t stepper_move_to_um(uint8_t motor_num, int32_t um, uint32_t um_s);       /* 绝对运动, 单位: um */
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_verify.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机丢步检测 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/STEPPER_MOTOR/stepper_verify.h"
+#include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./BSP/TIMER/encoder_tim.h"
+
+
+stepper_verify_t g_stepper_verify = {0};                    /* 丢步检测状态 */
+static uint8_t g_stepper_verify_sat = 0;                    /* 力信号饱和积分, 0~100 */
+
+/**
+ * @brief       丢步检测初始化
+ * @note        需要在stepper_init()之后调用
+ * @param       无
+ * @retval      无
+ */
+void stepper_verify_init(void)
+{
+    g_stepper_verify.mode = STEPPER_VERIFY_MODE;
+
+    if (g_stepper_verify.mode == STEPPER_VERIFY_ENCODER)
+    {
+        gtim_timx_encoder_chy_init();                       /* 初始化编码器接口 */
+    }
+
+    stepper_verify_clear();
+    stepper_verify_sync(STEPPER_VERIFY_AXIS - 1);
+}
+
+/**
+ * @brief       以当前位置为基准重新同步
+ * @note        设置位置(回零)和检测到故障后调用, 之后的偏差从零开始计算
+ * @param       index: 轴下标, 0~3, 只有STEPPER_VERIFY_AXIS对应的轴有效
+ * @retval      无
+ */
+void stepper_verify_sync(uint8_t index)
+{
+    if (index != STEPPER_VERIFY_AXIS - 1)
+    {
+        return;
+    }
+
+    g_stepper_verify.base_pos = g_stepper_axis[index].mpos;
+    g_stepper_verify.base_cnt = (g_stepper_verify.mode == STEPPER_VERIFY_ENCODER) ? gtim_timx_encoder_get_count() : 0;
+    g_stepper_verify.sim_cnt = 0;
+    g_stepper_verify.sim_loss = 0;
+    g_stepper_verify.dev = 0;
+}
+
+/**
+ * @brief       比较指令步数和反馈步数
+ * @note        在TIM8更新中断中每走一步调用一次, 只有乘法和移位, 没有除法
+ * @param       index: 轴下标, 0~3
+ * @param       pos  : 当前指令脉冲计数(含间隙/螺距补偿脉冲)
+ * @param       step : 本步的方向, +1/-1
+ * @retval      0: 正常; 1: 偏差超限, 调用者需要停止该轴
+ */
+uint8_t stepper_verify_check(uint8_t index, int32_t pos, int8_t step)
+{
+    stepper_verify_t *v = &g_stepper_verify;
+    int32_t cmd;
+    int32_t fb;
+    int32_t dev;
+
+    if ((index != STEPPER_VERIFY_AXIS - 1) || (v->mode == STEPPER_VERIFY_OFF))
+    {
+        return 0;
+    }
+
+    cmd = pos - v->base_pos;
+
+    if (v->mode == STEPPER_VERIFY_ENCODER)
+    {
+        fb = (gtim_timx_encoder_get_count() - v->base_cnt) * STEPPER_VERIFY_ENC_DIR;
+        fb = (int32_t)(((int64_t)fb * STEPPER_VERIFY_STEPS_PER_COUNT + (1 << (STEPPER_UNIT_Q - 1))) >> STEPPER_UNIT_Q);
+    }
+    else
+    {
+        if ((v->sim_rate != 0) && (++v->sim_cnt >= v->sim_rate))  /* 模拟丢步 */
+        {
+            v->sim_cnt = 0;
+            v->sim_loss += step;
+        }
+        fb = cmd - v->sim_loss;
+    }
+
+    dev = cmd - fb;
+    v->dev = dev;
+    if (dev < 0)
+    {
+        dev = -dev;
+    }
+
+    if (dev > v->max_dev)
+    {
+        v->max_dev = dev;
+    }
+
+    if (dev > STEPPER_VERIFY_MAX_DEV)
+    {
+        v->fault_cmd = cmd;
+        v->fault_fb = fb;
+        v->fault = 1;
+        v->reported = 0;
+        stepper_verify_sync(index);
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief       更新堵转可能性估计, 在主循环中调用
+ * @note        运行中力信号饱和时积分上升, 否则按1/4衰减;
+ *              堵转可能性取饱和积分和当前偏差占阈值比例中的较大者
+ * @param       adc: 力传感器ADC值
+ * @retval      无
+ */
+void stepper_verify_force(uint16_t adc)
+{
+    int32_t dev = g_stepper_verify.dev;
+    uint32_t dev_pct;
+
+    if (stepper_is_running(STEPPER_VERIFY_AXIS) && (adc >= STEPPER_VERIFY_ADC_SAT))
+    {
+        g_stepper_verify_sat += STEPPER_VERIFY_SAT_RISE;
+        if (g_stepper_verify_sat > 100)
+        {
+            g_stepper_verify_sat = 100;
+        }
+    }
+    else
+    {
+        g_stepper_verify_sat -= g_stepper_verify_sat / 4 + (g_stepper_verify_sat ? 1 : 0);
+    }
+
+    if (dev < 0)
+    {
+        dev = -dev;
+    }
+
+    dev_pct = (uint32_t)dev * 100 / STEPPER_VERIFY_MAX_DEV;
+    if (dev_pct > 100)
+    {
+        dev_pct = 100;
+    }
+
+    g_stepper_verify.stall = (dev_pct > g_stepper_verify_sat) ? (uint8_t)dev_pct : g_stepper_verify_sat;
+}
+
+/**
+ * @brief       设置模拟丢步率, 只在模拟模式下有效
+ * @param       rate: 每rate步丢1步, 0表示不丢步
+ * @retval      无
+ */
+void stepper_verify_set_sim(uint32_t rate)
+{
+    g_stepper_verify.sim_rate = rate;
+    g_stepper_verify.sim_cnt = 0;
+}
+
+/**
+ * @brief       清除故障标志和最大偏差统计
+ * @note        不重新同步, 运行中查询不会掩盖已经累积的偏差
+ * @param       无
+ * @retval      无
+ */
+void stepper_verify_clear(void)
+{
+    g_stepper_verify.fault = 0;
+    g_stepper_verify.reported = 1;
+    g_stepper_verify.max_dev = 0;
+}
@@ -0,0 +1,79 @@
+/**
+ ****************************************************************************************************
+ * @file        stepper_verify.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       步进电机丢步检测 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 在TIM8更新中断中比较指令步数和编码器反馈(TIM5编码器模式), 偏差超过阈值时立即
+ * 停止该轴, 清除回零标志并锁存故障, 由主循环上报.
+ * 没有接编码器时可以使用模拟反馈源: 反馈 = 指令 - 人为注入的丢步, 用于测试检测链路.
+ * 另外根据力传感器(ADC)饱和程度估计堵转可能性, 作为辅助判断.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __STEPPER_VERIFY_H
+#define __STEPPER_VERIFY_H
+
+#include "./SYSTEM/sys/sys.h"
+#include "./BSP/STEPPER_MOTOR/stepper_unit.h"
+
+/******************************************************************************************/
+/* 丢步检测参数定义 */
+
+#define STEPPER_VERIFY_OFF              0           /* 不检测 */
+#define STEPPER_VERIFY_ENCODER          1           /* 编码器反馈 */
+#define STEPPER_VERIFY_SIM              2           /* 模拟反馈 */
+
+#define STEPPER_VERIFY_MODE             STEPPER_VERIFY_SIM  /* 默认模式, 接好编码器后改为STEPPER_VERIFY_ENCODER */
+#define STEPPER_VERIFY_AXIS             1           /* 检测的电机序号(贯入轴) */
+#define STEPPER_VERIFY_ENC_CPR          4000        /* 编码器每圈计数(1000线, 4倍频) */
+#define STEPPER_VERIFY_ENC_DIR          1           /* 1: 编码器计数方向与正方向一致; -1: 相反 */
+#define STEPPER_VERIFY_MAX_DEV          16          /* 允许的最大偏差, 单位: 步(8细分下2个整步) */
+
+/* 编码器计数换算为步数的Q24系数, 编译时计算 */
+#define STEPPER_VERIFY_STEPS_PER_COUNT  ((uint32_t)((((uint64_t)STEPPER_AXIS1_FULL_STEPS * STEPPER_AXIS1_MICROSTEP) << STEPPER_UNIT_Q) / STEPPER_VERIFY_ENC_CPR))
+
+#define STEPPER_VERIFY_ADC_SAT          4000        /* 力信号饱和阈值(12位ADC) */
+#define STEPPER_VERIFY_SAT_RISE         20          /* 每次检测到饱和时堵转估计的增量 */
+
+/* 丢步检测状态 */
+typedef struct
+{
+    uint8_t mode;                           /* 检测模式 */
+    volatile uint8_t fault;                 /* 偏差超限故障标志 */
+    volatile uint8_t reported;              /* 故障是否已上报 */
+    int32_t base_pos;                       /* 同步时的指令脉冲计数 */
+    int32_t base_cnt;                       /* 同步时的编码器计数 */
+    volatile int32_t dev;                   /* 当前偏差(指令 - 反馈), 单位: 步 */
+    volatile int32_t max_dev;               /* 最大偏差绝对值 */
+    volatile int32_t fault_cmd;             /* 故障时的指令步数(相对同步点) */
+    volatile int32_t fault_fb;              /* 故障时的反馈步数(相对同步点) */
+    uint32_t sim_rate;                      /* 模拟丢步: 每sim_rate步丢1步, 0表示不丢步 */
+    uint32_t sim_cnt;                       /* 模拟丢步计数 */
+    int32_t sim_loss;                       /* 模拟累计丢步 */
+    uint8_t stall;                          /* 堵转可能性, 0~100 */
+} stepper_verify_t;
+
+extern stepper_verify_t g_stepper_verify;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void stepper_verify_init(void);                                         /* 丢步检测初始化 */
+void stepper_verify_sync(uint8_t index);                                /* 以当前位置为基准重新同步 */
+uint8_t stepper_verify_check(uint8_t index, int32_t pos, int8_t step);  /* 步进中断中调用, 返回1表示偏差超限 */
+void stepper_verify_force(uint16_t adc);                                /* 更新堵转可能性估计 */
+void stepper_verify_set_sim(uint32_t rate);                             /* 设置模拟丢步率 */
+void stepper_verify_clear(void);                                        /* 清除故障 */
+
+#endif
@@ -0,0 +1,826 @@
+/**
+ ****************************************************************************************************
+ * @file        telemetry.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       二进制遥测帧 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/TELEMETRY/telemetry.h"
+#include "./BSP/ATK_MW579/atk_mw579_uart.h"
+
+
+telemetry_t g_telemetry;
+
+static uint8_t g_telemetry_raw[TELEMETRY_RAW_SIZE];        /* 正在组装的原始帧 */
+static uint8_t g_telemetry_wire[TELEMETRY_WIRE_SIZE];      /* 编码后的帧 */
+static uint16_t g_telemetry_len;                            /* 原始帧已写入的长度 */
+static uint8_t g_telemetry_type;                            /* 当前帧的记录类型 */
+
+/* 差分编码状态, 每帧复位 */
+static struct
+{
+    uint32_t time;                                          /* 上一条记录 */
+    int32_t depth;
+    uint16_t force;
+    int32_t dtime;                                          /* 上一条记录的一阶差分 */
+    int32_t ddepth;
+    uint32_t acc;                                           /* Rice位流累加器 */
+    uint8_t bits;                                           /* 累加器中的位数 */
+    uint32_t rice_a[3];                                     /* 各字段的自适应参数: 累计值 */
+    uint32_t rice_n[3];                                     /* 各字段的自适应参数: 计数 */
+} g_telemetry_delta;
+
+/* 样本统计, 用于生成摘要 */
+typedef struct
+{
+    uint32_t count;                                         /* 样本数, 0表示空 */
+    uint16_t seq;                                           /* 第一条样本的序号 */
+    uint32_t time_first;
+    uint32_t time_last;
+    int32_t depth_first;
+    int32_t depth_last;
+    uint16_t force_min;
+    uint16_t force_max;
+    uint64_t force_sum;
+} telemetry_sum_t;
+
+static telemetry_sum_t g_telemetry_frame_sum;               /* 当前帧的样本 */
+static telemetry_sum_t g_telemetry_backlog;                 /* 链路饱和时未发出的样本, 恢复后以摘要发送 */
+
+/* 重发历史环形缓冲, 每帧存为: len(1) | count(1) | 原始帧(len字节, 不含CRC), 可以跨越缓冲末尾 */
+static struct
+{
+    uint8_t buf[TELEMETRY_HIST_SIZE];
+    uint16_t head;                                          /* 下一帧的写入位置 */
+    uint16_t tail;                                          /* 最早一帧的位置 */
+    uint16_t used;                                          /* 已用字节数 */
+} g_telemetry_hist;
+
+/**
+ * @brief       按小端写入16位数
+ * @param       p: 写入位置
+ * @param       v: 数值
+ * @retval      无
+ */
+static void telemetry_put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+/**
+ * @brief       按小端写入32位数
+ * @param       p: 写入位置
+ * @param       v: 数值
+ * @retval      无
+ */
+static void telemetry_put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/**
+ * @brief       初始化
+ * @param       无
+ * @retval      无
+ */
+void telemetry_init(void)
+{
+    g_telemetry.mode = TELEMETRY_MODE_ASCII;
+    g_telemetry.seq = 0;
+    g_telemetry.count = 0;
+    g_telemetry.frames = 0;
+    g_telemetry.drops = 0;
+    g_telemetry.samples = 0;
+    g_telemetry.bytes = 0;
+    g_telemetry.cycles = 0;
+    g_telemetry.flow = 0;
+    g_telemetry.granted = 0;
+    g_telemetry.used = 0;
+    g_telemetry.credit_stalls = 0;
+    g_telemetry.queue_stalls = 0;
+    g_telemetry.summaries = 0;
+    g_telemetry_backlog.count = 0;
+    g_telemetry.rtx_frames = 0;
+    g_telemetry.rtx_missing = 0;
+    g_telemetry_hist.head = 0;
+    g_telemetry_hist.tail = 0;
+    g_telemetry_hist.used = 0;
+    g_telemetry.link = 1;
+    g_telemetry.replay = 0;
+    g_telemetry.spool_seq = 0;
+    g_telemetry.spool_end = 0;
+    g_telemetry.spooled = 0;
+    g_telemetry.spool_lost = 0;
+    g_telemetry.replayed = 0;
+}
+
+/**
+ * @brief       授予可发送的帧数
+ * @note        由credit命令在接收中断中调用; 第一次授权时开启流量控制
+ * @param       frames: 新授予的帧数, 负数表示关闭流量控制
+ * @retval      无
+ */
+void telemetry_credit(int32_t frames)
+{
+    if (frames < 0)
+    {
+        g_telemetry.flow = 0;
+        return;
+    }
+
+    if (g_telemetry.flow == 0)
+    {
+        g_telemetry.granted = g_telemetry.used;             /* 从0开始计 */
+        g_telemetry.flow = 1;
+    }
+    g_telemetry.granted += frames;
+}
+
+/**
+ * @brief       剩余可发送的帧数
+ * @param       无
+ * @retval      帧数, 没有开启流量控制时返回-1
+ */
+int32_t telemetry_credit_avail(void)
+{
+    int32_t avail = (int32_t)(g_telemetry.granted - g_telemetry.used);
+
+    if (g_telemetry.flow == 0)
+    {
+        return -1;
+    }
+
+    return (avail > 0) ? avail : 0;
+}
+
+/**
+ * @brief       设置输出模式
+ * @note        切换前先发出当前帧
+ * @param       mode: TELEMETRY_MODE_ASCII / BINARY / VARINT / RICE
+ * @retval      无
+ */
+void telemetry_set_mode(uint8_t mode)
+{
+    telemetry_flush();
+    g_telemetry.mode = mode;
+    g_telemetry.samples = 0;                                /* 按新模式重新统计 */
+    g_telemetry.bytes = 0;
+    g_telemetry.cycles = 0;
+}
+
+/**
+ * @brief       CRC-16/CCITT-FALSE
+ * @note        多项式0x1021, 初值0xFFFF, 与Python的binascii.crc_hqx(data, 0xFFFF)一致
+ * @param       dat: 数据
+ * @param       len: 长度
+ * @retval      CRC16
+ */
+uint16_t telemetry_crc16(const uint8_t *dat, uint16_t len)
+{
+    uint16_t crc = 0xFFFF;
+    uint8_t i;
+
+    while (len--)
+    {
+        crc ^= (uint16_t)(*dat++) << 8;
+        for (i = 0; i < 8; i++)
+        {
+            crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief       COBS编码
+ * @note        输出不含0x00, 长度最多为len + len / 254 + 1, 不包含分隔符
+ * @param       src: 原始数据
+ * @param       len: 原始数据长度
+ * @param       dst: 输出缓冲
+ * @retval      编码后的长度
+ */
+uint16_t telemetry_cobs_encode(const uint8_t *src, uint16_t len, uint8_t *dst)
+{
+    uint16_t rd = 0;
+    uint16_t wr = 1;
+    uint16_t code_pos = 0;
+    uint8_t code = 1;
+
+    while (rd < len)
+    {
+        if (src[rd] == 0)
+        {
+            dst[code_pos] = code;
+            code_pos = wr++;
+            code = 1;
+        }
+        else
+        {
+            dst[wr++] = src[rd];
+            code++;
+            if (code == 0xFF)                   /* 满254个非零字节, 开始新的一段 */
+            {
+                dst[code_pos] = code;
+                code_pos = wr++;
+                code = 1;
+            }
+        }
+        rd++;
+    }
+    dst[code_pos] = code;
+
+    return wr;
+}
+
+/**
+ * @brief       zig-zag映射, 把小的正负数都映射为小的无符号数
+ * @param       v: 有符号数
+ * @retval      0, -1, 1, -2 ... 映射为 0, 1, 2, 3 ...
+ */
+static uint32_t telemetry_zigzag(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+/**
+ * @brief       写入一个LEB128变长整数
+ * @param       v: 无符号数
+ * @retval      无
+ */
+static void telemetry_put_varint(uint32_t v)
+{
+    while (v >= 0x80)
+    {
+        g_telemetry_raw[g_telemetry_len++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    g_telemetry_raw[g_telemetry_len++] = (uint8_t)v;
+}
+
+/**
+ * @brief       向Rice位流写入若干位, 高位在前
+ * @param       v: 数据, 低n位有效
+ * @param       n: 位数, 1~24
+ * @retval      无
+ */
+static void telemetry_put_bits(uint32_t v, uint8_t n)
+{
+    g_telemetry_delta.acc = (g_telemetry_delta.acc << n) | (v & ((1UL << n) - 1));
+    g_telemetry_delta.bits += n;
+
+    while (g_telemetry_delta.bits >= 8)
+    {
+        g_telemetry_delta.bits -= 8;
+        g_telemetry_raw[g_telemetry_len++] = (uint8_t)(g_telemetry_delta.acc >> g_telemetry_delta.bits);
+    }
+}
+
+/**
+ * @brief       自适应Rice编码一个值
+ * @note        k取使(N << k) >= A的最小值, 即k约为log2(均值)
+ * @param       field: 字段序号, 0: 时间, 1: 深度, 2: 力
+ * @param       u    : 无符号数(zig-zag映射后)
+ * @retval      无
+ */
+static void telemetry_put_rice(uint8_t field, uint32_t u)
+{
+    uint8_t k = 0;
+    uint32_t q;
+
+    while (((g_telemetry_delta.rice_n[field] << k) < g_telemetry_delta.rice_a[field]) && (k < 24))
+    {
+        k++;
+    }
+
+    q = u >> k;
+    if (q < TELEMETRY_RICE_ESC)
+    {
+        telemetry_put_bits((1UL << (q + 1)) - 2, q + 1);    /* q个1加一个0 */
+        if (k)
+        {
+            telemetry_put_bits(u, k);
+        }
+    }
+    else                                                    /* 转义: 16个1加32位原值 */
+    {
+        telemetry_put_bits(0xFFFF, TELEMETRY_RICE_ESC);
+        telemetry_put_bits(u >> 16, 16);
+        telemetry_put_bits(u, 16);
+    }
+
+    g_telemetry_delta.rice_a[field] += u;
+    g_telemetry_delta.rice_n[field]++;
+    if (g_telemetry_delta.rice_n[field] >= 16)
+    {
+        g_telemetry_delta.rice_a[field] >>= 1;
+        g_telemetry_delta.rice_n[field] >>= 1;
+    }
+}
+
+/**
+ * @brief       写入一条完整记录(定长记录或差分帧的关键帧)
+ * @param       time_us : 采样时刻, 单位: us
+ * @param       depth_um: 深度
+ * @param       force   : 力
+ * @retval      无
+ */
+static void telemetry_put_record(uint32_t time_us, int32_t depth_um, uint16_t force)
+{
+    uint8_t *p = &g_telemetry_raw[g_telemetry_len];
+
+    telemetry_put_u32(p, time_us);
+    telemetry_put_u32(p + 4, (uint32_t)depth_um);
+    telemetry_put_u16(p + 8, force);
+    g_telemetry_len += TELEMETRY_RECORD_SIZE;
+}
+
+/**
+ * @brief       把一条样本计入统计
+ * @param       sum     : 统计
+ * @param       time_us : 采样时刻, 单位: us
+ * @param       depth_um: 深度
+ * @param       force   : 力
+ * @retval      无
+ */
+static void telemetry_sum_add(telemetry_sum_t *sum, uint32_t time_us, int32_t depth_um, uint16_t force)
+{
+    if (sum->count == 0)
+    {
+        sum->seq = g_telemetry.seq + g_telemetry.count;
+        sum->time_first = time_us;
+        sum->depth_first = depth_um;
+        sum->force_min = force;
+        sum->force_max = force;
+        sum->force_sum = 0;
+    }
+
+    sum->time_last = time_us;
+    sum->depth_last = depth_um;
+    sum->force_min = (force < sum->force_min) ? force : sum->force_min;
+    sum->force_max = (force > sum->force_max) ? force : sum->force_max;
+    sum->force_sum += force;
+    sum->count++;
+}
+
+/**
+ * @brief       把一段连续样本的统计合并到另一段之后
+ * @param       dst: 前一段, 合并结果
+ * @param       src: 紧接着的后一段
+ * @retval      无
+ */
+static void telemetry_sum_merge(telemetry_sum_t *dst, const telemetry_sum_t *src)
+{
+    if (dst->count == 0)
+    {
+        *dst = *src;
+        return;
+    }
+
+    dst->time_last = src->time_last;
+    dst->depth_last = src->depth_last;
+    dst->force_min = (src->force_min < dst->force_min) ? src->force_min : dst->force_min;
+    dst->force_max = (src->force_max > dst->force_max) ? src->force_max : dst->force_max;
+    dst->force_sum += src->force_sum;
+    dst->count += src->count;
+}
+
+/**
+ * @brief       检查链路能否再发一帧
+ * @note        没有授权或发送队列将满时计入对应的阻塞次数
+ * @param       无
+ * @retval      1: 可以发送; 0: 链路饱和
+ */
+static uint8_t telemetry_send_ok(void)
+{
+    if (g_telemetry.flow && ((int32_t)(g_telemetry.granted - g_telemetry.used) <= 0))
+    {
+        g_telemetry.credit_stalls++;
+        return 0;
+    }
+
+    if (atk_mw579_uart_tx_free() <= TELEMETRY_TX_RESERVE)
+    {
+        g_telemetry.queue_stalls++;
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief       加上CRC, COBS编码后发送一帧
+ * @param       raw: 原始帧, 帧头已填好, 后面要留出CRC的空间
+ * @param       len: 原始帧长度(不含CRC)
+ * @retval      0: 已入队; 1: 发送队列满, 已丢弃
+ */
+static uint8_t telemetry_send(uint8_t *raw, uint16_t len)
+{
+    uint16_t wire_len;
+
+    telemetry_put_u16(&raw[len], telemetry_crc16(raw, len));
+    len += TELEMETRY_CRC_SIZE;
+
+    g_telemetry_wire[0] = 0x00;
+    wire_len = telemetry_cobs_encode(raw, len, &g_telemetry_wire[1]) + 1;
+    g_telemetry_wire[wire_len++] = 0x00;
+
+    if (atk_mw579_uart_send(g_telemetry_wire, wire_len) != 0)
+    {
+        g_telemetry.drops++;
+        return 1;
+    }
+
+    g_telemetry.frames++;
+    g_telemetry.bytes += len;
+    g_telemetry.used++;
+    return 0;
+}
+
+/**
+ * @brief       把一帧存入重发历史, 空间不够时丢弃最早的帧
+ * @param       raw  : 原始帧(不含CRC)
+ * @param       len  : 原始帧长度
+ * @param       count: 帧内记录数
+ * @retval      无
+ */
+static void telemetry_hist_put(const uint8_t *raw, uint16_t len, uint8_t count)
+{
+    uint16_t need = len + 2;
+    uint16_t i;
+    uint16_t end;
+
+    while ((TELEMETRY_HIST_SIZE - g_telemetry_hist.used) < need)
+    {
+        /* 被覆盖的帧还没有回放: 待回放范围从它之后开始 */
+        end = (g_telemetry_hist.buf[(g_telemetry_hist.tail + 4) % TELEMETRY_HIST_SIZE] |
+              (g_telemetry_hist.buf[(g_telemetry_hist.tail + 5) % TELEMETRY_HIST_SIZE] << 8)) +
+              g_telemetry_hist.buf[(g_telemetry_hist.tail + 1) % TELEMETRY_HIST_SIZE];
+        if ((g_telemetry.spool_seq != g_telemetry.spool_end) && ((int16_t)(end - g_telemetry.spool_seq) > 0))
+        {
+            g_telemetry.spool_lost += (uint16_t)(end - g_telemetry.spool_seq);
+            g_telemetry.spool_seq = end;
+        }
+
+        i = g_telemetry_hist.buf[g_telemetry_hist.tail] + 2;
+        g_telemetry_hist.tail = (g_telemetry_hist.tail + i) % TELEMETRY_HIST_SIZE;
+        g_telemetry_hist.used -= i;
+    }
+
+    g_telemetry_hist.buf[g_telemetry_hist.head] = len;
+    g_telemetry_hist.buf[(g_telemetry_hist.head + 1) % TELEMETRY_HIST_SIZE] = count;
+    for (i = 0; i < len; i++)
+    {
+        g_telemetry_hist.buf[(g_telemetry_hist.head + 2 + i) % TELEMETRY_HIST_SIZE] = raw[i];
+    }
+    g_telemetry_hist.head = (g_telemetry_hist.head + need) % TELEMETRY_HIST_SIZE;
+    g_telemetry_hist.used += need;
+}
+
+/**
+ * @brief       重发指定序号范围的记录
+ * @note        在历史缓冲中查找与[seq, seq + count)有重叠的帧并原样重发, 占用遥测额度;
+ *              链路饱和时停止, 上位机稍后再请求剩下的部分
+ * @param       seq  : 第一条缺失记录的序号
+ * @param       count: 缺失的记录数, 不超过0x7FFF
+ * @param       sent : 重发的帧数
+ * @retval      范围内已不在历史缓冲中的记录数, 链路饱和中途停止时为0
+ */
+uint16_t telemetry_retransmit(uint16_t seq, uint16_t count, uint16_t *sent)
+{
+    uint8_t raw[TELEMETRY_RAW_SIZE];
+    uint16_t pos = g_telemetry_hist.tail;
+    uint16_t left = g_telemetry_hist.used;
+    uint16_t covered = 0;
+    uint16_t len;
+    uint16_t i;
+    uint8_t num;
+    int16_t rel;
+
+    *sent = 0;
+    if (count > 0x7FFF)
+    {
+        count = 0x7FFF;
+    }
+
+    while (left > 0)
+    {
+        len = g_telemetry_hist.buf[pos];
+        num = g_telemetry_hist.buf[(pos + 1) % TELEMETRY_HIST_SIZE];
+        rel = (int16_t)((g_telemetry_hist.buf[(pos + 4) % TELEMETRY_HIST_SIZE] |
+                        (g_telemetry_hist.buf[(pos + 5) % TELEMETRY_HIST_SIZE] << 8)) - seq);    /* 帧头seq相对请求起点 */
+
+        if ((rel < (int32_t)count) && ((rel + num) > 0))
+        {
+            if (telemetry_send_ok() == 0)
+            {
+                return 0;                   /* 链路饱和, 剩下的由上位机稍后再请求 */
+            }
+
+            covered += ((rel + num < count) ? (rel + num) : count) - ((rel > 0) ? rel : 0);
+
+            for (i = 0; i < len; i++)
+            {
+                raw[i] = g_telemetry_hist.buf[(pos + 2 + i) % TELEMETRY_HIST_SIZE];
+            }
+            if (telemetry_send(raw, len) == 0)
+            {
+                (*sent)++;
+                g_telemetry.rtx_frames++;
+            }
+        }
+
+        pos = (pos + len + 2) % TELEMETRY_HIST_SIZE;
+        left -= len + 2;
+    }
+
+    g_telemetry.rtx_missing += count - covered;
+    return count - covered;
+}
+
+/**
+ * @brief       蓝牙连接状态改变
+ * @note        断开时从下一条记录开始缓存; 重连后等上位机发replay命令(它重新订阅通知之后)才回放,
+ *              避免回放的帧在上位机还没准备好时发出
+ * @param       up: 1, 已连接; 0, 已断开
+ * @retval      无
+ */
+void telemetry_link(uint8_t up)
+{
+    if (up == g_telemetry.link)
+    {
+        return;
+    }
+
+    if ((up == 0) && (g_telemetry.spool_seq == g_telemetry.spool_end))
+    {
+        g_telemetry.spool_seq = g_telemetry.seq;
+        g_telemetry.spool_end = g_telemetry.seq;
+    }
+
+    g_telemetry.replay = 0;
+    g_telemetry.link = up;
+}
+
+/**
+ * @brief       回放断连期间缓存的帧
+ * @note        在主循环中调用. 缓存中的帧按序号先后存放, 从待回放范围内最早的帧开始原样重发,
+ *              每次最多TELEMETRY_REPLAY_BURST帧, 链路饱和时等下一次调用
+ * @param       无
+ * @retval      剩余待回放的记录数
+ */
+uint16_t telemetry_replay(void)
+{
+    uint8_t raw[TELEMETRY_RAW_SIZE];
+    uint16_t pos = g_telemetry_hist.tail;
+    uint16_t left = g_telemetry_hist.used;
+    uint16_t frame_seq;
+    uint16_t len;
+    uint16_t i;
+    uint8_t num;
+    uint8_t burst = 0;
+
+    while (g_telemetry.link && g_telemetry.replay && (left > 0) &&
+           (g_telemetry.spool_seq != g_telemetry.spool_end) && (burst < TELEMETRY_REPLAY_BURST))
+    {
+        len = g_telemetry_hist.buf[pos];
+        num = g_telemetry_hist.buf[(pos + 1) % TELEMETRY_HIST_SIZE];
+        frame_seq = g_telemetry_hist.buf[(pos + 4) % TELEMETRY_HIST_SIZE] |
+                    (g_telemetry_hist.buf[(pos + 5) % TELEMETRY_HIST_SIZE] << 8);
+
+        if ((int16_t)(frame_seq + num - g_telemetry.spool_seq) > 0)   /* 帧内有还没回放的记录 */
+        {
+            if (telemetry_send_ok() == 0)
+            {
+                break;
+            }
+
+            for (i = 0; i < len; i++)
+            {
+                raw[i] = g_telemetry_hist.buf[(pos + 2 + i) % TELEMETRY_HIST_SIZE];
+            }
+            if (telemetry_send(raw, len) != 0)
+            {
+                break;
+            }
+
+            g_telemetry.replayed++;
+            burst++;
+            g_telemetry.spool_seq = frame_seq + num;
+            if ((int16_t)(g_telemetry.spool_end - g_telemetry.spool_seq) < 0)
+            {
+                g_telemetry.spool_seq = g_telemetry.spool_end;
+            }
+        }
+
+        pos = (pos + len + 2) % TELEMETRY_HIST_SIZE;
+        left -= len + 2;
+    }
+
+    return (uint16_t)(g_telemetry.spool_end - g_telemetry.spool_seq);
+}
+
+/**
+ * @brief       发送积压样本的摘要帧
+ * @param       无
+ * @retval      无
+ */
+static void telemetry_send_summary(void)
+{
+    uint8_t raw[TELEMETRY_HEAD_SIZE + TELEMETRY_SUMMARY_SIZE + TELEMETRY_CRC_SIZE];
+    uint8_t *p = &raw[TELEMETRY_HEAD_SIZE];
+    telemetry_sum_t *sum = &g_telemetry_backlog;
+
+    raw[0] = TELEMETRY_VERSION;
+    raw[1] = TELEMETRY_TYPE_SUMMARY;
+    telemetry_put_u16(&raw[2], sum->seq);
+    telemetry_put_u32(p, sum->count);
+    telemetry_put_u32(p + 4, sum->time_first);
+    telemetry_put_u32(p + 8, sum->time_last);
+    telemetry_put_u32(p + 12, (uint32_t)sum->depth_first);
+    telemetry_put_u32(p + 16, (uint32_t)sum->depth_last);
+    telemetry_put_u16(p + 20, sum->force_min);
+    telemetry_put_u16(p + 22, sum->force_max);
+    telemetry_put_u16(p + 24, (uint16_t)(sum->force_sum / sum->count));
+
+    if (telemetry_send(raw, TELEMETRY_HEAD_SIZE + TELEMETRY_SUMMARY_SIZE) == 0)
+    {
+        g_telemetry.summaries++;
+        sum->count = 0;
+    }
+}
+
+/**
+ * @brief       加入一条样本, 帧满时发送
+ * @note        按当前模式立即编码进原始帧, 剩余空间不够再放一条最坏长度的记录时发送
+ * @param       time_us : 采样时刻, 设备微秒时钟(timesync_us)
+ * @param       depth_um: 深度, 单位: um
+ * @param       force   : 力传感器ADC原始值
+ * @retval      无
+ */
+void telemetry_sample(uint32_t time_us, int32_t depth_um, uint16_t force)
+{
+    uint32_t start = DWT->CYCCNT;
+    int32_t dtime;
+    int32_t ddepth;
+    uint16_t worst;
+    uint8_t i;
+
+    if (g_telemetry.count == 0)                             /* 帧首: 写关键帧, 复位差分状态 */
+    {
+        g_telemetry_len = TELEMETRY_HEAD_SIZE;
+
+        if (g_telemetry.mode == TELEMETRY_MODE_VARINT)
+        {
+            g_telemetry_type = TELEMETRY_TYPE_VARINT;
+            g_telemetry_len++;                              /* 记录数, 发送时填写 */
+        }
+        else if (g_telemetry.mode == TELEMETRY_MODE_RICE)
+        {
+            g_telemetry_type = TELEMETRY_TYPE_RICE;
+            g_telemetry_len++;
+        }
+        else
+        {
+            g_telemetry_type = TELEMETRY_TYPE_SAMPLE;
+        }
+
+        telemetry_put_record(time_us, depth_um, force);
+        g_telemetry_frame_sum.count = 0;
+
+        g_telemetry_delta.dtime = 0;
+        g_telemetry_delta.ddepth = 0;
+        g_telemetry_delta.acc = 0;
+        g_telemetry_delta.bits = 0;
+        for (i = 0; i < 3; i++)
+        {
+            g_telemetry_delta.rice_a[i] = 2;
+            g_telemetry_delta.rice_n[i] = 1;
+        }
+    }
+    else if (g_telemetry_type == TELEMETRY_TYPE_SAMPLE)
+    {
+        telemetry_put_record(time_us, depth_um, force);
+    }
+    else
+    {
+        dtime = (int32_t)(time_us - g_telemetry_delta.time);
+        ddepth = depth_um - g_telemetry_delta.depth;
+
+        if (g_telemetry_type == TELEMETRY_TYPE_VARINT)
+        {
+            telemetry_put_varint(telemetry_zigzag(dtime - g_telemetry_delta.dtime));
+            telemetry_put_varint(telemetry_zigzag(ddepth - g_telemetry_delta.ddepth));
+            telemetry_put_varint(telemetry_zigzag((int32_t)force - g_telemetry_delta.force));
+        }
+        else
+        {
+            telemetry_put_rice(0, telemetry_zigzag(dtime - g_telemetry_delta.dtime));
+            telemetry_put_rice(1, telemetry_zigzag(ddepth - g_telemetry_delta.ddepth));
+            telemetry_put_rice(2, telemetry_zigzag((int32_t)force - g_telemetry_delta.force));
+        }
+
+        g_telemetry_delta.dtime = dtime;
+        g_telemetry_delta.ddepth = ddepth;
+    }
+
+    g_telemetry_delta.time = time_us;
+    g_telemetry_delta.depth = depth_um;
+    g_telemetry_delta.force = force;
+    telemetry_sum_add(&g_telemetry_frame_sum, time_us, depth_um, force);
+    g_telemetry.count++;
+    g_telemetry.samples++;
+
+    worst = (g_telemetry_type == TELEMETRY_TYPE_SAMPLE) ? TELEMETRY_RECORD_SIZE : TELEMETRY_DELTA_WORST;
+    if ((g_telemetry.count >= TELEMETRY_RECORDS_MAX) ||
+        (g_telemetry_len + 1 + worst + TELEMETRY_CRC_SIZE > TELEMETRY_RAW_SIZE))    /* 1: Rice位流末尾不满一字节 */
+    {
+        telemetry_flush();
+    }
+
+    g_telemetry.cycles += DWT->CYCCNT - start;
+}
+
+/**
+ * @brief       发送当前帧
+ * @note        帧头的序号为帧内第一条记录的序号, 发送与否序号都照常增加, 并都存入重发历史.
+ *              链路饱和(没有授权或发送队列将满)时不发送, 把本帧样本合并到积压摘要中,
+ *              恢复后先发摘要帧再发新帧, 上位机收到的序号保持连续;
+ *              蓝牙断开时不发送也不合并, 帧留在缓存中等重连后回放
+ * @param       无
+ * @retval      无
+ */
+void telemetry_flush(void)
+{
+    if (g_telemetry.count == 0)
+    {
+        return;
+    }
+
+    if ((g_telemetry_type == TELEMETRY_TYPE_RICE) && g_telemetry_delta.bits)
+    {
+        telemetry_put_bits(0, 8 - g_telemetry_delta.bits);  /* 补齐最后一个字节 */
+    }
+
+    g_telemetry_raw[0] = TELEMETRY_VERSION;
+    g_telemetry_raw[1] = g_telemetry_type;
+    telemetry_put_u16(&g_telemetry_raw[2], g_telemetry.seq);
+    if (g_telemetry_type != TELEMETRY_TYPE_SAMPLE)
+    {
+        g_telemetry_raw[TELEMETRY_HEAD_SIZE] = g_telemetry.count;
+    }
+    telemetry_hist_put(g_telemetry_raw, g_telemetry_len, g_telemetry.count);
+
+    if (g_telemetry.link == 0)
+    {
+        /* 蓝牙断开: 帧已存入缓存, 重连后回放 */
+        g_telemetry.spool_end = g_telemetry.seq + g_telemetry.count;
+        g_telemetry.spooled += g_telemetry.count;
+    }
+    else
+    {
+        if (g_telemetry_backlog.count && telemetry_send_ok())
+        {
+            telemetry_send_summary();
+        }
+
+        if ((g_telemetry_backlog.count == 0) && telemetry_send_ok())
+        {
+            telemetry_send(g_telemetry_raw, g_telemetry_len);
+        }
+        else
+        {
+            telemetry_sum_merge(&g_telemetry_backlog, &g_telemetry_frame_sum);
+        }
+    }
+
+    g_telemetry.seq += g_telemetry.count;
+    g_telemetry.count = 0;
+}
+
+/**
+ * @brief       平均每个样本的编码周期数
+ * @note        包括组帧、CRC、COBS和入队, 用于判断在蓝牙链路上开启压缩是否划算
+ * @param       无
+ * @retval      周期数, 168MHz下168个周期为1us
+ */
+uint32_t telemetry_cycles_per_sample(void)
+{
+    return g_telemetry.samples ? (g_telemetry.cycles / g_telemetry.samples) : 0;
+}
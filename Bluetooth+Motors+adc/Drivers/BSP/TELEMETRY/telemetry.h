@@ -0,0 +1,137 @@
+/**
+ ****************************************************************************************************
+ * @file        telemetry.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       二进制遥测帧 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 帧格式(版本2), 所有多字节字段为小端:
+ *   原始帧: ver(1) | type(1) | seq(2) | payload(n) | crc16(2)
+ *           seq为帧内第一条记录的序号, 每条记录序号加1;
+ *           crc16为CRC-16/CCITT-FALSE(多项式0x1021, 初值0xFFFF), 覆盖ver到payload
+ *   线路上: 0x00 | COBS(原始帧) | 0x00
+ *           COBS编码后帧内不含0x00, 前后的0x00把帧与命令应答等ASCII文本分开
+ * 记录类型TELEMETRY_TYPE_SAMPLE, 每条10字节:
+ *   time_us(4) | depth_um(4, 有符号) | force(2, ADC原始值)
+ *   time_us是采样时刻的设备微秒时钟(见timesync.h), 上位机同步时钟后换算成自己的时刻;
+ *   版本1的time为毫秒
+ * 一次蓝牙写入带多条样本, 比每个样本一行文本少得多的包数
+ *
+ * 压缩记录类型TELEMETRY_TYPE_VARINT / TELEMETRY_TYPE_RICE:
+ *   count(1) | 关键帧: time_us(4) | depth_um(4) | force(2) | 其余count - 1条的差分
+ *   时间和深度取二阶差分(步进同步时深度增量恒定, 二阶差分为0), 力取一阶差分, 都做zig-zag映射;
+ *   VARINT: 每个值为LEB128变长整数, 小于128时只占1字节;
+ *   RICE  : 位流(高位在前), 每个字段各自维护自适应参数k(A/N均值估计, N满16时减半),
+ *           商 < 16时为商个1 + 一个0 + 低k位, 否则为16个1 + 32位原值
+ *   每帧第一条都是完整记录, 自适应状态在帧首复位, 丢帧不影响后面的帧
+ *
+ * 流量控制:
+ *   上位机用credit命令授予可发送的帧数, 每发一帧(含摘要帧)消耗1个; 收到第一个授权前不限制,
+ *   兼容不授权的上位机. 没有授权或蓝牙发送队列将满时不再丢帧, 而是把这些样本合并成一条摘要,
+ *   恢复发送时先发摘要帧TELEMETRY_TYPE_SUMMARY, seq为第一条被合并样本的序号, 26字节:
+ *   count(4) | time_first(4) | time_last(4) | depth_first(4) | depth_last(4) |
+ *   force_min(2) | force_max(2) | force_mean(2)
+ *
+ * 重发:
+ *   每条记录的序号 = 帧头seq + 记录在帧内的位置. 组好的数据帧(无论是否发出)都存入
+ *   TELEMETRY_HIST_SIZE字节的历史环形缓冲, 满时覆盖最早的帧. 上位机发现序号跳变后用
+ *   "rtx <seq> <count>"只请求缺失的范围, 设备把覆盖该范围的帧原样重发; 正常情况下没有任何应答开销
+ *
+ * 断连缓存:
+ *   蓝牙断开(STA引脚)期间帧不发送、也不合并成摘要, 只留在历史缓冲中, 缓冲就是断连时的缓存;
+ *   缓存满时覆盖最早的帧, 计入spool_lost. 重连后上位机发"replay", 设备从缓存中最早的帧开始
+ *   按原样重发, 每次主循环最多TELEMETRY_REPLAY_BURST帧, 与实时帧交替占用链路, 直到回放完毕
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 帧格式定义 */
+
+#define TELEMETRY_VERSION       2               /* 帧格式版本, 格式改变时加1 */
+#define TELEMETRY_TYPE_SAMPLE   0x01            /* 记录类型: 力-深度样本 */
+#define TELEMETRY_TYPE_VARINT   0x02            /* 记录类型: 差分 + 变长整数 */
+#define TELEMETRY_TYPE_RICE     0x03            /* 记录类型: 差分 + 自适应Rice编码 */
+#define TELEMETRY_TYPE_SUMMARY  0x04            /* 记录类型: 链路饱和时被合并样本的摘要 */
+#define TELEMETRY_TYPE_BENCH    0x05            /* 记录类型: 链路基准测试帧, 见bench.h */
+
+#define TELEMETRY_HEAD_SIZE     4               /* ver + type + seq */
+#define TELEMETRY_CRC_SIZE      2
+#define TELEMETRY_RECORD_SIZE   10              /* 单条样本记录长度 */
+#define TELEMETRY_DELTA_WORST   18              /* 单条差分记录的最大长度(Rice转义: 3 x 48位) */
+#define TELEMETRY_RECORDS_MAX   64              /* 每帧最多记录数 */
+#define TELEMETRY_RAW_SIZE      120             /* 原始帧最大长度, 编码后不超过蓝牙发送缓冲 */
+#define TELEMETRY_WIRE_SIZE     (TELEMETRY_RAW_SIZE + TELEMETRY_RAW_SIZE / 254 + 3)    /* COBS开销 + 前后分隔符 */
+#define TELEMETRY_RICE_ESC      16              /* Rice商达到该值时转义为原值 */
+#define TELEMETRY_SUMMARY_SIZE  26              /* 摘要记录长度 */
+#define TELEMETRY_TX_RESERVE    2               /* 发送队列至少留出的空闲缓冲, 给命令应答用 */
+#define TELEMETRY_HIST_SIZE     16384           /* 重发历史/断连缓存大小, 5ms采样时约可保存30秒到一分多钟 */
+#define TELEMETRY_REPLAY_BURST  4               /* 每次回放最多发送的帧数 */
+
+#define TELEMETRY_SAMPLE_MS     5               /* 二进制模式下的采样周期 */
+
+/* 输出模式 */
+#define TELEMETRY_MODE_ASCII    0               /* 每个样本一行"电压,深度um"文本 */
+#define TELEMETRY_MODE_BINARY   1               /* 二进制帧, 定长记录 */
+#define TELEMETRY_MODE_VARINT   2               /* 二进制帧, 差分 + 变长整数 */
+#define TELEMETRY_MODE_RICE     3               /* 二进制帧, 差分 + 自适应Rice编码 */
+
+typedef struct
+{
+    uint8_t mode;                               /* 输出模式 */
+    uint16_t seq;                               /* 下一条记录的序号 */
+    uint8_t count;                              /* 当前帧已有的记录数 */
+    uint32_t frames;                            /* 已发送的帧数 */
+    uint32_t drops;                             /* 发送队列满丢弃的帧数 */
+    uint32_t samples;                           /* 已编码的样本数 */
+    uint32_t bytes;                             /* 已发送的原始帧字节数(含帧头和CRC) */
+    uint32_t cycles;                            /* 编码样本累计的CPU周期数(DWT) */
+    volatile uint8_t flow;                      /* 1: 已开启流量控制 */
+    volatile uint32_t granted;                  /* 累计授予的帧数, 由接收中断写入 */
+    uint32_t used;                              /* 累计消耗的帧数 */
+    uint32_t credit_stalls;                     /* 因没有授权而合并的帧数 */
+    uint32_t queue_stalls;                      /* 因发送队列将满而合并的帧数 */
+    uint32_t summaries;                         /* 已发送的摘要帧数 */
+    uint32_t rtx_frames;                        /* 重发的帧数 */
+    uint32_t rtx_missing;                       /* 请求重发但已不在历史缓冲中的记录数 */
+    uint8_t link;                               /* 1: 蓝牙已连接; 0: 断开, 帧只存入缓存 */
+    uint8_t replay;                             /* 1: 上位机已请求回放 */
+    uint16_t spool_seq;                         /* 下一条待回放记录的序号 */
+    uint16_t spool_end;                         /* 待回放范围的结束序号, 与spool_seq相等表示没有 */
+    uint32_t spooled;                           /* 断连期间缓存的记录数 */
+    uint32_t spool_lost;                        /* 回放前就被覆盖的记录数 */
+    uint32_t replayed;                          /* 回放的帧数 */
+} telemetry_t;
+
+extern telemetry_t g_telemetry;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+void telemetry_init(void);                                              /* 初始化 */
+void telemetry_set_mode(uint8_t mode);                                  /* 设置输出模式 */
+void telemetry_sample(uint32_t time_us, int32_t depth_um, uint16_t force);  /* 加入一条样本, 帧满时发送 */
+void telemetry_flush(void);                                             /* 发送当前帧 */
+uint32_t telemetry_cycles_per_sample(void);                             /* 平均每个样本的编码周期数 */
+void telemetry_credit(int32_t frames);                                  /* 授予可发送的帧数 */
+int32_t telemetry_credit_avail(void);                                   /* 剩余可发送的帧数 */
+uint16_t telemetry_retransmit(uint16_t seq, uint16_t count, uint16_t *sent);   /* 重发指定序号范围的记录 */
+void telemetry_link(uint8_t up);                                        /* 蓝牙连接状态改变 */
+uint16_t telemetry_replay(void);                                        /* 回放断连期间缓存的帧 */
+uint16_t telemetry_crc16(const uint8_t *dat, uint16_t len);             /* CRC-16/CCITT-FALSE */
+uint16_t telemetry_cobs_encode(const uint8_t *src, uint16_t len, uint8_t *dst);  /* COBS编码 */
+
+#endif
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        btim.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-15
- * @brief       ʱ 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       基本定时器 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211015
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -26,68 +26,68 @@
 #include "./BSP/TIMER/btim.h"
 
 
-TIM_HandleTypeDef timx_handler;         /* ʱ */
+TIM_HandleTypeDef timx_handler;         /* 定时器参数句柄 */
 
 /**
- * @brief       ʱTIMXжϷ
- * @param       
- * @retval      
+ * @brief       基本定时器TIMX中断服务函数
+ * @param       无
+ * @retval      无
  */
 void BTIM_TIMX_INT_IRQHandler(void)
 {
-    HAL_TIM_IRQHandler(&timx_handler);  /*ʱص*/
+    HAL_TIM_IRQHandler(&timx_handler);  /*定时器回调函数*/
 }
 /**
- * @brief       صʱжϷ
- * @param       
- * @retval      
+ * @brief       回调函数，定时器中断服务函数调用
+ * @param       无
+ * @retval      无
  */
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
     if (htim == (&timx_handler))
     {
-        LED1_TOGGLE(); /*LED1ת*/
+        LED1_TOGGLE(); /*LED1反转*/
     }
 }
 
 /**
- * @brief       ʱTIMXʱжϳʼ
+ * @brief       基本定时器TIMX定时中断初始化函数
  * @note
- *              ʱʱAPB1,PPRE1  2Ƶʱ
- *              ʱʱΪAPB1ʱӵ2, APB1Ϊ36M, Զʱʱ = 72Mhz
- *              ʱʱ㷽: Tout = ((arr + 1) * (psc + 1)) / Ft us.
- *              Ft=ʱƵ,λ:Mhz
+ *              基本定时器的时钟来自APB1,当PPRE1 ≥ 2分频的时候
+ *              基本定时器的时钟为APB1时钟的2倍, 而APB1为36M, 所以定时器时钟 = 72Mhz
+ *              定时器溢出时间计算方法: Tout = ((arr + 1) * (psc + 1)) / Ft us.
+ *              Ft=定时器工作频率,单位:Mhz
  *
- * @param       arr: Զװֵ
- * @param       psc: ʱԤƵ
- * @retval      
+ * @param       arr: 自动重装值。
+ * @param       psc: 时钟预分频数
+ * @retval      无
  */
 void btim_timx_int_init(uint16_t arr, uint16_t psc)
 {
-    timx_handler.Instance = BTIM_TIMX_INT;                      /* ͨöʱX */
-    timx_handler.Init.Prescaler = psc;                          /* ԤƵ  */
-    timx_handler.Init.CounterMode = TIM_COUNTERMODE_UP;         /* ϼ */
-    timx_handler.Init.Period = arr;                             /* Զװֵ */
-    timx_handler.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;   /* ʱӷƵ */
+    timx_handler.Instance = BTIM_TIMX_INT;                      /* 通用定时器X */
+    timx_handler.Init.Prescaler = psc;                          /* 设置预分频器  */
+    timx_handler.Init.CounterMode = TIM_COUNTERMODE_UP;         /* 向上计数器 */
+    timx_handler.Init.Period = arr;                             /* 自动装载值 */
+    timx_handler.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;   /* 时钟分频因子 */
     HAL_TIM_Base_Init(&timx_handler);
 
     HAL_TIM_OnePulse_Init(&timx_handler, TIM_OPMODE_SINGLE);
-    HAL_TIM_Base_Start_IT(&timx_handler);                       /* ʹͨöʱxͼжϣTIM_IT_UPDATE */
-    __HAL_TIM_ENABLE_IT(&timx_handler,TIM_IT_UPDATE);           /* жϱ־λ */
+    HAL_TIM_Base_Start_IT(&timx_handler);                       /* 使能通用定时器x和及其更新中断：TIM_IT_UPDATE */
+    __HAL_TIM_ENABLE_IT(&timx_handler,TIM_IT_UPDATE);           /* 清除更新中断标志位 */
 }
 
 /**
- * @brief       ʱײʱӣжȼ
-                ˺ᱻHAL_TIM_Base_Init()
- * @param       
- * @retval      
+ * @brief       定时器底册驱动，开启时钟，设置中断优先级
+                此函数会被HAL_TIM_Base_Init()函数调用
+ * @param       无
+ * @retval      无
  */
 void HAL_TIM_Base_MspInit(TIM_HandleTypeDef *htim)
 {
     if (htim->Instance == BTIM_TIMX_INT)
     {
-        BTIM_TIMX_INT_CLK_ENABLE();                     /*ʹTIMʱ*/
-        HAL_NVIC_SetPriority(BTIM_TIMX_INT_IRQn, 1, 3); /* ռ1ȼ32 */
-        HAL_NVIC_EnableIRQ(BTIM_TIMX_INT_IRQn);         /*ITM3ж*/
+        BTIM_TIMX_INT_CLK_ENABLE();                     /*使能TIM时钟*/
+        HAL_NVIC_SetPriority(BTIM_TIMX_INT_IRQn, 1, 3); /* 抢占1，子优先级3，组2 */
+        HAL_NVIC_EnableIRQ(BTIM_TIMX_INT_IRQn);         /*开启ITM3中断*/
     }
 }
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        btim.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-15
- * @brief       ʱ 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       基本定时器 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ STM32F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 STM32F407开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211015
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -28,21 +28,21 @@
 #include "./SYSTEM/sys/sys.h"
 
 /******************************************************************************************/
-/* ʱ  */
+/* 基本定时器 定义 */
 
-/* TIMX ж϶ 
- * ĬTIM6/TIM7
- * ע: ͨ޸4궨,֧TIM1~TIM8һʱ.
+/* TIMX 中断定义 
+ * 默认是针对TIM6/TIM7
+ * 注意: 通过修改这4个宏定义,可以支持TIM1~TIM8任意一个定时器.
  */
  
 #define BTIM_TIMX_INT                       TIM6
 #define BTIM_TIMX_INT_IRQn                  TIM6_DAC_IRQn
 #define BTIM_TIMX_INT_IRQHandler            TIM6_DAC_IRQHandler
-#define BTIM_TIMX_INT_CLK_ENABLE()          do{ __HAL_RCC_TIM6_CLK_ENABLE(); }while(0)  /* TIM6 ʱʹ */
+#define BTIM_TIMX_INT_CLK_ENABLE()          do{ __HAL_RCC_TIM6_CLK_ENABLE(); }while(0)  /* TIM6 时钟使能 */
 
 /******************************************************************************************/
 
-void btim_timx_int_init(uint16_t arr, uint16_t psc);    /* ʱ ʱжϳʼ */
+void btim_timx_int_init(uint16_t arr, uint16_t psc);    /* 基本定时器 定时中断初始化函数 */
 
 #endif
 
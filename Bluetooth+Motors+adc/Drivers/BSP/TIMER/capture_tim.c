@@ -0,0 +1,140 @@
+/**
+ ****************************************************************************************************
+ * @file        capture_tim.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       输入捕获定时器(DMA) 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/TIMER/capture_tim.h"
+
+
+TIM_HandleTypeDef g_timx_cap_handle;        /* 输入捕获定时器句柄 */
+static DMA_HandleTypeDef g_timx_cap_dma;    /* 捕获DMA句柄 */
+static uint16_t g_timx_cap_len;             /* 本次捕获的缓冲区长度 */
+
+/**
+ * @brief       输入捕获初始化
+ * @note        通用定时器的时钟来自APB1, 定时器时钟 = 84Mhz, 不分频, 分辨率约11.9ns;
+ *              32位计数器自由运行, 约51s溢出一次, 相邻边沿的差值用无符号减法自然处理溢出.
+ *              DMA为普通模式, 缓冲区满后自动停止, 不使用中断
+ * @param       无
+ * @retval      无
+ */
+void gtim_timx_cap_init(void)
+{
+    TIM_IC_InitTypeDef ic_init_struct;
+
+    g_timx_cap_handle.Instance = GTIM_TIMX_CAP;                             /* 定时器x */
+    g_timx_cap_handle.Init.Prescaler = 0;                                   /* 不分频 */
+    g_timx_cap_handle.Init.CounterMode = TIM_COUNTERMODE_UP;                /* 向上计数模式 */
+    g_timx_cap_handle.Init.Period = 0xFFFFFFFF;                             /* 32位计数 */
+    g_timx_cap_handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    g_timx_cap_handle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    HAL_TIM_IC_Init(&g_timx_cap_handle);                                    /* 初始化输入捕获 */
+
+    ic_init_struct.ICPolarity = TIM_ICPOLARITY_RISING;                      /* 上升沿捕获 */
+    ic_init_struct.ICSelection = TIM_ICSELECTION_DIRECTTI;                  /* 映射到TI1上 */
+    ic_init_struct.ICPrescaler = TIM_ICPSC_DIV1;                            /* 每个边沿都捕获 */
+    ic_init_struct.ICFilter = 0;                                            /* 不滤波, 避免引入延时 */
+    HAL_TIM_IC_ConfigChannel(&g_timx_cap_handle, &ic_init_struct, GTIM_TIMX_CAP_CHY);
+
+    GTIM_TIMX_CAP_DMA_CLK_ENABLE();
+    g_timx_cap_dma.Instance = GTIM_TIMX_CAP_DMA_STREAM;
+    g_timx_cap_dma.Init.Channel = GTIM_TIMX_CAP_DMA_CHANNEL;
+    g_timx_cap_dma.Init.Direction = DMA_PERIPH_TO_MEMORY;                   /* 捕获寄存器 -> 内存 */
+    g_timx_cap_dma.Init.PeriphInc = DMA_PINC_DISABLE;
+    g_timx_cap_dma.Init.MemInc = DMA_MINC_ENABLE;
+    g_timx_cap_dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    g_timx_cap_dma.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+    g_timx_cap_dma.Init.Mode = DMA_NORMAL;                                  /* 缓冲区满后停止 */
+    g_timx_cap_dma.Init.Priority = DMA_PRIORITY_HIGH;
+    g_timx_cap_dma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&g_timx_cap_dma);
+
+    HAL_TIM_Base_Start(&g_timx_cap_handle);                                 /* 计数器一直运行 */
+}
+
+/**
+ * @brief       开始捕获
+ * @param       buf: 时间戳缓冲区, 单位: 定时器计数
+ * @param       len: 缓冲区长度
+ * @retval      无
+ */
+void gtim_timx_cap_start(uint32_t *buf, uint16_t len)
+{
+    gtim_timx_cap_stop();
+
+    g_timx_cap_len = len;
+    __HAL_TIM_CLEAR_FLAG(&g_timx_cap_handle, TIM_FLAG_CC1 | TIM_FLAG_CC1OF);
+    HAL_DMA_Start(&g_timx_cap_dma, (uint32_t)&GTIM_TIMX_CAP_CHY_CCRX, (uint32_t)buf, len);
+    __HAL_TIM_ENABLE_DMA(&g_timx_cap_handle, GTIM_TIMX_CAP_DMA_CC);         /* 每次捕获产生一次DMA请求 */
+    TIM_CCxChannelCmd(GTIM_TIMX_CAP, GTIM_TIMX_CAP_CHY, TIM_CCx_ENABLE);    /* 开启捕获 */
+}
+
+/**
+ * @brief       停止捕获
+ * @note        已写入缓冲区的数据保持不变, 可以用gtim_timx_cap_count()读取数量
+ * @param       无
+ * @retval      无
+ */
+void gtim_timx_cap_stop(void)
+{
+    TIM_CCxChannelCmd(GTIM_TIMX_CAP, GTIM_TIMX_CAP_CHY, TIM_CCx_DISABLE);   /* 关闭捕获 */
+    __HAL_TIM_DISABLE_DMA(&g_timx_cap_handle, GTIM_TIMX_CAP_DMA_CC);
+
+    if (g_timx_cap_dma.State == HAL_DMA_STATE_BUSY)
+    {
+        g_timx_cap_len -= __HAL_DMA_GET_COUNTER(&g_timx_cap_dma);           /* 先记下实际数量, 中止会清零计数 */
+        HAL_DMA_Abort(&g_timx_cap_dma);
+    }
+}
+
+/**
+ * @brief       已捕获的边沿数
+ * @param       无
+ * @retval      边沿数
+ */
+uint16_t gtim_timx_cap_count(void)
+{
+    if (g_timx_cap_dma.State == HAL_DMA_STATE_BUSY)
+    {
+        return g_timx_cap_len - __HAL_DMA_GET_COUNTER(&g_timx_cap_dma);
+    }
+
+    return g_timx_cap_len;
+}
+
+/**
+ * @brief       输入捕获定时器底层驱动, 时钟使能, 引脚配置
+                此函数会被HAL_TIM_IC_Init()调用
+ * @param       htim:定时器句柄
+ * @retval      无
+ */
+void HAL_TIM_IC_MspInit(TIM_HandleTypeDef *htim)
+{
+    if (htim->Instance == GTIM_TIMX_CAP)
+    {
+        GPIO_InitTypeDef gpio_init_struct;
+        GTIM_TIMX_CAP_CLK_ENABLE();                                         /* 使能TIMx时钟 */
+        GTIM_TIMX_CAP_CHY_GPIO_CLK_ENABLE();                                /* 开启捕获IO的时钟 */
+
+        gpio_init_struct.Pin = GTIM_TIMX_CAP_CHY_GPIO_PIN;                  /* 输入捕获的GPIO口 */
+        gpio_init_struct.Mode = GPIO_MODE_AF_PP;                            /* 复用 */
+        gpio_init_struct.Pull = GPIO_PULLDOWN;                              /* 下拉 */
+        gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;                      /* 高速 */
+        gpio_init_struct.Alternate = GTIM_TIMX_CAP_CHY_GPIO_AF;             /* 端口复用 */
+        HAL_GPIO_Init(GTIM_TIMX_CAP_CHY_GPIO_PORT, &gpio_init_struct);
+    }
+}
@@ -0,0 +1,60 @@
+/**
+ ****************************************************************************************************
+ * @file        capture_tim.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       输入捕获定时器(DMA) 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 用于步进脉冲回环测试: 用杜邦线把TIM8_CH1(PI5)接到捕获输入(PA5),
+ * 每个上升沿的32位计数值由DMA写入缓冲区, 不占用CPU.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __CAPTURE_TIM_H
+#define __CAPTURE_TIM_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 输入捕获定时器 定义 */
+
+/* TIMX 输入捕获 定义
+ * 默认使用TIM2_CH1(32位计数器, 84MHz不分频), TIM5已用作编码器接口.
+ * 注意: 通过修改这几个宏定义, 可以支持TIM2/TIM5等32位定时器, DMA流和通道需同时修改
+ */
+#define GTIM_TIMX_CAP_CHY_GPIO_PORT             GPIOA
+#define GTIM_TIMX_CAP_CHY_GPIO_PIN              GPIO_PIN_5
+#define GTIM_TIMX_CAP_CHY_GPIO_CLK_ENABLE()     do{ __HAL_RCC_GPIOA_CLK_ENABLE(); }while(0)   /* PA口时钟使能 */
+#define GTIM_TIMX_CAP_CHY_GPIO_AF               GPIO_AF1_TIM2
+
+#define GTIM_TIMX_CAP                           TIM2
+#define GTIM_TIMX_CAP_CHY                       TIM_CHANNEL_1
+#define GTIM_TIMX_CAP_CHY_CCRX                  TIM2->CCR1                                      /* 通道Y的捕获寄存器 */
+#define GTIM_TIMX_CAP_DMA_CC                    TIM_DMA_CC1
+#define GTIM_TIMX_CAP_CLK_ENABLE()              do{ __HAL_RCC_TIM2_CLK_ENABLE(); }while(0)    /* TIM2 时钟使能 */
+#define GTIM_TIMX_CAP_HZ                        84000000                                        /* 计数频率 */
+
+#define GTIM_TIMX_CAP_DMA_STREAM                DMA1_Stream5                                    /* TIM2_CH1: DMA1数据流5通道3 */
+#define GTIM_TIMX_CAP_DMA_CHANNEL               DMA_CHANNEL_3
+#define GTIM_TIMX_CAP_DMA_CLK_ENABLE()          do{ __HAL_RCC_DMA1_CLK_ENABLE(); }while(0)    /* DMA1 时钟使能 */
+
+extern TIM_HandleTypeDef g_timx_cap_handle;     /* 输入捕获定时器句柄 */
+
+/******************************************************************************************/
+
+void gtim_timx_cap_init(void);                                  /* 输入捕获初始化 */
+void gtim_timx_cap_start(uint32_t *buf, uint16_t len);          /* 开始捕获, 最多记录len个边沿 */
+void gtim_timx_cap_stop(void);                                  /* 停止捕获 */
+uint16_t gtim_timx_cap_count(void);                             /* 已捕获的边沿数 */
+
+#endif
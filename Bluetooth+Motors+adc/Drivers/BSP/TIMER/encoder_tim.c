@@ -0,0 +1,94 @@
+/**
+ ****************************************************************************************************
+ * @file        encoder_tim.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       编码器接口定时器 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/TIMER/encoder_tim.h"
+
+
+TIM_HandleTypeDef g_timx_encoder_handle;    /* 编码器定时器句柄 */
+
+/**
+ * @brief       编码器接口初始化
+ * @note        TI1和TI2双边沿计数(4倍频), 32位计数器自由运行, 不使用中断,
+ *              计数值按有符号数读取, 差值计算自然处理溢出
+ * @param       无
+ * @retval      无
+ */
+void gtim_timx_encoder_chy_init(void)
+{
+    TIM_Encoder_InitTypeDef encoder_init_struct;
+
+    GTIM_TIMX_ENCODER_CLK_ENABLE();                                         /* TIMX 时钟使能 */
+
+    g_timx_encoder_handle.Instance = GTIM_TIMX_ENCODER;                     /* 定时器x */
+    g_timx_encoder_handle.Init.Prescaler = 0;                               /* 不分频 */
+    g_timx_encoder_handle.Init.CounterMode = TIM_COUNTERMODE_UP;            /* 计数方向由编码器决定 */
+    g_timx_encoder_handle.Init.Period = 0xFFFFFFFF;                         /* 32位计数 */
+    g_timx_encoder_handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    g_timx_encoder_handle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+
+    encoder_init_struct.EncoderMode = TIM_ENCODERMODE_TI12;                 /* 4倍频 */
+    encoder_init_struct.IC1Polarity = TIM_ICPOLARITY_RISING;
+    encoder_init_struct.IC1Selection = TIM_ICSELECTION_DIRECTTI;
+    encoder_init_struct.IC1Prescaler = TIM_ICPSC_DIV1;
+    encoder_init_struct.IC1Filter = GTIM_TIMX_ENCODER_FILTER;
+    encoder_init_struct.IC2Polarity = TIM_ICPOLARITY_RISING;
+    encoder_init_struct.IC2Selection = TIM_ICSELECTION_DIRECTTI;
+    encoder_init_struct.IC2Prescaler = TIM_ICPSC_DIV1;
+    encoder_init_struct.IC2Filter = GTIM_TIMX_ENCODER_FILTER;
+    HAL_TIM_Encoder_Init(&g_timx_encoder_handle, &encoder_init_struct);     /* 初始化编码器接口 */
+
+    __HAL_TIM_SET_COUNTER(&g_timx_encoder_handle, 0);
+    HAL_TIM_Encoder_Start(&g_timx_encoder_handle, TIM_CHANNEL_ALL);         /* 开始计数 */
+}
+
+/**
+ * @brief       读取编码器计数值
+ * @param       无
+ * @retval      当前计数值(有符号)
+ */
+int32_t gtim_timx_encoder_get_count(void)
+{
+    return (int32_t)GTIM_TIMX_ENCODER->CNT;
+}
+
+/**
+ * @brief       编码器定时器底层驱动, 引脚配置
+                此函数会被HAL_TIM_Encoder_Init()调用
+ * @param       htim:定时器句柄
+ * @retval      无
+ */
+void HAL_TIM_Encoder_MspInit(TIM_HandleTypeDef *htim)
+{
+    if (htim->Instance == GTIM_TIMX_ENCODER)
+    {
+        GPIO_InitTypeDef gpio_init_struct;
+        GTIM_TIMX_ENCODER_CH1_GPIO_CLK_ENABLE();                            /* IO时钟使能 */
+        GTIM_TIMX_ENCODER_CH2_GPIO_CLK_ENABLE();
+
+        gpio_init_struct.Pin = GTIM_TIMX_ENCODER_CH1_GPIO_PIN;              /* A相 */
+        gpio_init_struct.Mode = GPIO_MODE_AF_PP;                            /* 复用 */
+        gpio_init_struct.Pull = GPIO_PULLUP;                                /* 上拉, 兼容集电极开路输出的编码器 */
+        gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;                      /* 高速 */
+        gpio_init_struct.Alternate = GTIM_TIMX_ENCODER_GPIO_AF;             /* 端口复用 */
+        HAL_GPIO_Init(GTIM_TIMX_ENCODER_CH1_GPIO_PORT, &gpio_init_struct);
+
+        gpio_init_struct.Pin = GTIM_TIMX_ENCODER_CH2_GPIO_PIN;              /* B相 */
+        HAL_GPIO_Init(GTIM_TIMX_ENCODER_CH2_GPIO_PORT, &gpio_init_struct);
+    }
+}
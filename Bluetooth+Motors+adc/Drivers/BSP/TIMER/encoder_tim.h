@@ -0,0 +1,54 @@
+/**
+ ****************************************************************************************************
+ * @file        encoder_tim.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       编码器接口定时器 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __ENCODER_TIM_H
+#define __ENCODER_TIM_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 编码器接口定时器 定义 */
+
+/* TIMX 编码器模式 定义
+ * 默认使用TIM5(32位计数器), CH1/CH2接编码器A/B相.
+ * 注意: 通过修改这几个宏定义, 可以支持TIM2/TIM5等32位定时器
+ */
+#define GTIM_TIMX_ENCODER_CH1_GPIO_PORT         GPIOH
+#define GTIM_TIMX_ENCODER_CH1_GPIO_PIN          GPIO_PIN_10
+#define GTIM_TIMX_ENCODER_CH1_GPIO_CLK_ENABLE() do{ __HAL_RCC_GPIOH_CLK_ENABLE(); }while(0)   /* PH口时钟使能 */
+
+#define GTIM_TIMX_ENCODER_CH2_GPIO_PORT         GPIOH
+#define GTIM_TIMX_ENCODER_CH2_GPIO_PIN          GPIO_PIN_11
+#define GTIM_TIMX_ENCODER_CH2_GPIO_CLK_ENABLE() do{ __HAL_RCC_GPIOH_CLK_ENABLE(); }while(0)   /* PH口时钟使能 */
+
+#define GTIM_TIMX_ENCODER_GPIO_AF               GPIO_AF2_TIM5
+
+#define GTIM_TIMX_ENCODER                       TIM5
+#define GTIM_TIMX_ENCODER_CLK_ENABLE()          do{ __HAL_RCC_TIM5_CLK_ENABLE(); }while(0)    /* TIM5 时钟使能 */
+
+#define GTIM_TIMX_ENCODER_FILTER                6   /* 输入滤波, 抑制长线干扰 */
+
+extern TIM_HandleTypeDef g_timx_encoder_handle;     /* 编码器定时器句柄 */
+
+/******************************************************************************************/
+
+void gtim_timx_encoder_chy_init(void);              /* 编码器接口初始化, 4倍频计数 */
+int32_t gtim_timx_encoder_get_count(void);          /* 读取编码器计数值 */
+
+#endif
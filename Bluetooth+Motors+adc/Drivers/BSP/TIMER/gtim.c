@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        gtim.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-15
- * @brief       ͨöʱ 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       通用定时器 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ STM32F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 STM32F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211015
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -27,61 +27,61 @@
 
 /******************************************************************************************/
 
-/* ʱþ  */
-TIM_HandleTypeDef g_timx_handle; /* ʱx */
+/* 定时器配置句柄 定义 */
+TIM_HandleTypeDef g_timx_handle; /* 定时器x句柄 */
 
 /******************************************************************************************/
-/* HAL ͨûصӿں */
+/* HAL 通用回调接口函数 */
 
 
 
 /**
- * @brief       ʱжϻص
- * @param        htim:ʱָ
- * @note        ˺ᱻʱжϺͬõ
- * @retval      
+ * @brief       定时器更新中断回调函数
+ * @param        htim:定时器句柄指针
+ * @note        此函数会被定时器中断函数共同调用的
+ * @retval      无
  */
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
 {
-    if (htim == (&g_timx_handle)) /* ͨöʱжʵصִе */
+    if (htim == (&g_timx_handle)) /* 通用定时器中断实验回调执行的内容 */
     {
         LED1_TOGGLE();
     }
 }
 
 /**
- * @brief       ͨöʱTIMXʱжϳʼ
+ * @brief       通用定时器TIMX定时中断初始化函数
  * @note
- *              ͨöʱʱAPB1,PPRE1  2Ƶʱ
- *              ͨöʱʱΪAPB1ʱӵ2, APB1Ϊ42M, Զʱʱ = 84Mhz
- *              ʱʱ㷽: Tout = ((arr + 1) * (psc + 1)) / Ft us.
- *              Ft=ʱƵ,λ:Mhz
+ *              通用定时器的时钟来自APB1,当PPRE1 ≥ 2分频的时候
+ *              通用定时器的时钟为APB1时钟的2倍, 而APB1为42M, 所以定时器时钟 = 84Mhz
+ *              定时器溢出时间计算方法: Tout = ((arr + 1) * (psc + 1)) / Ft us.
+ *              Ft=定时器工作频率,单位:Mhz
  *
- * @param       arr: Զװֵ
- * @param       psc: ʱԤƵ
- * @retval      
+ * @param       arr: 自动重装值。
+ * @param       psc: 时钟预分频数
+ * @retval      无
  */
 void gtim_timx_int_init(uint16_t arr, uint16_t psc)
 {
-    GTIM_TIMX_INT_CLK_ENABLE(); /* ʹTIMxʱ */
+    GTIM_TIMX_INT_CLK_ENABLE(); /* 使能TIMx时钟 */
 
-    g_timx_handle.Instance = GTIM_TIMX_INT;                     /* ͨöʱx */
-    g_timx_handle.Init.Prescaler = psc;                         /* Ƶ */
-    g_timx_handle.Init.CounterMode = TIM_COUNTERMODE_UP;        /* ϼ */
-    g_timx_handle.Init.Period = arr;                            /* Զװֵ */
-    g_timx_handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;  /* ʱӷƵ */
+    g_timx_handle.Instance = GTIM_TIMX_INT;                     /* 通用定时器x */
+    g_timx_handle.Init.Prescaler = psc;                         /* 分频 */
+    g_timx_handle.Init.CounterMode = TIM_COUNTERMODE_UP;        /* 向上计数器 */
+    g_timx_handle.Init.Period = arr;                            /* 自动装载值 */
+    g_timx_handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;  /* 时钟分频因子 */
     HAL_TIM_Base_Init(&g_timx_handle);
 
-    HAL_NVIC_SetPriority(GTIM_TIMX_INT_IRQn, 1, 3);             /* жȼռȼ1ȼ3 */
-    HAL_NVIC_EnableIRQ(GTIM_TIMX_INT_IRQn);                     /* ITMxж */
+    HAL_NVIC_SetPriority(GTIM_TIMX_INT_IRQn, 1, 3);             /* 设置中断优先级，抢占优先级1，子优先级3 */
+    HAL_NVIC_EnableIRQ(GTIM_TIMX_INT_IRQn);                     /* 开启ITMx中断 */
 
-    HAL_TIM_Base_Start_IT(&g_timx_handle);                      /* ʹܶʱxͶʱxж */
+    HAL_TIM_Base_Start_IT(&g_timx_handle);                      /* 使能定时器x和定时器x更新中断 */
 }
 
 /**
- * @brief       ʱжϷ
- * @param       
- * @retval      
+ * @brief       定时器中断服务函数
+ * @param       无
+ * @retval      无
  */
 void GTIM_TIMX_INT_IRQHandler(void)
 {
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        gtim.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-15
- * @brief       ͨöʱ 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       通用定时器 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ STM32F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 STM32F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211015
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -28,21 +28,21 @@
 #include "./SYSTEM/sys/sys.h"
 
 /******************************************************************************************/
-/* ͨöʱ  */
+/* 通用定时器 定义 */
 
-/* TIMX ж϶ 
- * ĬTIM2~TIM5.
- * ע: ͨ޸4궨,֧TIM1~TIM8һʱ.
+/* TIMX 中断定义 
+ * 默认是针对TIM2~TIM5.
+ * 注意: 通过修改这4个宏定义,可以支持TIM1~TIM8任意一个定时器.
  */
  
 #define GTIM_TIMX_INT                       TIM3
 #define GTIM_TIMX_INT_IRQn                  TIM3_IRQn
 #define GTIM_TIMX_INT_IRQHandler            TIM3_IRQHandler
-#define GTIM_TIMX_INT_CLK_ENABLE()          do{ __HAL_RCC_TIM3_CLK_ENABLE(); }while(0)  /* TIM3 ʱʹ */
+#define GTIM_TIMX_INT_CLK_ENABLE()          do{ __HAL_RCC_TIM3_CLK_ENABLE(); }while(0)  /* TIM3 时钟使能 */
 
 /******************************************************************************************/
 
-void gtim_timx_int_init(uint16_t arr, uint16_t psc);        /* ͨöʱ ʱжϳʼ */
+void gtim_timx_int_init(uint16_t arr, uint16_t psc);        /* 通用定时器 定时中断初始化函数 */
 
 
 
@@ -0,0 +1,77 @@
+/**
+ ****************************************************************************************************
+ * @file        servo_tim.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       舵机PWM定时器 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/TIMER/servo_tim.h"
+
+
+TIM_HandleTypeDef g_timx_servo_handle;      /* 舵机定时器句柄 */
+
+/**
+ * @brief       舵机PWM初始化
+ * @note        通用定时器的时钟来自APB1, PCLK1 = 42Mhz, 定时器时钟 = 84Mhz,
+ *              1us计数, 20ms周期, 比较值即为脉宽(us); 通道输出由舵机驱动按需开启.
+ *              HAL_TIM_PWM_MspInit()已由步进电机定时器使用, 这里直接配置引脚和中断
+ * @param       无
+ * @retval      无
+ */
+void gtim_timx_servo_init(void)
+{
+    GPIO_InitTypeDef gpio_init_struct;
+    TIM_OC_InitTypeDef oc_init_struct;
+
+    GTIM_TIMX_SERVO_CLK_ENABLE();                                           /* TIMX 时钟使能 */
+    GTIM_TIMX_SERVO_CH1_GPIO_CLK_ENABLE();                                  /* IO时钟使能 */
+    GTIM_TIMX_SERVO_CH2_GPIO_CLK_ENABLE();
+    GTIM_TIMX_SERVO_CH3_GPIO_CLK_ENABLE();
+
+    gpio_init_struct.Pin = GTIM_TIMX_SERVO_CH1_GPIO_PIN;                    /* 通道1 */
+    gpio_init_struct.Mode = GPIO_MODE_AF_PP;                                /* 复用推挽输出 */
+    gpio_init_struct.Pull = GPIO_PULLDOWN;                                  /* 下拉, 未输出时舵机保持不动 */
+    gpio_init_struct.Speed = GPIO_SPEED_FREQ_LOW;                           /* 低速 */
+    gpio_init_struct.Alternate = GTIM_TIMX_SERVO_GPIO_AF;                   /* 端口复用 */
+    HAL_GPIO_Init(GTIM_TIMX_SERVO_CH1_GPIO_PORT, &gpio_init_struct);
+
+    gpio_init_struct.Pin = GTIM_TIMX_SERVO_CH2_GPIO_PIN;                    /* 通道2 */
+    HAL_GPIO_Init(GTIM_TIMX_SERVO_CH2_GPIO_PORT, &gpio_init_struct);
+
+    gpio_init_struct.Pin = GTIM_TIMX_SERVO_CH3_GPIO_PIN;                    /* 通道3 */
+    HAL_GPIO_Init(GTIM_TIMX_SERVO_CH3_GPIO_PORT, &gpio_init_struct);
+
+    g_timx_servo_handle.Instance = GTIM_TIMX_SERVO;                         /* 定时器x */
+    g_timx_servo_handle.Init.Prescaler = GTIM_TIMX_SERVO_PSC;               /* 定时器分频 */
+    g_timx_servo_handle.Init.CounterMode = TIM_COUNTERMODE_UP;              /* 向上计数模式 */
+    g_timx_servo_handle.Init.Period = GTIM_TIMX_SERVO_ARR;                  /* 自动重装载值 */
+    g_timx_servo_handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+    g_timx_servo_handle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+    HAL_TIM_PWM_Init(&g_timx_servo_handle);                                 /* 初始化PWM */
+
+    oc_init_struct.OCMode = TIM_OCMODE_PWM1;                                /* 模式选择PWM1 */
+    oc_init_struct.Pulse = 1500;                                            /* 中位 */
+    oc_init_struct.OCPolarity = TIM_OCPOLARITY_HIGH;                        /* 输出比较极性为高 */
+    oc_init_struct.OCFastMode = TIM_OCFAST_DISABLE;
+    HAL_TIM_PWM_ConfigChannel(&g_timx_servo_handle, &oc_init_struct, TIM_CHANNEL_1);  /* 比较值带预装载, 周期边界更新 */
+    HAL_TIM_PWM_ConfigChannel(&g_timx_servo_handle, &oc_init_struct, TIM_CHANNEL_2);
+    HAL_TIM_PWM_ConfigChannel(&g_timx_servo_handle, &oc_init_struct, TIM_CHANNEL_3);
+
+    HAL_NVIC_SetPriority(GTIM_TIMX_SERVO_IRQn, 3, 2);                       /* 抢占优先级3，子优先级2, 低于步进电机 */
+    HAL_NVIC_EnableIRQ(GTIM_TIMX_SERVO_IRQn);
+
+    __HAL_TIM_CLEAR_IT(&g_timx_servo_handle, TIM_IT_UPDATE);                /* 清除更新中断标志 */
+    HAL_TIM_Base_Start_IT(&g_timx_servo_handle);                            /* 启动计数, 每20ms进一次更新中断 */
+}
@@ -0,0 +1,60 @@
+/**
+ ****************************************************************************************************
+ * @file        servo_tim.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       舵机PWM定时器 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __SERVO_TIM_H
+#define __SERVO_TIM_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 舵机定时器 定义 */
+
+/* TIMX PWM 定义
+ * 默认使用TIM3_CH1~CH3, 与步进电机的TIM8分开, 舵机周期不受步进速度影响.
+ * 注意: 通过修改这几个宏定义, 可以支持TIM2~TIM5等通用定时器
+ */
+#define GTIM_TIMX_SERVO_CH1_GPIO_PORT           GPIOA
+#define GTIM_TIMX_SERVO_CH1_GPIO_PIN            GPIO_PIN_6
+#define GTIM_TIMX_SERVO_CH1_GPIO_CLK_ENABLE()   do{ __HAL_RCC_GPIOA_CLK_ENABLE(); }while(0)   /* PA口时钟使能 */
+
+#define GTIM_TIMX_SERVO_CH2_GPIO_PORT           GPIOA
+#define GTIM_TIMX_SERVO_CH2_GPIO_PIN            GPIO_PIN_7
+#define GTIM_TIMX_SERVO_CH2_GPIO_CLK_ENABLE()   do{ __HAL_RCC_GPIOA_CLK_ENABLE(); }while(0)   /* PA口时钟使能 */
+
+#define GTIM_TIMX_SERVO_CH3_GPIO_PORT           GPIOB
+#define GTIM_TIMX_SERVO_CH3_GPIO_PIN            GPIO_PIN_0
+#define GTIM_TIMX_SERVO_CH3_GPIO_CLK_ENABLE()   do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)   /* PB口时钟使能 */
+
+#define GTIM_TIMX_SERVO_GPIO_AF                 GPIO_AF2_TIM3
+
+#define GTIM_TIMX_SERVO                         TIM3
+#define GTIM_TIMX_SERVO_IRQn                    TIM3_IRQn
+#define GTIM_TIMX_SERVO_IRQHandler              TIM3_IRQHandler
+#define GTIM_TIMX_SERVO_CLK_ENABLE()            do{ __HAL_RCC_TIM3_CLK_ENABLE(); }while(0)    /* TIM3 时钟使能 */
+
+#define GTIM_TIMX_SERVO_PSC                     (84 - 1)        /* APB1定时器时钟84MHz, 1us计数 */
+#define GTIM_TIMX_SERVO_ARR                     (20000 - 1)     /* 20ms周期, 50Hz */
+
+extern TIM_HandleTypeDef g_timx_servo_handle;                   /* 舵机定时器句柄 */
+
+/******************************************************************************************/
+
+void gtim_timx_servo_init(void);                                /* 舵机PWM初始化, 3个通道, 使能更新中断 */
+
+#endif
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        stepper_tim.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-19
- * @brief       ʱ 
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       定时器 驱动代码
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211019
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -27,78 +27,80 @@
 #include "./BSP/LED/led.h"
 
 /******************************************************************************************/
-/* ʱþ  */
+/* 定时器配置句柄 定义 */
 
-/* ߼ʱPWM */
-TIM_HandleTypeDef g_atimx_handle;           /* ʱx */
-TIM_OC_InitTypeDef g_atimx_oc_chy_handle;   /* ʱ */ 
+/* 高级定时器PWM */
+TIM_HandleTypeDef g_atimx_handle;           /* 定时器x句柄 */
+TIM_OC_InitTypeDef g_atimx_oc_chy_handle;   /* 定时器输出句柄 */ 
 /******************************************************************************************/
 
 /**
- * @brief       ߼ʱTIMX PWM ʼ
+ * @brief       高级定时器TIMX PWM 初始化函数
  * @note
- *              ߼ʱʱAPB2, PCLK2 = 168Mhz, PPRE2Ƶ, 
- *              ߼ʱʱ = 168Mhz
- *              ʱʱ㷽: Tout = ((arr + 1) * (psc + 1)) / Ft us.
- *              Ft=ʱƵ,λ:Mhz
+ *              高级定时器的时钟来自APB2, 而PCLK2 = 168Mhz, 我们设置PPRE2不分频, 因此
+ *              高级定时器时钟 = 168Mhz
+ *              定时器溢出时间计算方法: Tout = ((arr + 1) * (psc + 1)) / Ft us.
+ *              Ft=定时器工作频率,单位:Mhz
  *
- * @param       arr: Զװֵ
- * @param       psc: ʱԤƵ
- * @retval      
+ * @param       arr: 自动重装值
+ * @param       psc: 时钟预分频数
+ * @retval      无
  */
 void atim_timx_oc_chy_init(uint16_t arr, uint16_t psc)
 {
-    ATIM_TIMX_PWM_CHY_CLK_ENABLE();                             /* TIMX ʱʹ */
+    ATIM_TIMX_PWM_CHY_CLK_ENABLE();                             /* TIMX 时钟使能 */
 
-    g_atimx_handle.Instance = ATIM_TIMX_PWM;                    /* ʱx */
-    g_atimx_handle.Init.Prescaler = psc;                        /* ʱƵ */
-    g_atimx_handle.Init.CounterMode = TIM_COUNTERMODE_UP;       /* ϼģʽ */
-    g_atimx_handle.Init.Period = arr;                           /* Զװֵ */
-    g_atimx_handle.Init.ClockDivision=TIM_CLOCKDIVISION_DIV1;   /* Ƶ */
-    g_atimx_handle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE; /*ʹTIMx_ARRл*/
-    g_atimx_handle.Init.RepetitionCounter = 0;                  /* ʼʱ*/
-    HAL_TIM_PWM_Init(&g_atimx_handle);                          /* ʼPWM */
+    g_atimx_handle.Instance = ATIM_TIMX_PWM;                    /* 定时器x */
+    g_atimx_handle.Init.Prescaler = psc;                        /* 定时器分频 */
+    g_atimx_handle.Init.CounterMode = TIM_COUNTERMODE_UP;       /* 向上计数模式 */
+    g_atimx_handle.Init.Period = arr;                           /* 自动重装载值 */
+    g_atimx_handle.Init.ClockDivision=TIM_CLOCKDIVISION_DIV1;   /* 分频因子 */
+    g_atimx_handle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE; /*使能TIMx_ARR进行缓冲*/
+    g_atimx_handle.Init.RepetitionCounter = 0;                  /* 开始时不计数*/
+    HAL_TIM_PWM_Init(&g_atimx_handle);                          /* 初始化PWM */
     
-    g_atimx_oc_chy_handle.OCMode = TIM_OCMODE_PWM1;             /* ģʽѡPWM1 */
+    g_atimx_oc_chy_handle.OCMode = TIM_OCMODE_PWM1;             /* 模式选择PWM1 */
     g_atimx_oc_chy_handle.Pulse = arr/2;
-    g_atimx_oc_chy_handle.OCPolarity = TIM_OCPOLARITY_HIGH;     /* ȽϼΪ */
+    g_atimx_oc_chy_handle.OCPolarity = TIM_OCPOLARITY_HIGH;     /* 输出比较极性为高 */
     g_atimx_oc_chy_handle.OCNPolarity = TIM_OCNPOLARITY_HIGH;
     g_atimx_oc_chy_handle.OCFastMode = TIM_OCFAST_DISABLE;
     g_atimx_oc_chy_handle.OCIdleState = TIM_OCIDLESTATE_RESET;
     g_atimx_oc_chy_handle.OCNIdleState = TIM_OCNIDLESTATE_RESET;
-    HAL_TIM_PWM_ConfigChannel(&g_atimx_handle, &g_atimx_oc_chy_handle, ATIM_TIMX_PWM_CH1); /* TIMxͨy */
-    HAL_TIM_PWM_ConfigChannel(&g_atimx_handle, &g_atimx_oc_chy_handle, ATIM_TIMX_PWM_CH2); /* TIMxͨy */   
-    HAL_TIM_PWM_ConfigChannel(&g_atimx_handle, &g_atimx_oc_chy_handle, ATIM_TIMX_PWM_CH3); /* TIMxͨy */
-    HAL_TIM_PWM_ConfigChannel(&g_atimx_handle, &g_atimx_oc_chy_handle, ATIM_TIMX_PWM_CH4); /* TIMxͨy */
-   
+    HAL_TIM_PWM_ConfigChannel(&g_atimx_handle, &g_atimx_oc_chy_handle, ATIM_TIMX_PWM_CH1); /* 配置TIMx通道y */
+    HAL_TIM_PWM_ConfigChannel(&g_atimx_handle, &g_atimx_oc_chy_handle, ATIM_TIMX_PWM_CH2); /* 配置TIMx通道y */   
+    HAL_TIM_PWM_ConfigChannel(&g_atimx_handle, &g_atimx_oc_chy_handle, ATIM_TIMX_PWM_CH3); /* 配置TIMx通道y */
+    HAL_TIM_PWM_ConfigChannel(&g_atimx_handle, &g_atimx_oc_chy_handle, ATIM_TIMX_PWM_CH4); /* 配置TIMx通道y */
+    
+    __HAL_TIM_CLEAR_IT(&g_atimx_handle, TIM_IT_UPDATE);                                    /* 清除更新中断标志 */
+    __HAL_TIM_ENABLE_IT(&g_atimx_handle, TIM_IT_UPDATE);                                   /* 使能更新中断, 每个PWM周期计一步 */
 }
 
 
 /**
- * @brief       ʱײʱʹܣ
-                ˺ᱻHAL_TIM_PWM_Init()
- * @param       htim:ʱ
- * @retval      
+ * @brief       定时器底层驱动，时钟使能，引脚配置
+                此函数会被HAL_TIM_PWM_Init()调用
+ * @param       htim:定时器句柄
+ * @retval      无
  */
 void HAL_TIM_PWM_MspInit(TIM_HandleTypeDef *htim)
 {
     if (htim->Instance == ATIM_TIMX_PWM)
     {
         GPIO_InitTypeDef gpio_init_struct;
-        ATIM_TIMX_PWM_CHY_CLK_ENABLE();                             /* ͨyGPIOʱ */
-        ATIM_TIMX_PWM_CH1_GPIO_CLK_ENABLE();                        /* IOʱʹ */
-        ATIM_TIMX_PWM_CH2_GPIO_CLK_ENABLE();                        /* IOʱʹ */
-        ATIM_TIMX_PWM_CH3_GPIO_CLK_ENABLE();                        /* IOʱʹ */
-        ATIM_TIMX_PWM_CH4_GPIO_CLK_ENABLE();                        /* IOʱʹ */
+        ATIM_TIMX_PWM_CHY_CLK_ENABLE();                             /* 开启通道y的GPIO时钟 */
+        ATIM_TIMX_PWM_CH1_GPIO_CLK_ENABLE();                        /* IO时钟使能 */
+        ATIM_TIMX_PWM_CH2_GPIO_CLK_ENABLE();                        /* IO时钟使能 */
+        ATIM_TIMX_PWM_CH3_GPIO_CLK_ENABLE();                        /* IO时钟使能 */
+        ATIM_TIMX_PWM_CH4_GPIO_CLK_ENABLE();                        /* IO时钟使能 */
 
-        gpio_init_struct.Pin = ATIM_TIMX_PWM_CH1_GPIO_PIN;          /* ͨyGPIO */
-        gpio_init_struct.Mode = GPIO_MODE_AF_PP;                    /*  */
-        gpio_init_struct.Pull = GPIO_PULLUP;                        /*  */
-        gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;              /*  */
-        gpio_init_struct.Alternate = ATIM_TIMX_PWM_CHY_GPIO_AF;     /* ˿ڸ */
+        gpio_init_struct.Pin = ATIM_TIMX_PWM_CH1_GPIO_PIN;          /* 通道y的GPIO口 */
+        gpio_init_struct.Mode = GPIO_MODE_AF_PP;                    /* 复用推挽输出 */
+        gpio_init_struct.Pull = GPIO_PULLUP;                        /* 上拉 */
+        gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;              /* 高速 */
+        gpio_init_struct.Alternate = ATIM_TIMX_PWM_CHY_GPIO_AF;     /* 端口复用 */
         HAL_GPIO_Init(ATIM_TIMX_PWM_CH1_GPIO_PORT, &gpio_init_struct);
         
-        gpio_init_struct.Pin = ATIM_TIMX_PWM_CH2_GPIO_PIN;          /* ͨxGPIO */
+        gpio_init_struct.Pin = ATIM_TIMX_PWM_CH2_GPIO_PIN;          /* 通道x的GPIO口 */
         HAL_GPIO_Init(ATIM_TIMX_PWM_CH2_GPIO_PORT, &gpio_init_struct);
        
         gpio_init_struct.Pin = ATIM_TIMX_PWM_CH3_GPIO_PIN;         
@@ -106,5 +108,8 @@ void HAL_TIM_PWM_MspInit(TIM_HandleTypeDef *htim)
         
         gpio_init_struct.Pin = ATIM_TIMX_PWM_CH4_GPIO_PIN;          
         HAL_GPIO_Init(ATIM_TIMX_PWM_CH4_GPIO_PORT, &gpio_init_struct);
+        
+        HAL_NVIC_SetPriority(ATIM_TIMX_UP_IRQn, 1, 0);              /* 抢占优先级1，子优先级0 */
+        HAL_NVIC_EnableIRQ(ATIM_TIMX_UP_IRQn);                      /* 使能更新中断通道 */
     }
 }
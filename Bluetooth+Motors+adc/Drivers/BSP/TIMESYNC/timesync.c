@@ -0,0 +1,101 @@
+/**
+ ****************************************************************************************************
+ * @file        timesync.c
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       设备微秒时钟与上位机时钟同步 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#include "./BSP/TIMESYNC/timesync.h"
+#include "./BSP/ATK_MW579/atk_mw579_uart.h"
+
+
+timesync_t g_timesync;
+
+/* 已到达、等待应答的同步请求, 接收中断写入head, 主循环读出tail */
+static struct
+{
+    int32_t n[TIMESYNC_REQ_NUM];                /* 上位机的请求编号 */
+    uint32_t rx_us[TIMESYNC_REQ_NUM];           /* 到达时刻 */
+    volatile uint8_t head;
+    volatile uint8_t tail;
+} g_timesync_req;
+
+/**
+ * @brief       设备微秒时钟
+ * @note        在比SysTick优先级高的中断中调用时, SysTick可能已经回绕但节拍还没加1,
+ *              这时补上1ms并重新读计数值, 保证时钟不倒退
+ * @param       无
+ * @retval      上电以来的微秒数, 约71.6分钟回绕
+ */
+uint32_t timesync_us(void)
+{
+    uint32_t primask;
+    uint32_t ms;
+    uint32_t val;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    ms = HAL_GetTick();
+    val = SysTick->VAL;
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+    {
+        ms++;
+        val = SysTick->VAL;
+    }
+    __set_PRIMASK(primask);
+
+    return ms * 1000 + ((SysTick->LOAD - val) * 1000) / (SysTick->LOAD + 1);
+}
+
+/**
+ * @brief       记录同步请求的到达时刻
+ * @note        由sync紧急命令在接收中断中调用, 此时离命令帧接收完成只有一个字符的空闲时间
+ * @param       n: 上位机的请求编号, 原样应答
+ * @retval      无
+ */
+void timesync_rx(int32_t n)
+{
+    uint32_t rx_us = timesync_us();
+    uint8_t next = (g_timesync_req.head + 1) % TIMESYNC_REQ_NUM;
+
+    g_timesync.requests++;
+    if (next == g_timesync_req.tail)
+    {
+        g_timesync.drops++;                     /* 上位机收不到应答, 会当作一次丢失的交换 */
+        return;
+    }
+
+    g_timesync_req.n[g_timesync_req.head] = n;
+    g_timesync_req.rx_us[g_timesync_req.head] = rx_us;
+    g_timesync_req.head = next;
+}
+
+/**
+ * @brief       应答已到达的同步请求
+ * @note        应答时刻t3在入队前读取; 应答在发送队列中的等待计入返回路径的延时
+ * @param       无
+ * @retval      无
+ */
+void timesync_poll(void)
+{
+    uint8_t tail;
+
+    while (g_timesync_req.tail != g_timesync_req.head)
+    {
+        tail = g_timesync_req.tail;
+        atk_mw579_uart_printf("sync:%ld,%lu,%lu\r\n", g_timesync_req.n[tail], g_timesync_req.rx_us[tail], timesync_us());
+        g_timesync_req.tail = (tail + 1) % TIMESYNC_REQ_NUM;
+    }
+}
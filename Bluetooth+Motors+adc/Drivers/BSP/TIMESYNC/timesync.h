@@ -0,0 +1,51 @@
+/**
+ ****************************************************************************************************
+ * @file        timesync.h
+ * @author      ECE445 Micro-Penetrometer
+ * @version     V1.0
+ * @date        2026-10-19
+ * @brief       设备微秒时钟与上位机时钟同步 驱动代码
+ ****************************************************************************************************
+ * @attention
+ *
+ * 实验平台:正点原子 F407电机开发板
+ *
+ * 微秒时钟: HAL的1ms节拍 x 1000 + SysTick当前周期内已经过的微秒数, 32位, 约71.6分钟回绕一次,
+ *           上位机按差值展开. 不占用定时器(TIM2/TIM5这两个32位定时器已用于脉冲捕获和编码器).
+ * 同步交换(NTP方式): 上位机在t1发送"sync <n>"; sync是紧急命令, 接收中断中记下到达时刻t2;
+ *           主循环中应答"sync:<n>,<t2>,<t3>", t3为应答入队时刻; 上位机在t4收到.
+ *           偏差 = ((t2 - t1) + (t3 - t4)) / 2, 误差不超过往返延时(t4 - t1) - (t3 - t2)的一半,
+ *           上位机取延时最小的几次拟合偏差和漂移, 把样本的设备时刻换算成上位机时刻.
+ *
+ * 修改说明
+ * V1.0 20261019
+ * 第一次发布
+ *
+ ****************************************************************************************************
+ */
+
+#ifndef __TIMESYNC_H
+#define __TIMESYNC_H
+
+#include "./SYSTEM/sys/sys.h"
+
+/******************************************************************************************/
+/* 配置 */
+
+#define TIMESYNC_REQ_NUM        4               /* 等待应答的同步请求数 */
+
+typedef struct
+{
+    uint32_t requests;                          /* 收到的同步请求数 */
+    uint32_t drops;                             /* 应答队列满丢弃的请求数 */
+} timesync_t;
+
+extern timesync_t g_timesync;
+
+/******************************************************************************************/
+/* 外部接口函数*/
+uint32_t timesync_us(void);                                             /* 设备微秒时钟, 可在中断中调用 */
+void timesync_rx(int32_t n);                                            /* 记录同步请求的到达时刻, 在接收中断中调用 */
+void timesync_poll(void);                                               /* 应答已到达的同步请求, 在主循环中调用 */
+
+#endif
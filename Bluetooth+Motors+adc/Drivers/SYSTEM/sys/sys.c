@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        sys.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief       ϵͳʼ(ʱ/жϹ/GPIOõ)
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       系统初始化代码(包括时钟配置/中断管理/GPIO设置等)
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  ****************************************************************************************************
  */
 
@@ -25,21 +25,21 @@
 
 
 /**
- * @brief       жƫƵַ
- * @param       baseaddr : ַ
- * @param       offset   : ƫ
- * @retval      
+ * @brief       设置中断向量表偏移地址
+ * @param       baseaddr : 基址
+ * @param       offset   : 偏移量
+ * @retval      无
  */
 void sys_nvic_set_vector_table(uint32_t baseaddr, uint32_t offset)
 {
-    /* NVICƫƼĴ,VTOR9λ,[8:0] */
+    /* 设置NVIC的向量表偏移寄存器,VTOR低9位保留,即[8:0]保留 */
     SCB->VTOR = baseaddr | (offset & (uint32_t)0xFFFFFE00);
 }
 
 /**
- * @brief       ִ: WFIָ(ִָ͹״̬, ȴжϻ)
- * @param       
- * @retval      
+ * @brief       执行: WFI指令(执行完该指令进入低功耗状态, 等待中断唤醒)
+ * @param       无
+ * @retval      无
  */
 void sys_wfi_set(void)
 {
@@ -47,9 +47,9 @@ void sys_wfi_set(void)
 }
 
 /**
- * @brief       رж(ǲfaultNMIж)
- * @param       
- * @retval      
+ * @brief       关闭所有中断(但是不包括fault和NMI中断)
+ * @param       无
+ * @retval      无
  */
 void sys_intx_disable(void)
 {
@@ -57,9 +57,9 @@ void sys_intx_disable(void)
 }
 
 /**
- * @brief       ж
- * @param       
- * @retval      
+ * @brief       开启所有中断
+ * @param       无
+ * @retval      无
  */
 void sys_intx_enable(void)
 {
@@ -67,31 +67,31 @@ void sys_intx_enable(void)
 }
 
 /**
- * @brief       ջַ
- * @note        кX, MDK, ʵû
- * @param       addr: ջַ
- * @retval      
+ * @brief       设置栈顶地址
+ * @note        左侧若有红X, 属于MDK误报, 实际是没问题的
+ * @param       addr: 栈顶地址
+ * @retval      无
  */
 void sys_msr_msp(uint32_t addr)
 {
-    __set_MSP(addr);    /* ջַ */
+    __set_MSP(addr);    /* 设置栈顶地址 */
 }
 
 /**
- * @brief       ģʽ
- * @param       
- * @retval      
+ * @brief       进入待机模式
+ * @param       无
+ * @retval      无
  */
 void sys_standby(void)
 {
-    __HAL_RCC_PWR_CLK_ENABLE();    /* ʹܵԴʱ */
-    SET_BIT(PWR->CR, PWR_CR_PDDS); /* ģʽ */
+    __HAL_RCC_PWR_CLK_ENABLE();    /* 使能电源时钟 */
+    SET_BIT(PWR->CR, PWR_CR_PDDS); /* 进入待机模式 */
 }
 
 /**
- * @brief       ϵͳλ
- * @param       
- * @retval      
+ * @brief       系统软复位
+ * @param       无
+ * @retval      无
  */
 void sys_soft_reset(void)
 {
@@ -99,27 +99,27 @@ void sys_soft_reset(void)
 }
 
 /**
- * @brief       ʱú
- * @param       plln: PLL1Ƶϵ(PLLƵ), ȡֵΧ: 64~432.
- * @param       pllm: PLL1ԤƵϵ(PLL֮ǰķƵ), ȡֵΧ: 2~63.
- * @param       pllp: PLL1pƵϵ(PLL֮ķƵ), ƵΪϵͳʱ, ȡֵΧ: 2,4,6,8.(4ֵ!)
- * @param       pllq: PLL1qƵϵ(PLL֮ķƵ), ȡֵΧ: 2~15.
+ * @brief       时钟设置函数
+ * @param       plln: PLL1倍频系数(PLL倍频), 取值范围: 64~432.
+ * @param       pllm: PLL1预分频系数(进PLL之前的分频), 取值范围: 2~63.
+ * @param       pllp: PLL1的p分频系数(PLL之后的分频), 分频后作为系统时钟, 取值范围: 2,4,6,8.(仅限这4个值!)
+ * @param       pllq: PLL1的q分频系数(PLL之后的分频), 取值范围: 2~15.
  * @note
  *
- *              Fvco: VCOƵ
- *              Fsys: ϵͳʱƵ, ҲPLL1pƵʱƵ
- *              Fq:   PLL1qƵʱƵ
- *              Fs:   PLLʱƵ, HSI, CSI, HSE.
+ *              Fvco: VCO频率
+ *              Fsys: 系统时钟频率, 也是PLL1的p分频输出时钟频率
+ *              Fq:   PLL1的q分频输出时钟频率
+ *              Fs:   PLL输入时钟频率, 可以是HSI, CSI, HSE等.
  *              Fvco = Fs * (plln / pllm);
  *              Fsys = Fvco / pllp = Fs * (plln / (pllm * pllp));
  *              Fq   = Fvco / pllq = Fs * (plln / (pllm * pllq));
  *
- *              ⲿΪ8Mʱ, Ƽֵ: plln = 336, pllm = 8, pllp = 2, pllq = 7.
- *              õ:Fvco = 8 * (336 / 8) = 336Mhz
+ *              外部晶振为8M的时候, 推荐值: plln = 336, pllm = 8, pllp = 2, pllq = 7.
+ *              得到:Fvco = 8 * (336 / 8) = 336Mhz
  *                   Fsys = pll1_p_ck = 336 / 2 = 168Mhz
  *                   Fq   = pll1_q_ck = 336 / 7 = 48
  *
- * @retval      : 0, ɹ; 1, ;
+ * @retval      错误代码: 0, 成功; 1, 错误;
  */
 uint8_t sys_stm32_clock_init(uint32_t plln, uint32_t pllm, uint32_t pllp, uint32_t pllq)
 {
@@ -127,49 +127,49 @@ uint8_t sys_stm32_clock_init(uint32_t plln, uint32_t pllm, uint32_t pllp, uint32
     RCC_ClkInitTypeDef rcc_clk_init_handle;
     RCC_OscInitTypeDef rcc_osc_init_handle;
     
-    __HAL_RCC_PWR_CLK_ENABLE();                                         /* ʹPWRʱ */
+    __HAL_RCC_PWR_CLK_ENABLE();                                         /* 使能PWR时钟 */
     
-    /* õѹѹԱƵʹʱʹ빦ʵƽ */
+    /* 下面这个设置用来设置调压器输出电压级别，以便在器件以最大频率工作时使性能与功耗实现平衡 */
 
-    __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);      /* VOS = 1, Scale1, 1.2Vں˵ѹ,FLASHʿԵõ */
+    __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);      /* VOS = 1, Scale1, 1.2V内核电压,FLASH访问可以得到最高性能 */
 
-    /* ʹHSEѡHSEΪPLLʱԴPLL1USBʱ */
-    rcc_osc_init_handle.OscillatorType = RCC_OSCILLATORTYPE_HSE;        /* ʱԴΪHSE */
-    rcc_osc_init_handle.HSEState = RCC_HSE_ON;                          /* HSE */
-    rcc_osc_init_handle.PLL.PLLState = RCC_PLL_ON;                      /* PLL */
-    rcc_osc_init_handle.PLL.PLLSource = RCC_PLLSOURCE_HSE;              /* PLLʱԴѡHSE */
+    /* 使能HSE，并选择HSE作为PLL时钟源，配置PLL1，开启USB时钟 */
+    rcc_osc_init_handle.OscillatorType = RCC_OSCILLATORTYPE_HSE;        /* 时钟源为HSE */
+    rcc_osc_init_handle.HSEState = RCC_HSE_ON;                          /* 打开HSE */
+    rcc_osc_init_handle.PLL.PLLState = RCC_PLL_ON;                      /* 打开PLL */
+    rcc_osc_init_handle.PLL.PLLSource = RCC_PLLSOURCE_HSE;              /* PLL时钟源选择HSE */
     rcc_osc_init_handle.PLL.PLLN = plln;
     rcc_osc_init_handle.PLL.PLLM = pllm;
     rcc_osc_init_handle.PLL.PLLP = pllp;
     rcc_osc_init_handle.PLL.PLLQ = pllq;
 
-    ret = HAL_RCC_OscConfig(&rcc_osc_init_handle);                      /* ʼRCC */
+    ret = HAL_RCC_OscConfig(&rcc_osc_init_handle);                      /* 初始化RCC */
     if(ret != HAL_OK)
     {
-        return 1;                                                       /* ʱӳʼʧܣԼĴ */
+        return 1;                                                       /* 时钟初始化失败，可以在这里加入自己的处理 */
     }
 
-    /* ѡPLLΪϵͳʱԴHCLK,PCLK1PCLK2*/
+    /* 选中PLL作为系统时钟源并且配置HCLK,PCLK1和PCLK2*/
     rcc_clk_init_handle.ClockType = ( RCC_CLOCKTYPE_SYSCLK \
                                     | RCC_CLOCKTYPE_HCLK \
                                     | RCC_CLOCKTYPE_PCLK1 \
                                     | RCC_CLOCKTYPE_PCLK2);
 
-    rcc_clk_init_handle.SYSCLKSource   = RCC_SYSCLKSOURCE_PLLCLK;       /* ϵͳʱʱԴΪPLL */
-    rcc_clk_init_handle.AHBCLKDivider  = RCC_SYSCLK_DIV1;               /* AHBƵϵΪ1 */
-    rcc_clk_init_handle.APB1CLKDivider = RCC_HCLK_DIV4;                 /* APB1ƵϵΪ4 */
-    rcc_clk_init_handle.APB2CLKDivider = RCC_HCLK_DIV2;                 /* APB2ƵϵΪ2 */
+    rcc_clk_init_handle.SYSCLKSource   = RCC_SYSCLKSOURCE_PLLCLK;       /* 设置系统时钟时钟源为PLL */
+    rcc_clk_init_handle.AHBCLKDivider  = RCC_SYSCLK_DIV1;               /* AHB分频系数为1 */
+    rcc_clk_init_handle.APB1CLKDivider = RCC_HCLK_DIV4;                 /* APB1分频系数为4 */
+    rcc_clk_init_handle.APB2CLKDivider = RCC_HCLK_DIV2;                 /* APB2分频系数为2 */
 
-    ret = HAL_RCC_ClockConfig(&rcc_clk_init_handle, FLASH_LATENCY_5);   /* ͬʱFLASHʱΪ5WSҲ6CPU */
+    ret = HAL_RCC_ClockConfig(&rcc_clk_init_handle, FLASH_LATENCY_5);   /* 同时设置FLASH延时周期为5WS，也就是6个CPU周期 */
     if(ret != HAL_OK)
     {
-        return 1;                                                       /* ʱӳʼʧ */
+        return 1;                                                       /* 时钟初始化失败 */
     }
     
-    /* STM32F405x/407x/415x/417x Z汾֧Ԥȡ */
+    /* STM32F405x/407x/415x/417x Z版本的器件支持预取功能 */
     if (HAL_GetREVID() == 0x1001)
     {
-        __HAL_FLASH_PREFETCH_BUFFER_ENABLE();                           /* ʹflashԤȡ */
+        __HAL_FLASH_PREFETCH_BUFFER_ENABLE();                           /* 使能flash预取 */
     }
     return 0;
 }
@@ -177,10 +177,10 @@ uint8_t sys_stm32_clock_init(uint32_t plln, uint32_t pllm, uint32_t pllp, uint32
 #ifdef  USE_FULL_ASSERT
 
 /**
- * @brief       ʾʱ˺ļ
- * @param       fileָԴļ
- *              lineָļе
- * @retval      
+ * @brief       当编译提示出错的时候此函数用来报告错误的文件和所在行
+ * @param       file：指向源文件
+ *              line：指向在文件中的行数
+ * @retval      无
  */
 void assert_failed(uint8_t* file, uint32_t line)
 { 
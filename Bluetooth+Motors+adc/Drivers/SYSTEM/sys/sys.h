@@ -1,21 +1,21 @@
 /**
  ****************************************************************************************************
  * @file        sys.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief       ϵͳʼ(ʱ/жϹ/GPIOõ)
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       系统初始化代码(包括时钟配置/中断管理/GPIO设置等)
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * һη
+ * 第一次发布
  * V1.0 20211014
 
  ****************************************************************************************************
@@ -30,26 +30,49 @@
 
 
 /**
- * SYS_SUPPORT_OSڶϵͳļǷ֧OS
- * 0,֧OS
- * 1,֧OS
+ * SYS_SUPPORT_OS用于定义系统文件夹是否支持OS
+ * 0,不支持OS
+ * 1,支持OS
  */
 #define SYS_SUPPORT_OS         0
 
 
-/********************************************************************************************/
+/**
+ * 引脚快速操作
+ * 引脚描述符由 端口, 引脚, 有效电平(1:高有效, 0:低有效) 三项组成, 都在编译时确定, 例如:
+ * #define LED0_IO      LED0_GPIO_PORT, LED0_GPIO_PIN, 0
+ * 写操作编译为一条BSRR存储指令(原子操作, 不需要读-改-写), 没有函数调用和参数检查, 可在中断中使用
+ * SYS_IO_WRITE写入的是引脚电平, SYS_IO_ON/SYS_IO_OFF按有效电平写入
+ */
+#define SYS_IO_WRITE(io, x)                 SYS_IO_WRITE_(io, x)        /* 输出电平x */
+#define SYS_IO_ON(io)                       SYS_IO_ON_(io)              /* 输出有效电平 */
+#define SYS_IO_OFF(io)                      SYS_IO_OFF_(io)             /* 输出无效电平 */
+#define SYS_IO_TOGGLE(io)                   SYS_IO_TOGGLE_(io)          /* 电平取反 */
+#define SYS_IO_READ(io)                     SYS_IO_READ_(io)            /* 读取引脚电平, 0/1 */
+#define SYS_IO_ACTIVE(io)                   SYS_IO_ACTIVE_(io)          /* 引脚处于有效电平时为1 */
+
+/* 以下为展开描述符用的内部宏, 外层宏展开io后再按三个参数调用 */
+#define SYS_IO_WRITE_(port, pin, act, x)    ((port)->BSRR = (x) ? (uint32_t)(pin) : ((uint32_t)(pin) << 16))
+#define SYS_IO_ON_(port, pin, act)          SYS_IO_WRITE_(port, pin, act, act)
+#define SYS_IO_OFF_(port, pin, act)         SYS_IO_WRITE_(port, pin, act, !(act))
+#define SYS_IO_TOGGLE_(port, pin, act)      ((port)->BSRR = ((port)->ODR & (pin)) ? ((uint32_t)(pin) << 16) : (uint32_t)(pin))
+#define SYS_IO_READ_(port, pin, act)        ((((port)->IDR & (pin)) != 0) ? 1 : 0)
+#define SYS_IO_ACTIVE_(port, pin, act)      (SYS_IO_READ_(port, pin, act) == (act))
+
+
+/*函数声明*******************************************************************************************/
 
-void sys_nvic_set_vector_table(uint32_t baseaddr, uint32_t offset);                         /* жƫ */
-void sys_standby(void);                                                                     /* ģʽ */
-void sys_soft_reset(void);                                                                  /* ϵͳλ */
-uint8_t sys_stm32_clock_init(uint32_t plln, uint32_t pllm, uint32_t pllp, uint32_t pllq);   /* ϵͳʱ */
+void sys_nvic_set_vector_table(uint32_t baseaddr, uint32_t offset);                         /* 设置中断偏移量 */
+void sys_standby(void);                                                                     /* 进入待机模式 */
+void sys_soft_reset(void);                                                                  /* 系统软复位 */
+uint8_t sys_stm32_clock_init(uint32_t plln, uint32_t pllm, uint32_t pllp, uint32_t pllq);   /* 配置系统时钟 */
 
 
-/* Ϊຯ */
-void sys_wfi_set(void);             /* ִWFIָ */
-void sys_intx_disable(void);        /* رж */
-void sys_intx_enable(void);         /* ж */
-void sys_msr_msp(uint32_t addr);    /* ջַ */
+/* 以下为汇编函数 */
+void sys_wfi_set(void);             /* 执行WFI指令 */
+void sys_intx_disable(void);        /* 关闭所有中断 */
+void sys_intx_enable(void);         /* 开启所有中断 */
+void sys_msr_msp(uint32_t addr);    /* 设置栈顶地址 */
 
 #endif
 
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        usart.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief       ڳʼ(һǴ1)֧printf
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       串口初始化代码(一般是串口1)，支持printf
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -26,21 +26,21 @@
 #include "./SYSTEM/usart/usart.h"
 #include "./BSP/ATK_MW579/atk_mw579.h"
 
-/* ʹOS,ͷļ */
+/* 如果使用OS,则包括下面的头文件即可 */
 #if SYS_SUPPORT_OS
-#include "includes.h"                               /* OS ʹ */
+#include "includes.h"                               /* OS 使用 */
 #endif
 
 /******************************************************************************************/
-/* ´, ֧printf, Ҫѡuse MicroLIB */
+/* 加入以下代码, 支持printf函数, 而不需要选择use MicroLIB */
 
 #if 1
-#if (__ARMCC_VERSION >= 6010050)                    /* ʹAC6ʱ */
-__asm(".global __use_no_semihosting\n\t");          /* ʹðģʽ */
-__asm(".global __ARM_use_no_argv \n\t");            /* AC6ҪmainΪ޲ʽ򲿷ְ̿ܳģʽ */
+#if (__ARMCC_VERSION >= 6010050)                    /* 使用AC6编译器时 */
+__asm(".global __use_no_semihosting\n\t");          /* 声明不使用半主机模式 */
+__asm(".global __ARM_use_no_argv \n\t");            /* AC6下需要声明main函数为无参数格式，否则部分例程可能出现半主机模式 */
 
 #else
-/* ʹAC5ʱ, Ҫﶨ__FILE  ʹðģʽ */
+/* 使用AC5编译器时, 要在这里定义__FILE 和 不使用半主机模式 */
 #pragma import(__use_no_semihosting)
 
 struct __FILE
@@ -53,14 +53,14 @@ struct __FILE
 
 #endif
 
-/* ʹðģʽҪض_ttywrch\_sys_exit\_sys_command_string,ͬʱAC6AC5ģʽ */
+/* 不使用半主机模式，至少需要重定义_ttywrch\_sys_exit\_sys_command_string函数,以同时兼容AC6和AC5模式 */
 int _ttywrch(int ch)
 {
     ch = ch;
     return ch;
 }
 
-/* _sys_exit()Աʹðģʽ */
+/* 定义_sys_exit()以避免使用半主机模式 */
 void _sys_exit(int x)
 {
     x = x;
@@ -71,142 +71,142 @@ char *_sys_command_string(char *cmd, int len)
     return NULL;
 }
 
-/* FILE  stdio.h涨. */
+/* FILE 在 stdio.h里面定义. */
 FILE __stdout;
 
-/* ضfputc, printfջͨfputcַ */
+/* 重定义fputc函数, printf函数最终会通过调用fputc输出字符串到串口 */
 int fputc(int ch, FILE *f)
 {
-    while ((USART_UX->SR & 0X40) == 0);             /* ȴһַ */
+    while ((USART_UX->SR & 0X40) == 0);             /* 等待上一个字符发送完成 */
 
-    USART_UX->DR = (uint8_t)ch;                     /* Ҫ͵ַ ch д뵽DRĴ */
+    USART_UX->DR = (uint8_t)ch;                     /* 将要发送的字符 ch 写入到DR寄存器 */
     return ch;
 }
 #endif
 /***********************************************END*******************************************/
     
-#if USART_EN_RX                                     /* ʹ˽ */
+#if USART_EN_RX                                     /* 如果使能了接收 */
 
-/* ջ, USART_REC_LENֽ. */
+/* 接收缓冲, 最大USART_REC_LEN个字节. */
 uint8_t g_usart_rx_buf[USART_REC_LEN];
 
-/*  ״̬
- *  bit15      ɱ־
- *  bit14      յ0x0d
- *  bit13~0    յЧֽĿ
+/*  接收状态
+ *  bit15，      接收完成标志
+ *  bit14，      接收到0x0d
+ *  bit13~0，    接收到的有效字节数目
 */
 uint16_t g_usart_rx_sta = 0;
 
-uint8_t g_rx_buffer[RXBUFFERSIZE];                  /* HALʹõĴڽջ */
+uint8_t g_rx_buffer[RXBUFFERSIZE];                  /* HAL库使用的串口接收缓冲 */
 
-UART_HandleTypeDef g_uart1_handle;                  /* UART */
+UART_HandleTypeDef g_uart1_handle;                  /* UART句柄 */
 
 
 /**
- * @brief       Xʼ
- * @param       baudrate: , ԼҪòֵ
- * @note        ע: ȷʱԴ, 򴮿ڲʾͻ쳣.
- *              USARTʱԴsys_stm32_clock_init()Ѿù.
- * @retval      
+ * @brief       串口X初始化函数
+ * @param       baudrate: 波特率, 根据自己需要设置波特率值
+ * @note        注意: 必须设置正确的时钟源, 否则串口波特率就会设置异常.
+ *              这里的USART的时钟源在sys_stm32_clock_init()函数中已经设置过了.
+ * @retval      无
  */
 void usart_init(uint32_t baudrate)
 {
     g_uart1_handle.Instance = USART_UX;                         /* USART1 */
-    g_uart1_handle.Init.BaudRate = baudrate;                    /*  */
-    g_uart1_handle.Init.WordLength = UART_WORDLENGTH_8B;        /* ֳΪ8λݸʽ */
-    g_uart1_handle.Init.StopBits = UART_STOPBITS_1;             /* һֹͣλ */
-    g_uart1_handle.Init.Parity = UART_PARITY_NONE;              /* żУλ */
-    g_uart1_handle.Init.HwFlowCtl = UART_HWCONTROL_NONE;        /* Ӳ */
-    g_uart1_handle.Init.Mode = UART_MODE_TX_RX;                 /* շģʽ */
-    HAL_UART_Init(&g_uart1_handle);                             /* HAL_UART_Init()ʹUART1 */
+    g_uart1_handle.Init.BaudRate = baudrate;                    /* 波特率 */
+    g_uart1_handle.Init.WordLength = UART_WORDLENGTH_8B;        /* 字长为8位数据格式 */
+    g_uart1_handle.Init.StopBits = UART_STOPBITS_1;             /* 一个停止位 */
+    g_uart1_handle.Init.Parity = UART_PARITY_NONE;              /* 无奇偶校验位 */
+    g_uart1_handle.Init.HwFlowCtl = UART_HWCONTROL_NONE;        /* 无硬件流控 */
+    g_uart1_handle.Init.Mode = UART_MODE_TX_RX;                 /* 收发模式 */
+    HAL_UART_Init(&g_uart1_handle);                             /* HAL_UART_Init()会使能UART1 */
     
-    /* úῪжϣ־λUART_IT_RXNEýջԼջ */
+    /* 该函数会开启接收中断：标志位UART_IT_RXNE，并且设置接收缓冲以及接收缓冲接收最大数据量 */
     HAL_UART_Receive_IT(&g_uart1_handle, (uint8_t *)g_rx_buffer, RXBUFFERSIZE);
 }
 
 /**
- * @brief       UARTײʼ
- * @param       huart: UARTָ
- * @note        ˺ᱻHAL_UART_Init()
- *              ʱʹܣãж
- * @retval      
+ * @brief       UART底层初始化函数
+ * @param       huart: UART句柄类型指针
+ * @note        此函数会被HAL_UART_Init()调用
+ *              完成时钟使能，引脚配置，中断配置
+ * @retval      无
  */
 void HAL_UART_MspInit(UART_HandleTypeDef *huart)
 {
     GPIO_InitTypeDef gpio_init_struct;
-    if(huart->Instance == USART_UX)                               /* Ǵ1д1 MSPʼ */
+    if(huart->Instance == USART_UX)                               /* 如果是串口1，进行串口1 MSP初始化 */
     {
-        USART_UX_CLK_ENABLE();                                  /* USART1 ʱʹ */
-        USART_TX_GPIO_CLK_ENABLE();                             /* ʱʹ */
-        USART_RX_GPIO_CLK_ENABLE();                             /* ʱʹ */
+        USART_UX_CLK_ENABLE();                                  /* USART1 时钟使能 */
+        USART_TX_GPIO_CLK_ENABLE();                             /* 发送引脚时钟使能 */
+        USART_RX_GPIO_CLK_ENABLE();                             /* 接收引脚时钟使能 */
         
-        gpio_init_struct.Pin = USART_TX_GPIO_PIN;               /* TX */
-        gpio_init_struct.Mode = GPIO_MODE_AF_PP;                /*  */
-        gpio_init_struct.Pull = GPIO_PULLUP;                    /*  */
-        gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;          /*  */
-        gpio_init_struct.Alternate = USART_TX_GPIO_AF;          /* ΪUSART1 */
-        HAL_GPIO_Init(USART_TX_GPIO_PORT, &gpio_init_struct);   /* ʼ */
+        gpio_init_struct.Pin = USART_TX_GPIO_PIN;               /* TX引脚 */
+        gpio_init_struct.Mode = GPIO_MODE_AF_PP;                /* 复用推挽输出 */
+        gpio_init_struct.Pull = GPIO_PULLUP;                    /* 上拉 */
+        gpio_init_struct.Speed = GPIO_SPEED_FREQ_HIGH;          /* 高速 */
+        gpio_init_struct.Alternate = USART_TX_GPIO_AF;          /* 复用为USART1 */
+        HAL_GPIO_Init(USART_TX_GPIO_PORT, &gpio_init_struct);   /* 初始化发送引脚 */
 
-        gpio_init_struct.Pin = USART_RX_GPIO_PIN;               /* RX */
-        gpio_init_struct.Alternate = USART_RX_GPIO_AF;          /* ΪUSART1 */
-        HAL_GPIO_Init(USART_RX_GPIO_PORT, &gpio_init_struct);   /* ʼ */
+        gpio_init_struct.Pin = USART_RX_GPIO_PIN;               /* RX引脚 */
+        gpio_init_struct.Alternate = USART_RX_GPIO_AF;          /* 复用为USART1 */
+        HAL_GPIO_Init(USART_RX_GPIO_PORT, &gpio_init_struct);   /* 初始化接收引脚 */
 
 #if USART_EN_RX
-        HAL_NVIC_EnableIRQ(USART_UX_IRQn);                      /* ʹUSART1жͨ */
-        HAL_NVIC_SetPriority(USART_UX_IRQn, 3, 3);              /* ռȼ3ȼ3 */
+        HAL_NVIC_EnableIRQ(USART_UX_IRQn);                      /* 使能USART1中断通道 */
+        HAL_NVIC_SetPriority(USART_UX_IRQn, 3, 3);              /* 抢占优先级3，子优先级3 */
 #endif
     }
-    else if (huart->Instance == ATK_MW579_UART_INTERFACE)               /* ATK-MW579 UART */
+    else if (huart->Instance == ATK_MW579_UART_INTERFACE)               /* 如果是ATK-MW579 UART */
     {
-        ATK_MW579_UART_TX_GPIO_CLK_ENABLE();                            /* ʹUART TXʱ */
-        ATK_MW579_UART_RX_GPIO_CLK_ENABLE();                            /* ʹUART RXʱ */
-        ATK_MW579_UART_CLK_ENABLE();                                    /* ʹUARTʱ */
+        ATK_MW579_UART_TX_GPIO_CLK_ENABLE();                            /* 使能UART TX引脚时钟 */
+        ATK_MW579_UART_RX_GPIO_CLK_ENABLE();                            /* 使能UART RX引脚时钟 */
+        ATK_MW579_UART_CLK_ENABLE();                                    /* 使能UART时钟 */
         
-        gpio_init_struct.Pin        = ATK_MW579_UART_TX_GPIO_PIN;       /* UART TX */
-        gpio_init_struct.Mode       = GPIO_MODE_AF_PP;                  /*  */
-        gpio_init_struct.Pull       = GPIO_NOPULL;                      /*  */
-        gpio_init_struct.Speed      = GPIO_SPEED_FREQ_HIGH;             /*  */
-        gpio_init_struct.Alternate  = ATK_MW579_UART_TX_GPIO_AF;        /* ΪUART4 */
-        HAL_GPIO_Init(ATK_MW579_UART_TX_GPIO_PORT, &gpio_init_struct);  /* ʼUART TX */
+        gpio_init_struct.Pin        = ATK_MW579_UART_TX_GPIO_PIN;       /* UART TX引脚 */
+        gpio_init_struct.Mode       = GPIO_MODE_AF_PP;                  /* 复用推挽输出 */
+        gpio_init_struct.Pull       = GPIO_NOPULL;                      /* 无上下拉 */
+        gpio_init_struct.Speed      = GPIO_SPEED_FREQ_HIGH;             /* 高速 */
+        gpio_init_struct.Alternate  = ATK_MW579_UART_TX_GPIO_AF;        /* 复用为UART4 */
+        HAL_GPIO_Init(ATK_MW579_UART_TX_GPIO_PORT, &gpio_init_struct);  /* 初始化UART TX引脚 */
         
-        gpio_init_struct.Pin        = ATK_MW579_UART_RX_GPIO_PIN;       /* UART RX */
-        gpio_init_struct.Mode       = GPIO_MODE_AF_PP;                  /*  */
-        gpio_init_struct.Pull       = GPIO_NOPULL;                      /*  */
-        gpio_init_struct.Speed      = GPIO_SPEED_FREQ_HIGH;             /*  */
-        gpio_init_struct.Alternate  = ATK_MW579_UART_RX_GPIO_AF;        /* ΪUART4 */
-        HAL_GPIO_Init(ATK_MW579_UART_RX_GPIO_PORT, &gpio_init_struct);  /* ʼUART RX */
+        gpio_init_struct.Pin        = ATK_MW579_UART_RX_GPIO_PIN;       /* UART RX引脚 */
+        gpio_init_struct.Mode       = GPIO_MODE_AF_PP;                  /* 复用推挽输出 */
+        gpio_init_struct.Pull       = GPIO_NOPULL;                      /* 无上下拉 */
+        gpio_init_struct.Speed      = GPIO_SPEED_FREQ_HIGH;             /* 高速 */
+        gpio_init_struct.Alternate  = ATK_MW579_UART_RX_GPIO_AF;        /* 复用为UART4 */
+        HAL_GPIO_Init(ATK_MW579_UART_RX_GPIO_PORT, &gpio_init_struct);  /* 初始化UART RX引脚 */
         
-        HAL_NVIC_SetPriority(ATK_MW579_UART_IRQn, 0, 0);                /* ռȼ0ȼ0 */
-        HAL_NVIC_EnableIRQ(ATK_MW579_UART_IRQn);                        /* ʹUARTжͨ */
+        HAL_NVIC_SetPriority(ATK_MW579_UART_IRQn, 1, 1);                /* 抢占优先级1，子优先级1, 优先级0留给急停 */
+        HAL_NVIC_EnableIRQ(ATK_MW579_UART_IRQn);                        /* 使能UART中断通道 */
         
-        __HAL_UART_ENABLE_IT(huart, UART_IT_RXNE);                      /* ʹUARTж */
-        __HAL_UART_ENABLE_IT(huart, UART_IT_IDLE);                      /* ʹUART߿ж */
+        __HAL_UART_ENABLE_IT(huart, UART_IT_IDLE);                      /* 使能UART总线空闲中断, 数据由DMA接收 */
+        __HAL_UART_ENABLE_IT(huart, UART_IT_ERR);                       /* 使能UART错误中断(DMA接收时的帧错误/噪声/过载) */
     }
 }
 
 /**
- * @brief       Rxص
- * @param       huart: UARTָ
- * @retval      
+ * @brief       Rx传输回调函数
+ * @param       huart: UART句柄类型指针
+ * @retval      无
  */
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
-    if(huart->Instance == USART_UX)             /* Ǵ1 */
+    if(huart->Instance == USART_UX)             /* 如果是串口1 */
     {
-        if((g_usart_rx_sta & 0x8000) == 0)      /* δ */
+        if((g_usart_rx_sta & 0x8000) == 0)      /* 接收未完成 */
         {
-            if(g_usart_rx_sta & 0x4000)         /* յ0x0d */
+            if(g_usart_rx_sta & 0x4000)         /* 接收到了0x0d */
             {
                 if(g_rx_buffer[0] != 0x0a) 
                 {
-                    g_usart_rx_sta = 0;         /* մ,¿ʼ */
+                    g_usart_rx_sta = 0;         /* 接收错误,重新开始 */
                 }
                 else 
                 {
-                    g_usart_rx_sta |= 0x8000;   /*  */
+                    g_usart_rx_sta |= 0x8000;   /* 接收完成了 */
                 }
             }
-            else                                /* ûյ0X0D */
+            else                                /* 还没收到0X0D */
             {
                 if(g_rx_buffer[0] == 0x0d)
                 {
@@ -218,7 +218,7 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
                     g_usart_rx_sta++;
                     if(g_usart_rx_sta > (USART_REC_LEN - 1))
                     {
-                        g_usart_rx_sta = 0;     /* ݴ,¿ʼ */
+                        g_usart_rx_sta = 0;     /* 接收数据错误,重新开始接收 */
                     }
                 }
             }
@@ -227,25 +227,25 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 }
 
 /**
- * @brief       1жϷ
- * @param       
- * @retval      
+ * @brief       串口1中断服务函数
+ * @param       无
+ * @retval      无
  */
 void USART_UX_IRQHandler(void)
 { 
     uint32_t timeout = 0;
     uint32_t maxDelay = 0x1FFFF;
     
-#if SYS_SUPPORT_OS                              /* ʹOS */
+#if SYS_SUPPORT_OS                              /* 使用OS */
     OSIntEnter();    
 #endif
 
-    HAL_UART_IRQHandler(&g_uart1_handle);       /* HALжϴú */
+    HAL_UART_IRQHandler(&g_uart1_handle);       /* 调用HAL库中断处理公用函数 */
 
     timeout = 0;
-    while (HAL_UART_GetState(&g_uart1_handle) != HAL_UART_STATE_READY) /* ȴ */
+    while (HAL_UART_GetState(&g_uart1_handle) != HAL_UART_STATE_READY) /* 等待就绪 */
     {
-        timeout++;                              /* ʱ */
+        timeout++;                              /* 超时处理 */
         if(timeout > maxDelay)
         {
             break;
@@ -254,17 +254,17 @@ void USART_UX_IRQHandler(void)
      
     timeout=0;
     
-    /* һδ֮¿жϲRxXferCountΪ1 */
+    /* 一次处理完成之后，重新开启中断并设置RxXferCount为1 */
     while (HAL_UART_Receive_IT(&g_uart1_handle, (uint8_t *)g_rx_buffer, RXBUFFERSIZE) != HAL_OK)
     {
-        timeout++;                              /* ʱ */
+        timeout++;                              /* 超时处理 */
         if (timeout > maxDelay)
         {
             break;
         }
     }
 
-#if SYS_SUPPORT_OS                              /* ʹOS */
+#if SYS_SUPPORT_OS                              /* 使用OS */
     OSIntExit();
 #endif
 
@@ -1,23 +1,23 @@
 /**
  ****************************************************************************************************
  * @file        usart.h
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2021-10-14
- * @brief       ڳʼ(һǴ1)֧printf
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       串口初始化代码(一般是串口1)，支持printf
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨ԭ F407
- * Ƶwww.yuanzige.com
- * ̳http://www.openedv.com/forum.php
- * ˾ַwww.alientek.com
- * ַzhengdianyuanzi.tmall.com
+ * 实验平台：正点原子 F407电机开发板
+ * 在线视频：www.yuanzige.com
+ * 技术论坛：http://www.openedv.com/forum.php
+ * 公司网址：www.alientek.com
+ * 购买地址：zhengdianyuanzi.tmall.com
  *
- * ޸˵
+ * 修改说明
  * V1.0 20211014
- * һη
+ * 第一次发布
  *
  ****************************************************************************************************
  */
@@ -29,40 +29,40 @@
 #include "./SYSTEM/sys/sys.h"
 
 /*******************************************************************************************************/
-/*     
- * ĬUSART1.
- * ע: ͨ޸12궨,֧USART1~UART7һ.
+/* 引脚 和 串口 定义 
+ * 默认是针对USART1的.
+ * 注意: 通过修改这12个宏定义,可以支持USART1~UART7任意一个串口.
  */
 
 #define USART_TX_GPIO_PORT              GPIOB
 #define USART_TX_GPIO_PIN               GPIO_PIN_6
 #define USART_TX_GPIO_AF                GPIO_AF7_USART1
-#define USART_TX_GPIO_CLK_ENABLE()      do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)   /* ʱʹ */
+#define USART_TX_GPIO_CLK_ENABLE()      do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)   /* 发送引脚时钟使能 */
 
 #define USART_RX_GPIO_PORT              GPIOB
 #define USART_RX_GPIO_PIN               GPIO_PIN_7
 #define USART_RX_GPIO_AF                GPIO_AF7_USART1
-#define USART_RX_GPIO_CLK_ENABLE()      do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)   /* ʱʹ */
+#define USART_RX_GPIO_CLK_ENABLE()      do{ __HAL_RCC_GPIOB_CLK_ENABLE(); }while(0)   /* 接收引脚时钟使能 */
 
 #define USART_UX                        USART1
 #define USART_UX_IRQn                   USART1_IRQn
 #define USART_UX_IRQHandler             USART1_IRQHandler
-#define USART_UX_CLK_ENABLE()           do{ __HAL_RCC_USART1_CLK_ENABLE(); }while(0)  /* USART1 ʱʹ */
+#define USART_UX_CLK_ENABLE()           do{ __HAL_RCC_USART1_CLK_ENABLE(); }while(0)  /* USART1 时钟使能 */
 
 /*******************************************************************************************************/
 
-#define USART_REC_LEN   200                     /* ֽ 200 */
-#define USART_EN_RX     1                       /* ʹܣ1/ֹ01 */
-#define RXBUFFERSIZE    1                       /* С */
+#define USART_REC_LEN   200                     /* 定义最大接收字节数 200 */
+#define USART_EN_RX     1                       /* 使能（1）/禁止（0）串口1接收 */
+#define RXBUFFERSIZE    1                       /* 缓存大小 */
 
-extern UART_HandleTypeDef g_uart1_handle;       /* UART */
+extern UART_HandleTypeDef g_uart1_handle;       /* UART句柄 */
 
-extern uint8_t  g_usart_rx_buf[USART_REC_LEN];  /* ջ,USART_REC_LENֽ.ĩֽΪз */
-extern uint16_t g_usart_rx_sta;                 /* ״̬ */
-extern uint8_t g_rx_buffer[RXBUFFERSIZE];       /* HALUSARTBuffer */
+extern uint8_t  g_usart_rx_buf[USART_REC_LEN];  /* 接收缓冲,最大USART_REC_LEN个字节.末字节为换行符 */
+extern uint16_t g_usart_rx_sta;                 /* 接收状态标记 */
+extern uint8_t g_rx_buffer[RXBUFFERSIZE];       /* HAL库USART接收Buffer */
 
 
-void usart_init(uint32_t baudrate);             /* ڳʼ */
+void usart_init(uint32_t baudrate);             /* 串口初始化函数 */
 
 #endif
 
@@ -2,22 +2,23 @@
 #include "./USMART/usmart_str.h"
 
 /******************************************************************************************/
-/* û
- * Ҫõĺͷļ(ûԼ)
+/* 用户配置区
+ * 这下面要包含所用到的函数所申明的头文件(用户自己添加)
  */
 
 #include "./SYSTEM/sys/sys.h"
 #include "./SYSTEM/delay/delay.h"
 #include "./BSP/LCD/lcd.h"
 #include "./BSP/RTC/rtc.h"
+#include "./BSP/LED/led.h"
 
 
-/* бʼ(ûԼ)
- * ûֱҪִеĺҴ
+/* 函数名列表初始化(用户自己添加)
+ * 用户直接在这里输入要执行的函数名及其查找串
  */
 struct _m_usmart_nametab usmart_nametab[] =
 {
-#if USMART_USE_WRFUNS == 1      /* ʹ˶д */
+#if USMART_USE_WRFUNS == 1      /* 如果使能了读写操作 */
     (void *)read_addr, "uint32_t read_addr(uint32_t addr)",
     (void *)write_addr, "void write_addr(uint32_t addr,uint32_t val)",
 #endif
@@ -45,13 +46,15 @@ struct _m_usmart_nametab usmart_nametab[] =
     (void *)rtc_set_wakeup, "void rtc_set_wakeup(uint8_t wksel, uint16_t cnt)",
     (void *)rtc_get_week, "uint8_t rtc_get_week(uint16_t year, uint8_t month, uint8_t day)",
     (void *)rtc_set_alarma, "void rtc_set_alarma(uint8_t week, uint8_t hour, uint8_t min, uint8_t sec)",
+
+    (void *)led_io_bench, "uint32_t led_io_bench(uint8_t mode)",
 };
 
 /******************************************************************************************/
 
-/* ƹʼ
- * õܿغ
- * õ
+/* 函数控制管理器初始化
+ * 得到各个受控函数的名字
+ * 得到函数总数量
  */
 struct _m_usmart_dev usmart_dev =
 {
@@ -60,13 +63,13 @@ struct _m_usmart_dev usmart_dev =
     usmart_cmd_rec,
     usmart_exe,
     usmart_scan,
-    sizeof(usmart_nametab) / sizeof(struct _m_usmart_nametab), /*  */
-    0,      /*  */
-    0,      /* ID */
-    1,      /* ʾ,0,10;1,16 */
-    0,      /* .bitx:,0,;1,ַ */
-    0,      /* ÿĳݴ,ҪMAX_PARM0ʼ */
-    0,      /* Ĳ,ҪPARM_LEN0ʼ */
+    sizeof(usmart_nametab) / sizeof(struct _m_usmart_nametab), /* 函数数量 */
+    0,      /* 参数数量 */
+    0,      /* 函数ID */
+    1,      /* 参数显示类型,0,10进制;1,16进制 */
+    0,      /* 参数类型.bitx:,0,数字;1,字符串 */
+    0,      /* 每个参数的长度暂存表,需要MAX_PARM个0初始化 */
+    0,      /* 函数的参数,需要PARM_LEN个0初始化 */
 };
 
 
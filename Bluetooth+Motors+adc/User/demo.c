@@ -1,19 +1,19 @@
 /**
  ****************************************************************************************************
  * @file        demo.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2022-06-21
- * @brief       ATK-MW579ģ豸͹Ĳʵ
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       ATK-MW579模块从设备低功耗测试实验
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
  ****************************************************************************************************
  */
@@ -25,14 +25,14 @@
 #include "./SYSTEM/usart/usart.h"
 #include "./SYSTEM/delay/delay.h"
 
-#define DEMO_BLE_NAME           "ATK-MW579"                         /*  */
-#define DEMO_BLE_HELLO          "HELLO ATK-MW579"                   /* ӭ */
-#define DEMO_BLE_ADPTIM         5                                   /* 㲥ٶ */
+#define DEMO_BLE_NAME           "ATK-MW579"                         /* 蓝牙名称 */
+#define DEMO_BLE_HELLO          "HELLO ATK-MW579"                   /* 开机欢迎语 */
+#define DEMO_BLE_ADPTIM         5                                   /* 广播速度 */
 
 /**
- * @brief       ʾں
- * @param       
- * @retval      
+ * @brief       例程演示入口函数
+ * @param       无
+ * @retval      无
  */
 void demo_run(void)
 {
@@ -40,7 +40,7 @@ void demo_run(void)
     uint8_t key;
     uint8_t *recv_dat;
     
-    /* ATK-MW579ʼ */
+    /* ATK-MW579初始化 */
     ret = atk_mw579_init(ATK_MW579_UART_BAUDRATE_115200);
     if (ret != 0)
     {
@@ -52,7 +52,7 @@ void demo_run(void)
         }
     }
     
-    /* ATK-MW579 */
+    /* 配置ATK-MW579 */
     atk_mw579_enter_config_mode();
     ret  = atk_mw579_set_name(DEMO_BLE_NAME);
     ret += atk_mw579_set_hello(DEMO_BLE_HELLO);
@@ -74,7 +74,7 @@ void demo_run(void)
         }
     }
     
-    /* ¿ʼ */
+    /* 重新开始接收数据 */
     atk_mw579_uart_rx_restart();
     
     while (1)
@@ -85,13 +85,13 @@ void demo_run(void)
         {
             case KEY0_PRES:
             {
-                /* ͸豸 */
+                /* 透传发送数据至主设备 */
                 atk_mw579_uart_printf("From ATK-MW579\r\n");
                 break;
             }
             case KEY1_PRES:
             {
-                /* ͨڻATK-MW579 */
+                /* 通过串口唤醒ATK-MW579 */
                 atk_mw579_wakeup_by_uart();
                 break;
             }
@@ -101,7 +101,7 @@ void demo_run(void)
             }
         }
         
-        /* ͸豸 */
+        /* 透传接收来自主设备的数据 */
         recv_dat = atk_mw579_uart_rx_get_frame();
         if (recv_dat != NULL)
         {
@@ -1,19 +1,19 @@
 /**
  ****************************************************************************************************
  * @file        main.c
- * @author      ԭŶ(ALIENTEK)
+ * @author      正点原子团队(ALIENTEK)
  * @version     V1.0
  * @date        2022-06-21
- * @brief       ATK-MW579ģ豸͹Ĳʵ
- * @license     Copyright (c) 2020-2032, ӿƼ޹˾
+ * @brief       ATK-MW579模块从设备低功耗测试实验
+ * @license     Copyright (c) 2020-2032, 广州市星翼电子科技有限公司
  ****************************************************************************************************
  * @attention
  *
- * ʵƽ̨:ԭ F407
- * Ƶ:www.yuanzige.com
- * ̳:www.openedv.com
- * ˾ַ:www.alientek.com
- * ַ:openedv.taobao.com
+ * 实验平台:正点原子 F407电机开发板
+ * 在线视频:www.yuanzige.com
+ * 技术论坛:www.openedv.com
+ * 公司网址:www.alientek.com
+ * 购买地址:openedv.taobao.com
  *
  ****************************************************************************************************
  */
@@ -26,31 +26,63 @@
 #include "./BSP/LCD/lcd.h"
 //#include "demo.h"
 #include "./BSP/ATK_MW579/atk_mw579.h"
+#include "./BSP/ATK_MW579/atk_mw579_at.h"
 #include "./BSP/ADC/adc.h"
 #include "./BSP/TIMER/stepper_tim.h"
 #include "./BSP/STEPPER_MOTOR/stepper_motor.h"
+#include "./BSP/STEPPER_MOTOR/stepper_home.h"
+#include "./BSP/STEPPER_MOTOR/stepper_power.h"
+#include "./BSP/STEPPER_MOTOR/stepper_unit.h"
+#include "./BSP/STEPPER_MOTOR/stepper_verify.h"
+#include "./BSP/STEPPER_MOTOR/stepper_ramp.h"
+#include "./BSP/STEPPER_MOTOR/stepper_comp.h"
+#include "./BSP/STEPPER_MOTOR/stepper_scope.h"
+#include "./BSP/ESTOP/estop.h"
+#include "./BSP/STEERING_ENGINE/steering_engine.h"
+#include "./BSP/CHECKPOINT/checkpoint.h"
+#include "./BSP/TELEMETRY/telemetry.h"
+#include "./BSP/TIMESYNC/timesync.h"
+#include "./BSP/CMD/cmd.h"
+#include "./BSP/BENCH/bench.h"
+#include "./BSP/MACRO/macro.h"
 #include <string.h>
 
 #include "./BSP/RTC/rtc.h"
 #include "./USMART/usmart.h"
 
-#define DEMO_BLE_NAME           "ATK-MW579"                         /*  */
-#define DEMO_BLE_HELLO          "HELLO ATK-MW579"                   /* ӭ */
-#define DEMO_BLE_ADPTIM         5                                   /* 㲥ٶ */
+#define DEMO_BLE_NAME           "ATK-MW579"                         /* 蓝牙名称 */
+#define DEMO_BLE_HELLO          "HELLO ATK-MW579"                   /* 开机欢迎语 */
+#define DEMO_BLE_ADPTIM         5                                   /* 广播速度 */
+#define DEMO_BLE_MAXPUT         ATK_MW579_MAXPUT_OFF                /* 上电时的通信最大输出, 可用maxput命令修改 */
+
+/* 蓝牙模块UART波特率协商: 第一次上电(或后备寄存器无效)时从BLE_BAUD_MAX向下协商,
+ * 结果保存在RTC后备寄存器中, 之后上电直接用该波特率; 上位机可以用baud命令重新协商 */
+#define BLE_BAUD_DEFAULT        ATK_MW579_UART_BAUDRATE_115200      /* 模块出厂波特率 */
+#define BLE_BAUD_MAX            ATK_MW579_UART_BAUDRATE_230400      /* 协商的最高波特率 */
+#define BLE_BAUD_BKP            RTC_BKP_DR2                         /* [31:16]标志, [7:0]波特率枚举 */
+#define BLE_BAUD_BKP_MAGIC      0xBA5E0000
+#define BLE_BAUD_PATTERN        "UUUU****~~~~0123456789ABCDEFabcdef" /* 测试序列: 0x55/0x2A位交替, 0x7E长串1 */
+
+/* 蓝牙模块配置缓存: 上次成功应用的配置脚本指纹, 与本次相同时跳过配置;
+ * 模块波特率需要扫描(模块被更换或恢复出厂)时作废 */
+#define BLE_CFG_BKP             RTC_BKP_DR3                         /* 配置指纹, 0为无效 */
+
+#define PROBE_CELL_PITCH_UM     10000                               /* 测量网格间距, 单位: um */
+#define PROBE_XY_SPEED_UM_S     5000                                /* X/Y轴移动速度, 单位: um/s */
 
 /**
- * @brief       ʾʵϢ
- * @param       
- * @retval      
+ * @brief       显示实验信息
+ * @param       无
+ * @retval      无
  */
 void show_mesg(void)
 {
-    /* LCDʾʵϢ */
+    /* LCD显示实验信息 */
     lcd_show_string(10, 10, 220, 32, 32, "STM32", RED);
     lcd_show_string(10, 47, 220, 24, 24, "ATK-MW579", RED);
     //lcd_show_string(10, 76, 220, 16, 16, "ATOM@ALIENTEK", RED);
     
-    /* ʵϢ */
+    /* 串口输出实验信息 */
     printf("\n");
     printf("********************************\r\n");
     printf("STM32\r\n");
@@ -60,36 +92,311 @@ void show_mesg(void)
     printf("\r\n");
 }
 
+/* 探测流程状态, 由命令处理函数和主循环共用 */
+static struct
+{
+    uint8_t id;                                 /* 贯入轴电机序号 */
+    uint8_t dir;                                /* 下探方向 */
+    uint16_t set_speed;                         /* 速度设定 */
+    uint8_t send_flag;                          /* 下探中, 上报力-深度数据 */
+    uint8_t retracting;                         /* 回撤进行中 */
+    int32_t descent_start;                      /* 本次下探起点, 单位: 步 */
+} g_probe = {STEPPER_MOTOR_1, 1, 100, 0, 0, 0};
+
+/**
+ * @brief       读取上次协商好的蓝牙模块波特率
+ * @param       无
+ * @retval      波特率枚举, 后备寄存器无效时为出厂波特率
+ */
+static atk_mw579_uart_baudrate_t ble_baud_load(void)
+{
+    uint32_t bkp = rtc_read_bkr(BLE_BAUD_BKP);
+
+    if (((bkp & 0xFFFF0000) != BLE_BAUD_BKP_MAGIC) || (atk_mw579_baudrate_value((atk_mw579_uart_baudrate_t)(bkp & 0xFF)) == 0))
+    {
+        return BLE_BAUD_DEFAULT;
+    }
+
+    return (atk_mw579_uart_baudrate_t)(bkp & 0xFF);
+}
+
+/**
+ * @brief       保存当前的蓝牙模块波特率, 下次上电直接使用
+ * @param       无
+ * @retval      无
+ */
+static void ble_baud_save(void)
+{
+    rtc_write_bkr(BLE_BAUD_BKP, BLE_BAUD_BKP_MAGIC | atk_mw579_get_baudrate());
+}
+
+/**
+ * @brief       power/start: 开始下探并上报数据
+ */
+static uint8_t probe_cmd_power(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint8_t hour, min, sec, ampm;
+    int32_t pos;
+    uint8_t ret;
+
+    stepper_pwmt_speed(g_probe.set_speed + 900, ATIM_TIMX_PWM_CH1);
+    pos = stepper_get_pos(g_probe.id);
+    ret = stepper_star(g_probe.id, g_probe.dir);
+
+    if (ret != STEPPER_EOK)                                 /* 急停或被stop打断, 不开始上报, 也不改回撤起点 */
+    {
+        return ret;
+    }
+
+    g_probe.send_flag = 1;
+    g_probe.descent_start = pos;                            /* 记录起点, 回撤时按步数精确返回 */
+
+    rtc_get_time(&hour, &min, &sec, &ampm);
+    printf("start_hour:%d; start_min: %d; start_sec: %d\r\n", hour, min, sec);
+    return STEPPER_EOK;
+}
+
+/**
+ * @brief       change/return: 按下探的步数以最高安全速度回撤, 带加减速, 不阻塞主循环
+ */
+static uint8_t probe_cmd_change(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint8_t ret;
+
+    ret = stepper_retract(g_probe.id, g_probe.descent_start);
+    g_probe.retracting = (ret == STEPPER_EOK);
+    printf("retract:%d,%d\r\n", ret, stepper_get_pos(g_probe.id) - g_probe.descent_start);
+    atk_mw579_uart_printf("change:%d,%d\r\n", ret, stepper_get_pos(g_probe.id) - g_probe.descent_start);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       up: 贯入轴向上连续运动
+ */
+static uint8_t probe_cmd_up(const cmd_arg_t *arg, uint8_t argc)
+{
+    stepper_pwmt_speed(g_probe.set_speed + 900, ATIM_TIMX_PWM_CH1);
+    return stepper_star(g_probe.id, 0);
+}
+
+/**
+ * @brief       down: 贯入轴向下连续运动
+ */
+static uint8_t probe_cmd_down(const cmd_arg_t *arg, uint8_t argc)
+{
+    stepper_pwmt_speed(g_probe.set_speed + 900, ATIM_TIMX_PWM_CH1);
+    return stepper_star(g_probe.id, 1);
+}
+
+/**
+ * @brief       stop: 停止贯入轴和数据上报, 上位机发送时同时中止正在执行的宏
+ * @note        紧急命令, 在接收中断中执行
+ */
+static uint8_t probe_cmd_stop(const cmd_arg_t *arg, uint8_t argc)
+{
+    g_probe.send_flag = 0;
+    stepper_stop(g_probe.id);
+    macro_abort();
+    return STEPPER_EOK;
+}
+
+/**
+ * @brief       home [电机序号]: 回零, 默认贯入轴; 不阻塞, 结束时上报"home:<结果>,<位置>"
+ */
+static uint8_t probe_cmd_home(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint8_t motor = (argc > 0) ? arg[0].i : g_probe.id;
+    uint8_t ret;
+
+    if ((argc > 0) && ((arg[0].i < STEPPER_MOTOR_1) || (arg[0].i > STEPPER_MOTOR_4)))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    g_probe.send_flag = 0;
+    ret = stepper_home(motor);
+    if (ret != STEPPER_EOK)                                 /* 开始成功时, 回零结束后由主循环应答 */
+    {
+        atk_mw579_uart_printf("home:%d,%d\r\n", ret, stepper_get_pos(motor));
+    }
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       goto <目标位置um> <速度um/s>: 贯入轴绝对运动
+ */
+static uint8_t probe_cmd_goto(const cmd_arg_t *arg, uint8_t argc)
+{
+    if (arg[1].i <= 0)
+    {
+        return STEPPER_EINVAL;
+    }
+
+    return stepper_move_to_um(g_probe.id, arg[0].i, arg[1].i);
+}
+
+/**
+ * @brief       move <dx> <dy>: X/Y轴移动若干个网格, 贯入轴运动时拒绝
+ */
+static uint8_t probe_cmd_move(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint8_t ret = STEPPER_EOK;
+
+    if ((arg[0].i < -CHECKPOINT_GRID_N) || (arg[0].i > CHECKPOINT_GRID_N) ||
+        (arg[1].i < -CHECKPOINT_GRID_N) || (arg[1].i > CHECKPOINT_GRID_N))
+    {
+        return STEPPER_EINVAL;
+    }
+
+    if (stepper_is_running(g_probe.id))
+    {
+        return STEPPER_ERROR;                   /* 探头可能还在土里 */
+    }
+
+    if (arg[0].i != 0)
+    {
+        ret = stepper_move_um(STEPPER_MOTOR_2, arg[0].i * PROBE_CELL_PITCH_UM, PROBE_XY_SPEED_UM_S);
+    }
+
+    if ((ret == STEPPER_EOK) && (arg[1].i != 0))
+    {
+        ret = stepper_move_um(STEPPER_MOTOR_3, arg[1].i * PROBE_CELL_PITCH_UM, PROBE_XY_SPEED_UM_S);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief       estop: 软件急停, 由"estop:"事件应答
+ * @note        紧急命令, 在接收中断中执行
+ */
+static uint8_t probe_cmd_estop(const cmd_arg_t *arg, uint8_t argc)
+{
+    g_probe.send_flag = 0;
+    estop_trigger();
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       运行中进入蓝牙模块配置模式
+ * @note        先停止数据上报并等待发送队列清空, 否则没发完的数据会被模块当成AT指令
+ * @param       无
+ * @retval      无
+ */
+static void ble_config_enter(void)
+{
+    g_probe.send_flag = 0;
+    atk_mw579_uart_tx_wait(100);
+    atk_mw579_enter_config_mode();
+}
+
+/**
+ * @brief       退出配置模式, 连接中时回到透传
+ * @param       无
+ * @retval      无
+ */
+static void ble_config_exit(void)
+{
+    if (atk_mw579_get_conn_sta() == ATK_MW579_CONNECTED)
+    {
+        atk_mw579_enter_unvarnished();
+    }
+}
+
+/**
+ * @brief       baud [波特率]: 切换蓝牙模块UART波特率, 失败时自动退回; 省略时只查询
+ *              应答: 结果, 当前波特率, UART接收错误次数, 测试序列
+ * @note        应答在新波特率下发出, 上位机核对测试序列, 不一致时发送"baud 115200"退回
+ */
+static uint8_t probe_cmd_baud(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint8_t ret = ATK_MW579_EOK;
+
+    if (argc > 0)
+    {
+        ble_config_enter();
+        ret = atk_mw579_switch_baudrate(arg[0].i);
+        ble_config_exit();
+        ble_baud_save();
+    }
+
+    atk_mw579_uart_printf("baud:%d,%lu,%lu,%s\r\n", ret, atk_mw579_baudrate_value(atk_mw579_get_baudrate()),
+                          g_atk_mw579_uart_rx_sta.errors, BLE_BAUD_PATTERN);
+    return CMD_NOREPLY;
+}
+
+/**
+ * @brief       maxput on|off: 设置蓝牙模块通信最大输出, 用于比较两种设置下的链路能力
+ */
+static uint8_t probe_cmd_maxput(const cmd_arg_t *arg, uint8_t argc)
+{
+    uint8_t ret;
+
+    ble_config_enter();
+    ret = atk_mw579_set_maxput(arg[0].i);
+    ble_config_exit();
+    return ret;
+}
+
+/* 通信最大输出枚举名, 顺序与atk_mw579_maxput_t一致 */
+static const char *const g_probe_maxput_names[] = {"on", "off", NULL};
+
+/* 波特率枚举名, 顺序与atk_mw579_uart_baudrate_t一致 */
+static const char *const g_probe_baud_names[] =
+{
+    "1200", "2400", "4800", "9600", "14400", "19200", "38400", "43000", "57600", "76800", "115200", "128000", "230400", NULL
+};
+
+/* 探测流程命令, 上位机按钮发送start/return, 调试时也可用power/change; stop和estop为紧急命令 */
+static const cmd_t g_probe_cmds[] =
+{
+    {"power",  "",   NULL,                 probe_cmd_power},
+    {"start",  "",   NULL,                 probe_cmd_power},
+    {"change", "",   NULL,                 probe_cmd_change},
+    {"return", "",   NULL,                 probe_cmd_change},
+    {"up",     "",   NULL,                 probe_cmd_up},
+    {"down",   "",   NULL,                 probe_cmd_down},
+    {"stop",   "!",  NULL,                 probe_cmd_stop},
+    {"home",   "?i", NULL,                 probe_cmd_home},
+    {"goto",   "ii", NULL,                 probe_cmd_goto},
+    {"move",   "ii", NULL,                 probe_cmd_move},
+    {"estop",  "!",  NULL,                 probe_cmd_estop},
+    {"baud",   "?e", g_probe_baud_names,   probe_cmd_baud},
+    {"maxput", "e",  g_probe_maxput_names, probe_cmd_maxput},
+};
+
 void bluetooth(void)
 {
     uint8_t ret;
     uint8_t key;
-    uint8_t *recv_dat;
+    uint8_t ble_cfg_busy;
+    uint16_t replay_left = 0;
+    uint8_t macro_busy = 0;
+    uint8_t benching;
     
     uint16_t adcx;
     
-    uint8_t start_hour, start_min, start_sec, start_ampm;
     uint8_t hour, min, sec, ampm;
     uint8_t year, month, date, week;
     uint8_t tbuf[40];
     
-    uint8_t send_flag=0;
-    
     float temp;
-    float voltage;
+    float voltage = 0;
     
-    uint8_t id = 1;
-    uint8_t flag = 0, t = 0;
-    uint8_t dir = 1;
-    uint16_t set_speed = 100;
+    uint8_t t = 0;
     
     uint8_t start_t;
     
     char buf[32];
     
 
-    /* ATK-MW579ʼ */
-    ret = atk_mw579_init(ATK_MW579_UART_BAUDRATE_115200);
+    /* ATK-MW579初始化, 先用上次协商好的波特率, 模块不应答时扫描它实际的波特率 */
+    ret = atk_mw579_init(ble_baud_load());
+    if (ret != 0)
+    {
+        rtc_write_bkr(BLE_CFG_BKP, 0);          /* 模块的状态未知, 配置缓存作废 */
+        ret = atk_mw579_find_baudrate();
+    }
     if (ret != 0)
     {
         printf("ATK-MW579 init failed!\r\n");
@@ -100,18 +407,28 @@ void bluetooth(void)
         }
     }
     
-    /* ATK-MW579 */
-    atk_mw579_enter_config_mode();
+    /* 没有保存过协商结果时协商最高稳定波特率, 失败时保持当前波特率 */
+    if ((rtc_read_bkr(BLE_BAUD_BKP) & 0xFFFF0000) != BLE_BAUD_BKP_MAGIC)
+    {
+        atk_mw579_tune_baudrate(BLE_BAUD_MAX);
+    }
+    ble_baud_save();
+    printf("ATK-MW579 baudrate: %lu\r\n", atk_mw579_baudrate_value(atk_mw579_get_baudrate()));
+    
+    /* 配置ATK-MW579: 初始化后模块已处于配置模式. 设置函数只录制成脚本, 指纹与上次成功应用的相同时
+     * 跳过, 否则由主循环中的AT状态机发送, 不阻塞LCD、ADC和电机的处理 */
+    atk_mw579_at_record(1);
     ret  = atk_mw579_set_name(DEMO_BLE_NAME);
     ret += atk_mw579_set_hello(DEMO_BLE_HELLO);
     ret += atk_mw579_set_tpl(ATK_MW579_TPL_P0DBM);
-    ret += atk_mw579_set_uart(ATK_MW579_UART_BAUDRATE_115200, ATK_MW579_UART_DATA_8, ATK_MW579_UART_PARI_NONE, ATK_MW579_UART_STOP_1);
+    ret += atk_mw579_set_uart(atk_mw579_get_baudrate(), ATK_MW579_UART_DATA_8, ATK_MW579_UART_PARI_NONE, ATK_MW579_UART_STOP_1);
     ret += atk_mw579_set_adptim(DEMO_BLE_ADPTIM);
     ret += atk_mw579_set_linkpassen(ATK_MW579_LINKPASSEN_OFF);
     ret += atk_mw579_set_leden(ATK_MW579_LEDEN_ON);
     ret += atk_mw579_set_slavesleepen(ATK_MW579_SLAVESLEEPEN_ON);
-    ret += atk_mw579_set_maxput(ATK_MW579_MAXPUT_OFF);
+    ret += atk_mw579_set_maxput(DEMO_BLE_MAXPUT);
     ret += atk_mw579_set_mode(ATK_MW579_MODE_S);
+    atk_mw579_at_record(0);
     if (ret != 0)
     {
         printf("ATK-MW579 config failed!\r\n");
@@ -122,33 +439,99 @@ void bluetooth(void)
         }
     }
     
-    /* ¿ʼ */
+    if (atk_mw579_at_hash() == rtc_read_bkr(BLE_CFG_BKP))
+    {
+        /* 配置不用重写, 但模块仍处于atk_mw579_init()进入的配置模式, 和脚本最后一步一样用AT+MODE=S退出 */
+        if (atk_mw579_set_mode(ATK_MW579_MODE_S) == ATK_MW579_EOK)
+        {
+            printf("ATK-MW579 config unchanged, skipped\r\n");
+        }
+        else
+        {
+            printf("ATK-MW579 config unchanged, exit config mode failed\r\n");
+        }
+        ble_cfg_busy = 0;
+    }
+    else
+    {
+        rtc_write_bkr(BLE_CFG_BKP, 0);          /* 应用成功前作废, 中途掉电下次重新配置 */
+        atk_mw579_at_start();
+        ble_cfg_busy = 1;
+    }
+    
+    /* 重新开始接收数据 */
     printf("Connection Success\r\n");
-    atk_mw579_uart_rx_restart();
+    atk_mw579_uart_rx_flush();
+    telemetry_link(g_atk_mw579_conn.sta == ATK_MW579_CONNECTED);       /* 还没有连接时遥测先存入缓存 */
     
     while (1)
     {
-
-        rtc_get_time(&hour, &min, &sec, &ampm);
-        rtc_get_date(&year, &month, &date, &week);
-        sprintf((char *)tbuf, "Time:%02d:%02d:%02d", hour, min, sec);
-        lcd_show_string(30, 150, 210, 16, 16, (char*)tbuf, RED);
-        
-        adcx = adc_get_result_average(ADC_ADCX_CHY, 10);                /* ȡADCͨתֵ10ȡƽ */
-        lcd_show_xnum(134, 110, adcx, 5, 16, 0, BLUE);                  /* ʾADCƽֵ */
- 
-        temp = (float)adcx * (3.3 / 4096);                              /* ȡĴСʵʵѹֵ3.1111 */
-        voltage = (float)adcx * (3.3 / 4096);
-        adcx = temp;                                                    /* ֵָadcxΪadcxΪu16 */
-        lcd_show_xnum(134, 130, adcx, 1, 16, 0, BLUE);                  /* ʾѹֵ֣3.1111Ļʾ3 */
+        benching = bench_poll();                                        /* 基准测试中: 不采样、不刷新LCD、不发遥测, 安全和状态检查照常 */
         
-        temp -= adcx;                                                   /* ѾʾȥС֣3.1111 - 3 = 0.1111 */
-        temp *= 1000;                                                   /* Сֳ1000磺0.1111תΪ111.1൱ڱλС */
-        lcd_show_xnum(150, 130, temp, 3, 16, 0X80, BLUE);               /* ʾС֣ǰתΪʾʾľ111 */
+        if (ble_cfg_busy)
+        {
+            ble_cfg_busy = atk_mw579_at_poll();
+            if (ble_cfg_busy == 0)
+            {
+                if (g_atk_mw579_at.state == ATK_MW579_AT_DONE)
+                {
+                    rtc_write_bkr(BLE_CFG_BKP, atk_mw579_at_hash());
+                    printf("ATK-MW579 config applied: %lu ms, %lu retries\r\n", g_atk_mw579_at.elapsed, g_atk_mw579_at.retries);
+                }
+                else
+                {
+                    printf("ATK-MW579 config failed at %s\r\n", atk_mw579_at_current());
+                }
+                atk_mw579_uart_rx_flush();
+            }
+        }
         
-        if (send_flag)
+        switch (atk_mw579_conn_poll())
         {
-            atk_mw579_uart_printf("adc:%f\r\n",voltage);
+            case ATK_MW579_CONN_EVT_UP:
+            {
+                /* 缓存的帧等上位机重新订阅后用replay命令取回 */
+                telemetry_link(1);
+                printf("ble:up,%lu,%lu\r\n", g_atk_mw579_conn.up_tick - g_atk_mw579_conn.down_tick,
+                       (uint32_t)(uint16_t)(g_telemetry.spool_end - g_telemetry.spool_seq));
+                break;
+            }
+            case ATK_MW579_CONN_EVT_DOWN:
+            {
+                telemetry_link(0);
+                printf("ble:down,%lu\r\n", g_atk_mw579_conn.disconnects);
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        if (benching == 0)
+        {
+            rtc_get_time(&hour, &min, &sec, &ampm);
+            rtc_get_date(&year, &month, &date, &week);
+            sprintf((char *)tbuf, "Time:%02d:%02d:%02d", hour, min, sec);
+            lcd_show_string(30, 150, 210, 16, 16, (char*)tbuf, RED);
+            
+            adcx = adc_get_result_average(ADC_ADCX_CHY, 10);                /* 获取ADC通道的转换值，10次取平均 */
+            stepper_verify_force(adcx);                                     /* 力信号饱和用于估计堵转 */
+            lcd_show_xnum(134, 110, adcx, 5, 16, 0, BLUE);                  /* 显示ADC采样后的平均值 */
+            
+            temp = (float)adcx * (3.3 / 4096);                              /* 获取计算后的带小数的实际电压值，比如3.1111 */
+            voltage = (float)adcx * (3.3 / 4096);
+            adcx = temp;                                                    /* 赋值整数部分给adcx变量，因为adcx为u16整形 */
+            lcd_show_xnum(134, 130, adcx, 1, 16, 0, BLUE);                  /* 显示电压值的整数部分，3.1111的话，这里就是显示3 */
+            
+            temp -= adcx;                                                   /* 把已经显示的整数部分去掉，留下小数部分，比如3.1111 - 3 = 0.1111 */
+            temp *= 1000;                                                   /* 小数部分乘以1000，例如：0.1111就转换为111.1，相当于保留三位小数 */
+            lcd_show_xnum(150, 130, temp, 3, 16, 0X80, BLUE);               /* 显示小数部分（前面转换为了整形显示），这里显示的就是111 */
+            
+            if (g_probe.send_flag && (g_telemetry.mode == TELEMETRY_MODE_ASCII) && g_telemetry.link)
+            {
+                atk_mw579_uart_printf("%f,%d\r\n", voltage, stepper_get_pos_um(g_probe.id));  /* 电压, 深度(um) */
+            }
         }
 
         key = key_scan(0);
@@ -157,13 +540,16 @@ void bluetooth(void)
         {
             case KEY0_PRES:
             {
-                /* ͸豸 */
-                atk_mw579_uart_printf("adc:%f\r\n",voltage);
+                /* 透传发送数据至主设备; 基准测试中不采样, 也不在测试帧中插入文本 */
+                if (benching == 0)
+                {
+                    atk_mw579_uart_printf("%f,%d\r\n", voltage, stepper_get_pos_um(g_probe.id));
+                }
                 break;
             }
             case KEY1_PRES:
             {
-                /* ͨڻATK-MW579 */
+                /* 通过串口唤醒ATK-MW579 */
                 atk_mw579_wakeup_by_uart();
                 break;
             }
@@ -173,115 +559,156 @@ void bluetooth(void)
             }
         }
         
-        /* ͸豸 */
-//        stepper_pwmt_speed(set_speed,ATIM_TIMX_PWM_CH1);
-        recv_dat = atk_mw579_uart_rx_get_frame();
-        if (recv_dat != NULL)
+        /* 透传接收来自主设备的数据 */
+//        stepper_pwmt_speed(g_probe.set_speed,ATIM_TIMX_PWM_CH1);
+        if (ble_cfg_busy == 0)
         {
-            printf("%s\r\n", recv_dat);
-            
-            const char *start = "power";
-            if (strncmp((const char*)recv_dat, start, strlen(start)) == 0) {
-                flag = !flag;
-                if(flag)
-                {
-//                    stepper_stop(id);
-                    send_flag = !send_flag;
-                    stepper_pwmt_speed(set_speed+900,ATIM_TIMX_PWM_CH1);
-                    stepper_star(id, dir);
-                    
-                    start_hour = hour;
-                    start_min = min;
-                    start_sec = sec;
-                    printf("start_hour:%d; start_min: %d; start_sec: %d\r\n", start_hour, start_min, start_sec);
-                    flag = !flag;
-                }
-                else
-                {
-                    printf("sdhfksdjfksjd\r\n");
-                    stepper_stop(id);
-                }
-            }
-            
-            
-            const char *change = "change";
-            if(strncmp((const char*)recv_dat, change, strlen(change)) == 0)
-            {
-                dir = !dir;
-                send_flag = !send_flag;
-                stepper_star(id, dir);
-                stepper_pwmt_speed(set_speed+900,ATIM_TIMX_PWM_CH1);
-                printf("hour:%d; min: %d; sec: %d\r\n",hour, min, sec);
-                delay_ms(1000*((hour-start_hour)*60*60 + (min-start_min)*60 + (sec - start_sec)));
-                stepper_stop(id);
-                dir = !dir;
-            }
+            cmd_poll();                                                 /* 按到达顺序执行排队的命令; 配置中接收队列是模块的应答 */
+            timesync_poll();
+            replay_left = benching ? 0 : telemetry_replay();            /* 回放断连期间缓存的帧, 与实时帧交替 */
+            macro_busy = macro_poll();                                  /* 执行上位机存下的命令宏 */
+        }
+        
+        if (estop_is_latched() && (g_estop_sta.reported == 0) && (ble_cfg_busy == 0))
+        {
+            /* 上报急停时刻(ms)和引脚到驱动器失能的延时(ns) */
+            g_estop_sta.reported = 1;
+            g_probe.send_flag = 0;
+            printf("estop:%lu,%lu\r\n", g_estop_sta.tick, estop_latency_ns());
+            atk_mw579_uart_printf("estop:%lu,%lu\r\n", g_estop_sta.tick, estop_latency_ns());
+        }
+        
+        if (g_probe.retracting && (stepper_is_running(g_probe.id) == 0))
+        {
+            /* 回撤结束(或被stop/急停中止), 上报与起点的剩余距离 */
+            g_probe.retracting = 0;
+            g_probe.send_flag = 0;
+            atk_mw579_uart_printf("retract:%d\r\n", stepper_get_pos(g_probe.id) - g_probe.descent_start);
             
-            const char *up = "up";
-            if(strncmp((const char*)recv_dat, up, strlen(change)) == 0)
+            if ((stepper_get_pos(g_probe.id) == g_probe.descent_start) && (g_checkpoint.run_id != 0) &&
+                (checkpoint_cell_done() == CHECKPOINT_EOK))
             {
-                stepper_star(id, 0);
-                stepper_pwmt_speed(set_speed+900,ATIM_TIMX_PWM_CH1);
+                /* 完整回到起点, 当前网格记为完成 */
+                atk_mw579_uart_printf("done:%d,%d\r\n", g_checkpoint.cell_x, g_checkpoint.cell_y);
             }
+        }
+        
+        if (g_stepper_verify.fault && (g_stepper_verify.reported == 0))
+        {
+            /* 上报丢步: 指令步数, 反馈步数(均相对同步点), 堵转可能性(%) */
+            g_stepper_verify.reported = 1;
+            g_probe.send_flag = 0;
+            atk_mw579_uart_printf("slip:%d,%d,%d\r\n", g_stepper_verify.fault_cmd, g_stepper_verify.fault_fb,
+                                  g_stepper_verify.stall);
+        }
+        
+        if (stepper_scope_poll())
+        {
+            /* 边沿数, 统计的间隔数, 最高步频(Hz), 误差均值/标准差/最大值(ns), 误差直方图 */
+            atk_mw579_uart_printf("pulse:%d,%d,%d,%d,%d,%d\r\n", g_stepper_scope.edges, g_stepper_scope.intervals,
+                                  g_stepper_scope.max_rate, g_stepper_scope.mean_ns, g_stepper_scope.jitter_ns,
+                                  g_stepper_scope.max_err_ns);
+            atk_mw579_uart_printf("hist:%d,%d,%d,%d,%d,%d,%d,%d\r\n", g_stepper_scope.hist[0], g_stepper_scope.hist[1],
+                                  g_stepper_scope.hist[2], g_stepper_scope.hist[3], g_stepper_scope.hist[4],
+                                  g_stepper_scope.hist[5], g_stepper_scope.hist[6], g_stepper_scope.hist[7]);
+        }
+        
+        if (stepper_home_poll())
+        {
+            /* 回零结束: 结果, 当前位置(步) */
+            atk_mw579_uart_printf("home:%d,%d\r\n", g_stepper_home.result, stepper_get_pos(g_stepper_home.motor));
+        }
+        stepper_power_poll();
+        
+        if ((t % 20) == 0)
+        {
+            LED0_TOGGLE();  /* 每200ms,翻转一次LED0 */
+        }
+        if (benching)
+        {
+            /* 基准测试中不等待, 尽快回到bench_poll()发送测试帧 */
+        }
+        else if (g_probe.send_flag && (g_telemetry.mode != TELEMETRY_MODE_ASCII))
+        {
+            /* 二进制模式: 主循环的等待时间用来按固定周期采样, 每帧打包多条样本 */
+            uint32_t tick = HAL_GetTick();
             
-            const char *down = "down";
-            if(strncmp((const char*)recv_dat, down, strlen(change)) == 0)
+            while ((HAL_GetTick() - tick) < 100)
             {
-                stepper_star(id, 1);
-                stepper_pwmt_speed(set_speed+900,ATIM_TIMX_PWM_CH1);
+                uint32_t time_us = timesync_us();                       /* 采样时刻, 紧挨着采样 */
+                
+                telemetry_sample(time_us, stepper_get_pos_um(g_probe.id), adc_get_result(ADC_ADCX_CHY));
+                telemetry_replay();
+                timesync_poll();                                        /* 同步应答不等这100ms的采样窗口 */
+                macro_busy = macro_poll();                              /* 宏的延时和等待条件按采样周期检查 */
+                delay_ms(TELEMETRY_SAMPLE_MS);
             }
+            telemetry_flush();
+        }
+        else if (ble_cfg_busy || replay_left)
+        {
+            delay_ms(1);                                                /* 配置中尽快推进AT脚本, 回放中尽快发送 */
+        }
+        else if (macro_busy)
+        {
+            /* 宏执行中: 主循环周期不变, 等待的100ms里每MACRO_POLL_MS推进一次宏; 宏开始二进制下探时立即转去采样 */
+            uint32_t tick = HAL_GetTick();
             
-            const char *stop = "stop";
-            if(strncmp((const char*)recv_dat, stop, strlen(change)) == 0)
+            while (((HAL_GetTick() - tick) < 100) && macro_busy &&
+                   ((g_probe.send_flag == 0) || (g_telemetry.mode == TELEMETRY_MODE_ASCII)))
             {
-                send_flag = 0;
-                stepper_stop(id);
+                delay_ms(MACRO_POLL_MS);
+                macro_busy = macro_poll();
             }
-            
-            atk_mw579_uart_rx_restart();
         }
-        
-        
-        if ((t % 20) == 0)
+        else
         {
-            LED0_TOGGLE();  /* ÿ200ms,תһLED0 */
+            delay_ms(100);
         }
-        delay_ms(100);
     }
 }
 
 int main(void)
 {
 
-    HAL_Init();                         /* ʼHAL */
-    sys_stm32_clock_init(336, 8, 2, 7); /* ʱ,168Mhz */
-    delay_init(168);                    /* ʱʼ */
-    usart_init(115200);                 /* ڳʼΪ115200 */
-    usmart_dev.init(84);                    /* ʼUSMART */
-    led_init();                         /* ʼLED */
-    key_init();                         /* ʼ */
-    lcd_init();                         /* ʼLCD */
-    show_mesg();                        /* ʾʵϢ */
+    HAL_Init();                         /* 初始化HAL库 */
+    sys_stm32_clock_init(336, 8, 2, 7); /* 设置时钟,168Mhz */
+    delay_init(168);                    /* 延时初始化 */
+    usart_init(115200);                 /* 串口初始化为115200 */
+    usmart_dev.init(84);                    /* 初始化USMART */
+    led_init();                         /* 初始化LED */
+    key_init();                         /* 初始化按键 */
+    lcd_init();                         /* 初始化LCD */
+    show_mesg();                        /* 显示实验信息 */
 
     
     stepper_init(0xFFFF, 168 - 1);
+    estop_init();                       /* 初始化急停输入 */
+    stepper_verify_init();              /* 初始化丢步检测 */
+    stepper_scope_init();               /* 初始化步进脉冲回环测试(TIM2捕获) */
+    servo_init();                       /* 初始化舵机PWM(TIM3) */
     
 
 
 
     
 
-    rtc_init();                             /* ʼRTC */
-    rtc_set_wakeup(RTC_WAKEUPCLOCK_CK_SPRE_16BITS, 0);  /* WAKE UPж, 1жһ */
+    rtc_init();                             /* 初始化RTC */
+    rtc_set_wakeup(RTC_WAKEUPCLOCK_CK_SPRE_16BITS, 0);  /* 配置WAKE UP中断, 1秒钟中断一次 */
+    checkpoint_init();                                  /* 开启后备SRAM, 恢复断电续测记录 */
+    stepper_home_init();                                /* 恢复回零状态和位置 */
+    telemetry_init();                                   /* 初始化遥测输出, 默认文本模式 */
+    cmd_init();                                         /* 注册蓝牙命令 */
+    cmd_register(g_probe_cmds, sizeof(g_probe_cmds) / sizeof(cmd_t));
     
     
     
-    adc_init();                             /* ʼADC */
+    adc_init();                             /* 初始化ADC */
     lcd_show_string(30, 67, 200, 16, 16, "STM32", RED);
     lcd_show_string(30, 87, 200, 16, 16, "ADC TEST", RED);
     //lcd_show_string(30, 136, 200, 16, 16, "ATOM@ALIENTEK", RED);
     lcd_show_string(30, 107, 200, 16, 16, "ADC1_CH3_VAL:", BLUE);
-    lcd_show_string(30, 127, 200, 16, 16, "ADC1_CH3_VOL:0.000V", BLUE); /* ڹ̶λʾС */
+    lcd_show_string(30, 127, 200, 16, 16, "ADC1_CH3_VOL:0.000V", BLUE); /* 先在固定位置显示小数点 */
     
 
     
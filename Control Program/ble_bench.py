@@ -0,0 +1,355 @@
+"""Link benchmark for the ATK-MW579 BLE link: throughput, loss and round-trip latency.
+
+"bench <size> <rate> <ms>" makes the device stream link test frames (see
+Drivers/BSP/BENCH/bench.h). Each frame carries a frame counter, the device
+time and a known byte pattern. While the device streams, the host sends
+"ping <n>" and times each "ping:<n>,..." reply. The report covers:
+
+    goodput  payload bytes per second received
+    lost     frames missing on the link (sequence gaps minus the device's own queue drops)
+    bad      frames whose pattern is wrong (frames failing CRC are counted in err)
+    rtt      p50 / p99 ping round trip while the link is loaded
+
+Rate 0 means "as fast as the device transmit queue allows". Change device
+settings before the runs with --setup, e.g. --setup "baud 230400" --setup "maxput on".
+
+    python ble_bench.py --ble 11:22:33:44:55:66 --size 20,60,114 --rate 0,50 --seconds 5
+    python ble_bench.py --serial /dev/ttyUSB0 --baud 115200
+    python ble_bench.py --pty --link-baud 115200 --link-loss 0.01
+
+--pty runs a stand-in device on a pseudo-terminal. It answers bench and ping
+like the firmware and paces its output to the given UART rate, so the script
+and report can be checked without a radio. --ble needs bleak, --serial needs pyserial.
+"""
+import argparse
+import asyncio
+import collections
+import os
+import random
+import select
+import struct
+import threading
+import time
+import tty
+
+import telemetry as T
+
+WRITE_UUID = "9ecadc24-0ee5-a9e0-93f3-a3b50200406e"     # same characteristics as main.py
+NOTIFY_UUID = "9ecadc24-0ee5-a9e0-93f3-a3b50300406e"
+SIZE_MIN, SIZE_MAX = 4, 114                             # BENCH_SIZE_MIN, BENCH_SIZE_MAX
+TX_BUF_NUM, TX_RESERVE = 16, 2                          # ATK_MW579_UART_TX_BUF_NUM, TELEMETRY_TX_RESERVE
+
+
+def pattern(seq, size):
+    return bytes((seq + i) & 0xFF for i in range(size - 4))
+
+
+def percentile(values, p):
+    if not values:
+        return float('nan')
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(round(p / 100 * (len(ordered) - 1))))]
+
+
+class BleLink:
+    def __init__(self, address):
+        self.address = address
+        self.queue = asyncio.Queue()
+
+    async def open(self):
+        from bleak import BleakClient
+        self.client = BleakClient(self.address)
+        await self.client.connect()
+        await self.client.start_notify(NOTIFY_UUID, lambda _, data: self.queue.put_nowait(bytes(data)))
+
+    async def write(self, text):
+        await self.client.write_gatt_char(WRITE_UUID, text.encode(), response=False)
+
+    async def close(self):
+        await self.client.disconnect()
+
+
+class SerialLink:
+    """The module UART through a USB-UART adapter, read by a helper thread."""
+
+    def __init__(self, port, baud):
+        self.port, self.baud = port, baud
+        self.queue = asyncio.Queue()
+
+    async def open(self):
+        import serial
+        self.ser = serial.Serial(self.port, self.baud, timeout=0.05)
+        loop = asyncio.get_running_loop()
+        threading.Thread(target=self._reader, args=(loop,), daemon=True).start()
+
+    def _reader(self, loop):
+        while self.ser.is_open:
+            try:
+                data = self.ser.read(self.ser.in_waiting or 1)
+            except Exception:
+                break
+            if data:
+                loop.call_soon_threadsafe(self.queue.put_nowait, data)
+
+    async def write(self, text):
+        self.ser.write((text + '\n').encode())
+
+    async def close(self):
+        self.ser.close()
+
+
+class PtyLink:
+    """A pseudo-terminal with a StandIn device on the other side."""
+
+    def __init__(self, baud, loss):
+        self.baud, self.loss = baud, loss
+        self.queue = asyncio.Queue()
+
+    async def open(self):
+        self.fd, device_fd = os.openpty()
+        tty.setraw(self.fd)
+        tty.setraw(device_fd)
+        StandIn(device_fd, self.baud, self.loss).start()
+        loop = asyncio.get_running_loop()
+        threading.Thread(target=self._reader, args=(loop,), daemon=True).start()
+
+    def _reader(self, loop):
+        while True:
+            try:
+                data = os.read(self.fd, 4096)
+            except OSError:
+                break
+            if not data:
+                break
+            loop.call_soon_threadsafe(self.queue.put_nowait, data)
+
+    async def write(self, text):
+        os.write(self.fd, (text + '\n').encode())
+
+    async def close(self):
+        os.close(self.fd)
+
+
+class StandIn(threading.Thread):
+    """Plays the device: answers bench and ping like the firmware.
+
+    Output goes through a transmit queue of TX_BUF_NUM entries drained at
+    `baud` (10 bits per byte), like the DMA queue in atk_mw579_uart.c. A full
+    queue drops the frame and counts it, and `loss` drops frames on the "radio".
+    """
+
+    def __init__(self, fd, baud, loss):
+        super().__init__(daemon=True)
+        self.fd, self.baud, self.loss = fd, baud, loss
+        self.txq = collections.deque()
+        self.wire_free = 0.0
+        self.bench = None
+        self.t0 = time.monotonic()
+
+    def tick(self):
+        return int((time.monotonic() - self.t0) * 1000) & 0xFFFFFFFF
+
+    def send(self, data):
+        if len(self.txq) >= TX_BUF_NUM - 1:
+            return False
+        self.txq.append(data)
+        return True
+
+    def command(self, line):
+        words = line.split()
+        if not words:
+            return
+        if words[0] == 'ping' and len(words) == 2:
+            self.send(f"ping:{words[1]},{self.tick()}\r\n".encode())
+        elif words[0] == 'bench' and len(words) == 4:
+            size, rate, ms = map(int, words[1:])
+            if ms == 0 and self.bench:
+                self.bench['ms'] = 0
+            elif SIZE_MIN <= size <= SIZE_MAX and 0 <= rate <= 2000 and 0 < ms <= 60000:
+                self.bench = dict(size=size, rate=rate, ms=ms, start=time.monotonic(), seq=0, frames=0, drops=0, bytes=0)
+            else:
+                self.send(b"bench:1\r\n")
+                return
+            self.send(b"bench:0\r\n")
+        else:
+            self.send(f"unknown:{words[0]}\r\n".encode())
+
+    def bench_frame(self):
+        b = self.bench
+        payload = struct.pack('<I', self.tick()) + pattern(b['seq'], b['size'])
+        wire = T.encode_frame(T.TYPE_BENCH, b['seq'], payload)
+        if self.send(wire):
+            b['frames'] += 1
+            b['bytes'] += len(wire)
+        else:
+            b['drops'] += 1
+        b['seq'] += 1
+
+    def bench_poll(self):
+        b = self.bench
+        elapsed = int((time.monotonic() - b['start']) * 1000)
+        if elapsed >= b['ms']:
+            self.bench = None
+            self.txq.append(f"benchend:{b['frames']},{b['drops']},{b['bytes']},{elapsed}\r\n".encode())
+            return
+        if b['rate'] == 0:
+            while len(self.txq) < TX_BUF_NUM - 1 - TX_RESERVE:
+                self.bench_frame()
+        else:
+            while b['frames'] + b['drops'] < elapsed * b['rate'] // 1000 + 1:
+                self.bench_frame()
+
+    def run(self):
+        buf = b''
+        while True:
+            ready, _, _ = select.select([self.fd], [], [], 0.0005)
+            if ready:
+                try:
+                    data = os.read(self.fd, 4096)
+                except OSError:
+                    return
+                buf += data
+                while b'\n' in buf:
+                    line, buf = buf.split(b'\n', 1)
+                    self.command(line.decode(errors='replace').strip())
+            if self.bench:
+                self.bench_poll()
+            now = time.monotonic()
+            while self.txq and self.wire_free <= now:
+                data = self.txq.popleft()
+                self.wire_free = max(self.wire_free, now) + len(data) * 10 / self.baud
+                if data[:1] == b'\x00' and random.random() < self.loss:
+                    continue
+                try:
+                    os.write(self.fd, data)
+                except OSError:
+                    return
+
+
+async def wait_line(link, decoder, prefixes, timeout):
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        try:
+            data = await asyncio.wait_for(link.queue.get(), deadline - time.monotonic())
+        except asyncio.TimeoutError:
+            break
+        for event in decoder.feed(data):
+            if event[0] == 'line' and event[1].startswith(prefixes):
+                return event[1]
+    return None
+
+
+async def run_once(link, size, rate, seconds, ping_hz):
+    decoder = T.StreamDecoder()
+    received, bad, pings, rtts = set(), 0, {}, []
+    payload_bytes, first, last, end, last_seq = 0, None, None, None, None
+
+    await link.write(f"bench {size} {rate} {int(seconds * 1000)}")
+    start = time.monotonic()
+    next_ping = start + 0.05
+    deadline = start + seconds + 3
+    while end is None and time.monotonic() < deadline:
+        now = time.monotonic()
+        if now >= next_ping and now < start + seconds:
+            pings[len(pings) + 1] = now
+            await link.write(f"ping {len(pings)}")
+            next_ping += 1 / ping_hz
+        try:
+            data = await asyncio.wait_for(link.queue.get(), max(0.001, min(next_ping, deadline) - time.monotonic()))
+        except asyncio.TimeoutError:
+            continue
+        now = time.monotonic()
+        for event in decoder.feed(data):
+            if event[0] == 'bench':
+                seq, payload = event[1], event[2]
+                # Unwrap the 16-bit counter; long fast runs send more than 65536 frames
+                last_seq = seq if last_seq is None else last_seq + ((seq - last_seq + 0x8000) & 0xFFFF) - 0x8000
+                if len(payload) != size or payload[4:] != pattern(seq, size):
+                    bad += 1
+                    continue
+                received.add(last_seq)
+                payload_bytes += len(payload)
+                first = first if first is not None else now
+                last = now
+            elif event[0] == 'line':
+                line = event[1]
+                if line.startswith('ping:'):
+                    n = int(line[5:].split(',')[0])
+                    if n in pings:
+                        rtts.append((now - pings.pop(n)) * 1000)
+                elif line.startswith('benchend:'):
+                    end = list(map(int, line[9:].split(',')))
+                elif line.startswith('bench:') and line != 'bench:0':
+                    raise SystemExit(f"device refused the run: {line}")
+                elif line.startswith('unknown:bench'):
+                    raise SystemExit("device firmware has no bench command")
+
+    sent, drops = (end[0], end[1]) if end else (len(received) + bad, 0)
+    span = (last - first) if first is not None and last > first else float('nan')
+    return dict(size=size, rate=rate, sent=sent, drops=drops, recv=len(received), bad=bad,
+                lost=max(0, sent - len(received) - bad), err=decoder.errors,
+                fps=len(received) / span, goodput=payload_bytes / span,
+                p50=percentile(rtts, 50), p99=percentile(rtts, 99), pings=len(rtts), timeout=end is None)
+
+
+def print_report(results):
+    print(f'{"size":>4} {"rate":>5} {"sent":>6} {"drop":>5} {"recv":>6} {"lost":>5} {"bad":>4} {"err":>4} '
+          f'{"frame/s":>8} {"goodput B/s":>12} {"loss %":>7} {"rtt p50":>8} {"rtt p99":>8}')
+    for r in results:
+        loss = 100 * r['lost'] / r['sent'] if r['sent'] else 0
+        note = '  (no benchend, counts estimated)' if r['timeout'] else ''
+        print(f'{r["size"]:4} {r["rate"] or "max":>5} {r["sent"]:6} {r["drops"]:5} {r["recv"]:6} {r["lost"]:5} '
+              f'{r["bad"]:4} {r["err"]:4} {r["fps"]:8.1f} {r["goodput"]:12.0f} {loss:7.2f} '
+              f'{r["p50"]:6.1f}ms {r["p99"]:6.1f}ms{note}')
+
+
+async def main_async(args):
+    if args.ble:
+        link = BleLink(args.ble)
+    elif args.serial:
+        link = SerialLink(args.serial, args.baud)
+    else:
+        link = PtyLink(args.link_baud, args.link_loss)
+    await link.open()
+    try:
+        for command in args.setup:
+            await link.write(command)
+            verb = command.split()[0]
+            reply = await wait_line(link, T.StreamDecoder(), (verb + ':', 'unknown:' + verb), 10)
+            print(f'{command}: {reply or "no reply"}')
+        results = []
+        for size in args.size:
+            for rate in args.rate:
+                results.append(await run_once(link, size, rate, args.seconds, args.ping_hz))
+                await asyncio.sleep(0.5)                # let the last replies drain before the next run
+        print_report(results)
+    finally:
+        await link.close()
+
+
+def int_list(text):
+    return [int(v) for v in text.split(',') if v]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    link = parser.add_mutually_exclusive_group(required=True)
+    link.add_argument('--ble', metavar='ADDRESS', help='device BLE address')
+    link.add_argument('--serial', metavar='PORT', help='serial port wired to the module UART')
+    link.add_argument('--pty', action='store_true', help='built-in stand-in device, no radio')
+    parser.add_argument('--baud', type=int, default=115200, help='serial port rate for --serial')
+    parser.add_argument('--link-baud', type=int, default=115200, help='UART rate the --pty stand-in emulates')
+    parser.add_argument('--link-loss', type=float, default=0.0, help='fraction of frames the --pty stand-in drops')
+    parser.add_argument('--size', type=int_list, default=[20, 60, SIZE_MAX], help='payload sizes, comma separated')
+    parser.add_argument('--rate', type=int_list, default=[0], help='frames/s, comma separated, 0 = as fast as possible')
+    parser.add_argument('--seconds', type=float, default=5.0, help='length of each run')
+    parser.add_argument('--ping-hz', type=float, default=10.0, help='pings per second during a run')
+    parser.add_argument('--setup', action='append', default=[], help='device command to send first, repeatable')
+    args = parser.parse_args()
+    if any(not SIZE_MIN <= s <= SIZE_MAX for s in args.size):
+        parser.error(f'sizes must be {SIZE_MIN}..{SIZE_MAX}')
+    asyncio.run(main_async(args))
+
+
+if __name__ == '__main__':
+    main()
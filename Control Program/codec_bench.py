@@ -0,0 +1,109 @@
+"""Compression benchmark for the telemetry codecs on recorded runs.
+
+Reads the adc_values table written by main.py and splits it into runs. A run
+is consecutive rows at the same grid cell with no gap over --gap seconds.
+Each run is encoded with every frame type, using the same frame-filling rules
+as the firmware. The script reports bytes per sample and the compression
+ratio against the old text lines and against fixed 10-byte records.
+
+MCU cost is measured on the device. Send "tlm <mode>", stream for a while,
+then send "tlm" again: the 4th field of the reply is the average number of
+encode cycles per sample (168 cycles = 1 us). Pass those numbers with
+--cycles 1:N,2:N,3:N to get them in the table.
+
+    python codec_bench.py result.db
+    python codec_bench.py --synthetic
+"""
+import argparse
+import random
+import sqlite3
+from datetime import datetime
+
+import telemetry as T
+
+RAW_SIZE = 120          # TELEMETRY_RAW_SIZE
+RECORDS_MAX = 64        # TELEMETRY_RECORDS_MAX
+DELTA_WORST = 18        # TELEMETRY_DELTA_WORST
+FLUSH_EVERY = 20        # the main loop flushes after each 100 ms sampling window (5 ms period)
+MODES = {1: ('fixed', T.TYPE_SAMPLE), 2: ('varint', T.TYPE_VARINT), 3: ('rice', T.TYPE_RICE)}
+
+
+def load_runs(path, gap):
+    conn = sqlite3.connect(path)
+    rows = conn.execute('SELECT timestamp, x, y, adc_value, depth FROM adc_values ORDER BY timestamp').fetchall()
+    conn.close()
+
+    runs, run, last = [], [], None
+    for ts, x, y, adc_value, depth in rows:
+        t = datetime.strptime(ts, '%Y-%m-%d %H:%M:%S.%f').timestamp()
+        sample = (int(t * 1e6) & 0xFFFFFFFF, int(round((depth or 0) * 10000)),
+                  max(0, min(0xFFFF, int(round(adc_value * 4096 / 3.3)))))
+        if last is not None and ((x, y) != last[0] or t - last[1] > gap):
+            runs.append(run)
+            run = []
+        run.append(sample)
+        last = ((x, y), t)
+    if run:
+        runs.append(run)
+    return runs
+
+
+def synthetic_runs(count=5, length=2000):
+    random.seed(445)
+    runs = []
+    for _ in range(count):
+        t, d, f, run = 0, 0, 300, []
+        for i in range(length):
+            t += 5000
+            d += 25                                   # constant step rate while descending
+            f = max(0, min(4095, f + random.randint(-6, 8) + (i // 400)))
+            run.append((t, d, f))
+        runs.append(run)
+    return runs
+
+
+def frame_sizes(rtype, samples):
+    """Raw frame bytes for a run, filling frames exactly like telemetry_sample()."""
+    total, frame = 0, []
+    worst = T.SAMPLE.size if rtype == T.TYPE_SAMPLE else DELTA_WORST
+    for i, s in enumerate(samples):
+        frame.append(s)
+        size = T.HEAD.size + len(T.encode_payload(rtype, frame))
+        if (len(frame) >= RECORDS_MAX or size + 1 + worst + 2 > RAW_SIZE
+                or (i + 1) % FLUSH_EVERY == 0 or i + 1 == len(samples)):
+            total += size + 2
+            frame = []
+    return total
+
+
+def text_size(samples):
+    return sum(len(f"{f * 3.3 / 4096:f},{d}\r\n") for _, d, f in samples)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('db', nargs='?', default='result.db')
+    parser.add_argument('--synthetic', action='store_true', help='use generated runs instead of a database')
+    parser.add_argument('--gap', type=float, default=1.0, help='seconds of silence that end a run')
+    parser.add_argument('--cycles', default='', help='device cycles per sample, e.g. 1:420,2:760,3:1900')
+    args = parser.parse_args()
+
+    runs = synthetic_runs() if args.synthetic else load_runs(args.db, args.gap)
+    runs = [r for r in runs if len(r) > 1]
+    if not runs:
+        raise SystemExit('no runs with more than one sample')
+    cycles = dict(map(int, kv.split(':')) for kv in args.cycles.split(',') if kv)
+
+    samples = sum(len(r) for r in runs)
+    text = sum(text_size(r) for r in runs)
+    fixed = sum(frame_sizes(T.TYPE_SAMPLE, r) for r in runs)
+    print(f'{len(runs)} runs, {samples} samples, text {text / samples:.2f} B/sample')
+    print(f'{"mode":8} {"B/sample":>9} {"vs text":>8} {"vs fixed":>9} {"cycles":>7}')
+    for mode, (name, rtype) in MODES.items():
+        size = sum(frame_sizes(rtype, r) for r in runs)
+        print(f'{name:8} {size / samples:9.2f} {text / size:7.2f}x {fixed / size:8.2f}x '
+              f'{cycles.get(mode, "-"):>7}')
+
+
+if __name__ == '__main__':
+    main()
@@ -7,7 +7,7 @@ def plot_overview():
         # Connect to the database and fetch all data
         conn = sqlite3.connect('result.db')
         cursor = conn.cursor()
-        cursor.execute('SELECT x, y, adc_value, angle FROM adc_values')
+        cursor.execute('SELECT x, y, adc_value, COALESCE(depth, angle / 360.0 * 0.5) FROM adc_values')
         data = cursor.fetchall()
         conn.close()
 
@@ -17,8 +17,8 @@ def plot_overview():
 
         # Group data by (x, y)
         grouped = defaultdict(list)
-        for x, y, adc, angle in data:
-            grouped[(x, y)].append((adc, angle))
+        for x, y, adc, depth in data:
+            grouped[(x, y)].append((adc, depth))
 
         # Prepare data for plotting
         xs, ys, zs, colors = [], [], [], []
@@ -30,8 +30,7 @@ def plot_overview():
             for i in range(0, len(points), batch_size):
                 batch = points[i:i+batch_size]
                 avg_adc = sum(p[0] for p in batch) / len(batch)
-                avg_angle = sum(p[1] for p in batch) / len(batch)
-                depth = (avg_angle / 360) * 0.5  # Calculate depth based on average angle
+                depth = sum(p[1] for p in batch) / len(batch)
 
                 xs.append(x)
                 ys.append(y)
@@ -4,12 +4,47 @@ from tkinter import messagebox, scrolledtext
 from bleak import BleakScanner, BleakClient
 from threading import Thread
 import sqlite3
-from datetime import datetime
+import time
+from datetime import datetime, timedelta
 import matplotlib.pyplot as plt
 from mpl_toolkits.mplot3d import Axes3D
 import numpy as np
 from collections import defaultdict
 
+from telemetry import StreamDecoder, CreditWindow, ClockSync
+
+WRITE_UUID = "9ecadc24-0ee5-a9e0-93f3-a3b50200406e"
+NOTIFY_UUID = "9ecadc24-0ee5-a9e0-93f3-a3b50300406e"
+RECONNECT_S = 2.0  # delay between reconnect attempts after the link drops
+SYNC_BURST = 8  # clock sync exchanges right after connecting
+SYNC_BURST_S = 0.2  # spacing of those
+SYNC_PERIOD_S = 5.0  # then one exchange this often, to follow the drift
+TIMESTAMP_FORMAT = '%Y-%m-%d %H:%M:%S.%f'
+# Must match BLE_BAUD_PATTERN in main.c; the device echoes it in every "baud:" reply
+BAUD_PATTERN = "UUUU****~~~~0123456789ABCDEFabcdef"
+BAUD_FALLBACK = 115200
+# Command macros stored on the device and run there with its own timing ("mrun <name>"), so a
+# whole measurement costs one BLE write instead of a round trip per step. Motor 1 is the probe axis.
+DIP_DEPTH_UM = 20000
+MACROS = {
+    # descend while streaming, stop at depth, settle, retract to the start point
+    'dip': ['start', f'until 1 {DIP_DEPTH_UM}', 'stop', 'delay 500', 'return', 'wait'],
+}
+MACRO_FRAME_MAX = 240  # device command frames are 256 bytes
+
+
+def macro_frames(name, steps, limit):
+    """Pack the steps into "mdef" + "madd" frames that each fit in one BLE write."""
+    frames, verb, body = [], 'mdef', ''
+    for step in steps:
+        if body and len(f"{verb} {name} {body}|{step}") > limit:
+            frames.append(f"{verb} {name} {body}")
+            verb, body = 'madd', ''
+        body = f"{body}|{step}" if body else step
+    frames.append(f"{verb} {name} {body}")
+    return frames
+
+
 class BleakApp:
     def __init__(self, master, loop):
         self.master = master
@@ -18,12 +53,21 @@ class BleakApp:
         self.database_setup()
         self.setup_connection_page()
         self.last_position = None
+        self.run_id = None  # survey run ID, restored from the device's backup-SRAM checkpoint
+        self.done_cells = set()
+        self.decoder = StreamDecoder()  # splits notifications into text replies and binary telemetry frames
+        self.credit = CreditWindow()  # telemetry credit granted to the device, free command slots on the device
+        self.clock_ref = None  # (device time_us, host time) of the newest live sample, used until the clocks are synced
+        self.clock_sync = ClockSync()  # device microsecond clock -> host clock, from "sync" exchanges
+        self.address = None
+        self.closing = False  # no reconnect attempts once the window is closing
         self.setup_close_event()  # Setup close event binding
     
     def setup_close_event(self):
         self.master.protocol("WM_DELETE_WINDOW", self.on_close)
 
     def on_close(self):
+        self.closing = True
         # Run the asynchronous return_to_home task
         asyncio.run(self.return_to_home())
         self.master.destroy()
@@ -35,10 +79,8 @@ class BleakApp:
             dx, dy = 0 - self.last_position[0], 0 - self.last_position[1]
 
         home_command = f"move {dx} {dy}"
-        data_to_send = home_command.encode('utf-8')
-        write_uuid = "9ecadc24-0ee5-a9e0-93f3-a3b50200406e"  # Replace with your characteristic UUID
         try:
-            await self.client.write_gatt_char(write_uuid, data_to_send, response=False)
+            await self.write_command(home_command)
             print("Device returning to home position (0,0)")
         except Exception as e:
             print(f"Failed to send home command: {str(e)}")
@@ -56,7 +98,21 @@ class BleakApp:
                 x INTEGER NOT NULL,
                 y INTEGER NOT NULL,
                 adc_value REAL NOT NULL,
-                angle REAL NOT NULL
+                angle REAL NOT NULL,
+                depth REAL
+            )
+        ''')
+        # Databases created before the firmware reported depth have no depth column
+        columns = [row[1] for row in self.cursor.execute('PRAGMA table_info(adc_values)')]
+        if 'depth' not in columns:
+            self.cursor.execute('ALTER TABLE adc_values ADD COLUMN depth REAL')
+        # Run log: link drops, reconnects and device replays, so gaps in a run can be explained later
+        self.cursor.execute('''
+            CREATE TABLE IF NOT EXISTS run_events (
+                timestamp TEXT NOT NULL,
+                run_id INTEGER,
+                event TEXT NOT NULL,
+                detail TEXT
             )
         ''')
         self.conn.commit()
@@ -97,11 +153,12 @@ class BleakApp:
         asyncio.run_coroutine_threadsafe(self.start_client(address), self.loop)
 
     async def start_client(self, address):
-        client = BleakClient(address)
+        client = BleakClient(address, disconnected_callback=self.on_disconnect)
         try:
             await client.connect()
             if client.is_connected:
                 self.client = client
+                self.address = address
                 self.setup_communication_interface()
                 self.setup_grid_selection()
                 self.setup_results_display()
@@ -137,33 +194,69 @@ class BleakApp:
 
         self.stop_button = tk.Button(self.communication_frame, text="Start", command=lambda: self.send_predefined_message("start"))
         self.stop_button.pack(side=tk.LEFT, padx=10)
+
+        self.new_run_button = tk.Button(self.communication_frame, text="New Run", command=self.start_new_run)
+        self.new_run_button.pack(side=tk.LEFT, padx=10)
+
+        self.dip_button = tk.Button(self.communication_frame, text="Dip", command=lambda: self.send_predefined_message("mrun dip"))
+        self.dip_button.pack(side=tk.LEFT, padx=10)
     
+    async def write_command(self, message):
+        # The device queues a limited number of command frames; wait for a free slot instead of
+        # overrunning it. stop/estop/credit are executed on arrival and never need one.
+        if self.credit.needs_slot(message):
+            if self.credit.cmd_slots <= 0:
+                self.credit.stalls += 1
+                await self.client.write_gatt_char(WRITE_UUID, b"credit 0", response=False)
+                deadline = self.loop.time() + 1.0
+                while self.credit.cmd_slots <= 0 and self.loop.time() < deadline:
+                    await asyncio.sleep(0.02)
+            self.credit.cmd_slots -= 1
+        await self.client.write_gatt_char(WRITE_UUID, message.encode('utf-8'), response=False)
+
     def send_predefined_message(self, message):
         self.append_text(f"Sent: {message}")
-        data_to_send = message.encode('utf-8')
-        write_uuid = "9ecadc24-0ee5-a9e0-93f3-a3b50200406e"
         
         # Send the "power" message immediately.
-        asyncio.run_coroutine_threadsafe(
-            self.client.write_gatt_char(write_uuid, data_to_send, response=False),
-            self.loop
-        )
+        asyncio.run_coroutine_threadsafe(self.write_command(message), self.loop)
 
         # If the message is "power", schedule to send "stop" after 20 seconds.
         # if message == "power":
         #     self.master.after(32500, self.send_stop_message)
 
+    def start_new_run(self):
+        # The device keeps the run ID and completed cells across power loss; a new run clears them
+        self.run_id = int(time.time()) & 0x7FFFFFFF
+        for cell in self.done_cells:
+            self.grid_buttons[cell].config(bg='lightblue')
+        self.done_cells.clear()
+        self.send_predefined_message(f"run {self.run_id}")
+
+    def restore_checkpoint(self, data_str):
+        # ckpt:<run>,<row>,<col>,<done low 32 bits hex>,<done high 32 bits hex>,<homed mask>
+        run_id, x, y, done_lo, done_hi, homed = data_str[len("ckpt:"):].split(',')
+        run_id, x, y = int(run_id), int(x), int(y)
+        if run_id == 0:
+            self.append_text("No survey in progress, starting a new run")
+            self.master.after(0, self.start_new_run)
+            return
+
+        self.run_id = run_id
+        done = int(done_lo, 16) | (int(done_hi, 16) << 32)
+        self.done_cells = {(i, j) for i in range(7) for j in range(7) if done & (1 << (i * 7 + j))}
+        if x < 7 and y < 7:
+            self.last_position = (x, y)
+        for cell in self.done_cells:
+            self.master.after(0, lambda c=cell: self.grid_buttons[c].config(bg='lightgreen'))
+        self.append_text(f"Resumed run {run_id} at {self.last_position}, "
+                         f"{len(self.done_cells)} cells done, homed axes mask {homed}")
+
     def send_stop_message(self):
         stop_message = "stop"
         self.append_text(f"Sent: {stop_message}")
-        data_to_send = stop_message.encode('utf-8')
-        write_uuid = "9ecadc24-0ee5-a9e0-93f3-a3b50200406e"
         
         # Send the "stop" message after a delay.
-        asyncio.run_coroutine_threadsafe(
-            self.client.write_gatt_char(write_uuid, data_to_send, response=False),
-            self.loop
-        )
+        asyncio.run_coroutine_threadsafe(self.write_command(stop_message), self.loop)
 
     def setup_grid_selection(self):
         self.grid_frame = tk.Frame(self.master)
@@ -187,6 +280,11 @@ class BleakApp:
                 button.config(command=lambda i=i, j=j, btn=button: self.handle_grid_click(i, j, btn))
 
     def handle_grid_click(self, i, j, button):
+        # Completed cells survive a power loss on the device; do not re-run them by accident
+        if (i, j) in self.done_cells and not messagebox.askyesno(
+                "Cell already measured", f"Cell {i},{j} is already done in this run. Measure it again?"):
+            return
+
         # Check if it's the first click
         if self.last_position is None:
             # For the first click, treat the clicked position as relative to (0,0)
@@ -209,10 +307,11 @@ class BleakApp:
 
     async def send_motion_to_device(self, dx, dy):
         message = f'move {dx} {dy}'
-        data_to_send = message.encode('utf-8')
-        write_uuid = "9ecadc24-0ee5-a9e0-93f3-a3b50200406e"
-        await self.client.write_gatt_char(write_uuid, data_to_send, response=False)
+        await self.write_command(message)
         self.append_text(f"Motion sent: {dx}, {dy}")
+        # Record the target cell in the device checkpoint so a brown-out can resume here
+        message = f'cell {self.last_position[0]} {self.last_position[1]}'
+        await self.write_command(message)
 
 
     def setup_results_display(self):
@@ -227,47 +326,165 @@ class BleakApp:
 
 
     async def notification_handler(self, sender, data):
-        data_str = data.decode('utf-8').strip()
+        for event in self.decoder.feed(data):
+            if event[0] == 'line':
+                await self.handle_line(event[1])
+                continue
+            top_up = self.credit.on_frame()
+            if top_up:
+                await self.write_command(top_up)
+            if event[0] == 'samples':
+                await self.handle_samples(event[2])
+            elif event[0] == 'recovered':
+                await self.handle_samples(event[2], recovered=True)
+            else:
+                await self.handle_summary(event[2])
+        # Ask the device to resend only the records lost in dropped notifications
+        for command in self.decoder.gap_requests(self.loop.time()):
+            await self.write_command(command)
+
+    def device_timestamp(self, time_us):
+        # Samples carry the device clock at acquisition. Once synced, that maps straight onto the host
+        # clock. Before that, place them relative to the newest live sample's arrival time, which
+        # still carries the BLE batching jitter.
+        if self.clock_sync.ready:
+            t = datetime.fromtimestamp(self.clock_sync.to_host(time_us))
+        elif self.clock_ref:
+            ref_us, ref_time = self.clock_ref
+            age_us = ((ref_us - time_us + 2**31) % 2**32) - 2**31
+            t = ref_time - timedelta(microseconds=age_us)
+        else:
+            t = datetime.now()
+        return t.strftime(TIMESTAMP_FORMAT)
+
+    async def handle_samples(self, samples, recovered=False):
+        # Binary frames carry the raw 12-bit ADC reading; convert it to volts like the text path does
+        if not recovered:
+            self.clock_ref = (samples[-1][0], datetime.now())
+        rows = []
+        for time_us, depth_um, force in samples:
+            adc_value = force * 3.3 / 4096
+            # Late records skip the force limit, which only applies to where the probe is now
+            if not recovered and self.check_force_limit(adc_value):
+                break
+            rows.append((self.device_timestamp(time_us), adc_value, depth_um / 10000))
+        if rows:
+            await self.loop.run_in_executor(None, self.insert_db_records, rows)
+
+    async def handle_summary(self, summary):
+        # The link was saturated and the device folded these samples into one record
+        # instead of dropping them; keep the mean so the depth profile has no hole
+        adc_value = summary['force_mean'] * 3.3 / 4096
+        self.append_text(f"Link saturated: {summary['count']} samples summarised, "
+                         f"depth {summary['depth_first']}-{summary['depth_last']} um, "
+                         f"force {summary['force_min']}-{summary['force_max']}")
+        if self.check_force_limit(summary['force_max'] * 3.3 / 4096):
+            return
+        timestamp = self.device_timestamp(summary['time_last'])
+        await self.loop.run_in_executor(None, self.insert_db_record, timestamp, adc_value,
+                                        summary['depth_last'] / 10000)
+
+    def check_force_limit(self, adc_value):
+        if (adc_value * 6 * 9.81 > 90):
+            print("Force is too Large... Return")
+            message = "return"
+            asyncio.run_coroutine_threadsafe(self.write_command(message), self.loop)
+            self.append_text(f"Force is too Large... Return")
+            return True
+        return False
+
+    async def handle_line(self, data_str):
         # print(f"Received data: {data_str}")
-        
+
+        if self.credit.on_line(data_str):
+            return
+
+        if data_str.startswith("ckpt:"):
+            self.restore_checkpoint(data_str)
+            return
+
+        if data_str.startswith("sync:"):
+            self.clock_sync.on_reply(data_str)
+            return
+
+        if data_str.startswith("rtx:"):
+            self.decoder.on_rtx_reply(data_str)
+            return
+
+        if data_str.startswith("baud:"):
+            await self.check_baud(data_str)
+            return
+
+        if data_str.startswith("replay:"):
+            # replay:<disconnects>,<down ms>,<up ms>,<records to replay>,<records spooled>,<records lost>
+            self.decoder.expect_replay(self.loop.time())
+            fields = data_str[len("replay:"):].split(',')
+            if len(fields) == 6:
+                down_s = ((int(fields[2]) - int(fields[1])) & 0xFFFFFFFF) / 1000
+                self.append_text(f"Device was disconnected {down_s:.1f} s: replaying {fields[3]} records, "
+                                 f"{fields[5]} lost to spool overflow in total")
+            await self.loop.run_in_executor(None, self.insert_event, 'replay', data_str[len("replay:"):])
+            return
+
+        if data_str.startswith("mbegin:") or data_str.startswith("mend:"):
+            # mend:<name>,<result>,<step>,<step result>,<steps run>,<ms>; result 0 is success
+            self.append_text(f"Device: {data_str}")
+            event, detail = data_str.split(':', 1)
+            await self.loop.run_in_executor(None, self.insert_event, event, detail)
+            return
+
+        if data_str.startswith("done:"):
+            cell = tuple(map(int, data_str[len("done:"):].split(',')))
+            self.done_cells.add(cell)
+            self.master.after(0, lambda: self.grid_buttons[cell].config(bg='lightgreen'))
+            return
+
+        if ':' in data_str:
+            # Command replies and events are "<verb>:<result>"; data lines never contain ':'
+            self.append_text(f"Device: {data_str}")
+            return
+
         try:
             # Split data based on comma and remove any surrounding whitespace
             parts = [part.strip() for part in data_str.split(',')]
             if len(parts) != 2:
                 raise ValueError(f"Expected 2 parts but got {len(parts)}: {parts}")
 
-            adc_value, angle_value = map(float, parts)  # Convert both parts to float
-            # print(adc_value, angle_value)
+            # The firmware converts steps to micrometres itself, so no lead-screw math here
+            adc_value, depth_um = map(float, parts)  # Convert both parts to float
+            depth_cm = depth_um / 10000
+            # print(adc_value, depth_cm)
 
             # Add milliseconds to the timestamp
             timestamp = datetime.now().strftime('%Y-%m-%d %H:%M:%S.%f')[:-3]
 
-            if (adc_value * 6 * 9.81 > 90):
-                print("Force is too Large... Return")
-                message = "return"
-                data_to_send = message.encode('utf-8')
-                write_uuid = "9ecadc24-0ee5-a9e0-93f3-a3b50200406e"
-                asyncio.run_coroutine_threadsafe(
-                    self.client.write_gatt_char(write_uuid, data_to_send, response=False),
-                    self.loop
-                )
-                self.append_text(f"Force is too Large... Return")
-
-            else:
-                await self.loop.run_in_executor(None, self.insert_db_record, timestamp, adc_value, angle_value*0.225)
+            if not self.check_force_limit(adc_value):
+                await self.loop.run_in_executor(None, self.insert_db_record, timestamp, adc_value, depth_cm)
 
 
         except ValueError as e:
             print(f"Error processing notification: {e}")
             self.append_text(f"Error processing notification: {e}")
 
-    def insert_db_record(self, timestamp, adc_value, angle_value):
+    async def check_baud(self, data_str):
+        # The device module-to-MCU UART rate was negotiated on the device; the test pattern
+        # checks that the whole path (MCU -> module -> BLE -> host) survives at that rate
+        fields = data_str[len("baud:"):].split(',')
+        if len(fields) == 4 and fields[3] == BAUD_PATTERN:
+            self.append_text(f"Device UART {fields[1]} baud, {fields[2]} receive errors")
+            return
+        self.append_text(f"Device UART pattern check failed ({data_str}), falling back to {BAUD_FALLBACK}")
+        if len(fields) < 2 or fields[1] != str(BAUD_FALLBACK):    # already at the fallback: nothing lower to try
+            await self.write_command(f"baud {BAUD_FALLBACK}")
+
+    def insert_db_record(self, timestamp, adc_value, depth_cm):
         try:
             # Perform the SQLite operations
             conn = sqlite3.connect('result.db')
             cursor = conn.cursor()
-            cursor.execute('INSERT INTO adc_values (timestamp, x, y, adc_value, angle) VALUES (?, ?, ?, ?, ?)', 
-                        (timestamp, self.last_position[0], self.last_position[1], adc_value, angle_value))
+            # angle is only kept for older rows; new rows carry the depth reported by the device
+            cursor.execute('INSERT INTO adc_values (timestamp, x, y, adc_value, angle, depth) VALUES (?, ?, ?, ?, ?, ?)', 
+                        (timestamp, self.last_position[0], self.last_position[1], adc_value, 0.0, depth_cm))
             conn.commit()
         except sqlite3.Error as e:
             # Log or handle the error
@@ -275,11 +492,93 @@ class BleakApp:
         finally:
             conn.close()
 
+    def insert_db_records(self, rows):
+        # One transaction per telemetry frame instead of one connection per sample
+        try:
+            conn = sqlite3.connect('result.db')
+            conn.executemany('INSERT INTO adc_values (timestamp, x, y, adc_value, angle, depth) VALUES (?, ?, ?, ?, ?, ?)',
+                             [(timestamp, self.last_position[0], self.last_position[1], adc_value, 0.0, depth_cm)
+                              for timestamp, adc_value, depth_cm in rows])
+            conn.commit()
+        except sqlite3.Error as e:
+            print(f"Database error: {e}")
+        finally:
+            conn.close()
+
+    def on_disconnect(self, client):
+        if self.closing or client is not getattr(self, 'client', None):
+            return
+        self.append_text("Link lost, the device keeps recording; reconnecting...")
+        self.loop.run_in_executor(None, self.insert_event, 'disconnect', None)
+        asyncio.ensure_future(self.reconnect(), loop=self.loop)
+
+    async def reconnect(self):
+        attempts = 0
+        while not self.closing:
+            await asyncio.sleep(RECONNECT_S)
+            attempts += 1
+            client = BleakClient(self.address, disconnected_callback=self.on_disconnect)
+            try:
+                await client.connect()
+            except Exception as e:
+                print(f"Reconnect attempt {attempts} failed: {e}")
+                continue
+            if not client.is_connected:
+                continue
+            self.client = client
+            await self.client.start_notify(NOTIFY_UUID, self.notification_handler)
+            self.append_text(f"Reconnected after {attempts} attempt(s)")
+            await self.loop.run_in_executor(None, self.insert_event, 'reconnect', f"attempts={attempts}")
+            # Fresh credit (the old grant may be used up), then fetch what the device spooled meanwhile
+            await self.write_command(self.credit.grant())
+            await self.write_command("replay")
+            await self.upload_macros()              # in case the device was reset meanwhile
+            return
+
+    def insert_event(self, event, detail):
+        try:
+            conn = sqlite3.connect('result.db')
+            conn.execute('INSERT INTO run_events (timestamp, run_id, event, detail) VALUES (?, ?, ?, ?)',
+                         (datetime.now().strftime('%Y-%m-%d %H:%M:%S.%f')[:-3], self.run_id, event, detail))
+            conn.commit()
+        except sqlite3.Error as e:
+            print(f"Database error: {e}")
+        finally:
+            conn.close()
+
     async def manage_device_communication(self):
-        notify_uuid = "9ecadc24-0ee5-a9e0-93f3-a3b50300406e"
-        # Change 'notification_handler' to 'self.notification_handler'
-        await self.client.start_notify(notify_uuid, self.notification_handler)
+        await self.client.start_notify(NOTIFY_UUID, self.notification_handler)
         self.append_text("Subscribed to notifications. Listening for messages from the device...")
+        # Ask for the backup-SRAM checkpoint so an interrupted survey picks up where it stopped
+        self.send_predefined_message("resume")
+        # Switch the device to binary telemetry frames (many samples per BLE write)
+        self.send_predefined_message("tlm 1")
+        # Grant telemetry credit; the reply also tells us how many commands the device can queue
+        self.send_predefined_message(self.credit.grant())
+        # Check the negotiated device UART rate with its test pattern
+        self.send_predefined_message("baud")
+        asyncio.ensure_future(self.sync_clock(), loop=self.loop)
+        # The device keeps macros in RAM only; upload them on every connection
+        asyncio.ensure_future(self.upload_macros(), loop=self.loop)
+
+    async def upload_macros(self):
+        limit = min(MACRO_FRAME_MAX, getattr(self.client, 'mtu_size', 23) - 3)
+        for name, steps in MACROS.items():
+            for frame in macro_frames(name, steps, limit):
+                await self.write_command(frame)
+
+    async def sync_clock(self):
+        # A burst first so samples get acquisition times quickly, then slow exchanges to follow the drift
+        sent = 0
+        while not self.closing:
+            try:
+                await self.write_command(self.clock_sync.request())
+            except Exception as e:
+                print(f"Clock sync request failed: {e}")    # link down; the reconnect logic takes over
+            sent += 1
+            if sent == SYNC_BURST and self.clock_sync.ready:
+                self.append_text(f"Device clock synced to within {self.clock_sync.error * 1000:.2f} ms")
+            await asyncio.sleep(SYNC_BURST_S if sent < SYNC_BURST else SYNC_PERIOD_S)
 
     def append_text(self, text):
         # Ensure the UI is updated in a thread-safe way
@@ -334,8 +633,8 @@ class BleakApp:
         # Fetch data from the database for the selected (x, y) pair
         connection = sqlite3.connect('result.db')
         cursor = connection.cursor()
-        # Fetching both adc_value and angle
-        cursor.execute('SELECT timestamp, adc_value, angle FROM adc_values WHERE x=? AND y=? ORDER BY timestamp', (x, y))
+        # Fetching adc_value and depth, falling back to the old angle formula for rows without depth
+        cursor.execute('SELECT timestamp, adc_value, COALESCE(depth, angle / 360.0 * 0.5) FROM adc_values WHERE x=? AND y=? ORDER BY timestamp', (x, y))
         records = cursor.fetchall()
         connection.close()
 
@@ -346,10 +645,7 @@ class BleakApp:
         # Prepare data for plotting
         timestamps = [datetime.strptime(record[0], '%Y-%m-%d %H:%M:%S.%f') for record in records]
         adc_values = [record[1] * 6 * 9.81 for record in records]
-        angles = [record[2] for record in records]
-
-        # Calculate depth from angle
-        depths = [(angle / 360) * 0.5 for angle in angles]
+        depths = [record[2] for record in records]
 
         # Plotting the data
         plt.figure(figsize=(10, 5))
@@ -416,7 +712,7 @@ class BleakApp:
         # Connect to the database and fetch all data
         conn = sqlite3.connect('result.db')
         cursor = conn.cursor()
-        cursor.execute('SELECT x, y, adc_value, angle FROM adc_values')
+        cursor.execute('SELECT x, y, adc_value, COALESCE(depth, angle / 360.0 * 0.5) FROM adc_values')
         data = cursor.fetchall()
         conn.close()
 
@@ -426,8 +722,8 @@ class BleakApp:
 
         # Group data by (x, y)
         grouped = defaultdict(list)
-        for x, y, adc, angle in data:
-            grouped[(x, y)].append((adc, angle))
+        for x, y, adc, depth in data:
+            grouped[(x, y)].append((adc, depth))
 
         # Prepare data for plotting
         xs, ys, zs, colors = [], [], [], []
@@ -439,8 +735,7 @@ class BleakApp:
             for i in range(0, len(points), batch_size):
                 batch = points[i:i+batch_size]
                 avg_adc = sum(p[0] for p in batch) / len(batch)
-                avg_angle = sum(p[1] for p in batch) / len(batch)
-                depth = (avg_angle / 360) * 0.5  # Calculate depth based on average angle
+                depth = sum(p[1] for p in batch) / len(batch)
 
                 xs.append(x)
                 ys.append(y)
@@ -469,12 +764,7 @@ class BleakApp:
             self.master.quit()
             return
         self.entry.delete(0, tk.END)
-        data_to_send = message.encode('utf-8')
-        write_uuid = "9ecadc24-0ee5-a9e0-93f3-a3b50200406e"
-        asyncio.run_coroutine_threadsafe(
-            self.client.write_gatt_char(write_uuid, data_to_send, response=False),
-            self.loop
-        )
+        asyncio.run_coroutine_threadsafe(self.write_command(message), self.loop)
         self.append_text(f"Sent: {message}")
 
     def append_text(self, text):
@@ -0,0 +1,536 @@
+"""Decoder for the binary telemetry frames sent by the probe firmware.
+
+Frame layout (version 2, little endian), see Drivers/BSP/TELEMETRY/telemetry.h:
+
+    raw frame : ver(1) | type(1) | seq(2) | payload | crc16(2)
+    on the wire: 0x00 | COBS(raw frame) | 0x00
+
+seq is the sequence number of the first record in the frame. The CRC is
+CRC-16/CCITT-FALSE over everything before it. Command replies are still
+plain text lines, sent between frames on the same link.
+
+Compressed frames (TYPE_VARINT, TYPE_RICE) carry count(1), one full keyframe
+record, then count - 1 deltas: second-order zig-zag deltas of time and depth
+and a first-order zig-zag delta of force. Every frame starts from a keyframe
+with fresh adaptive state, so a lost frame never affects the next one.
+
+Flow control: the host grants telemetry credit with "credit N" (one credit per
+frame). While the device has no credit, or its transmit queue is nearly full,
+it folds samples into a TYPE_SUMMARY frame instead of dropping them. That frame
+is sent first when the link recovers, so sequence numbers stay contiguous. The
+reply "credit:S" gives S, the number of free command slots on the device.
+
+Retransmit: record n of a frame has sequence number seq + n. The device keeps
+its recent frames in a RAM history ring. When the decoder sees a jump in
+sequence numbers, it marks only the skipped records as missing and asks for
+them with "rtx <seq> <count>". The device resends the frames that cover that
+range. In normal operation nothing is acknowledged.
+
+Timestamps: since version 2, record times are the device microsecond clock at
+acquisition (version 1 used milliseconds). ClockSync maps them onto the host
+clock.
+"""
+import binascii
+import struct
+import time
+
+VERSION = 2
+TYPE_SAMPLE = 0x01
+TYPE_VARINT = 0x02
+TYPE_RICE = 0x03
+TYPE_SUMMARY = 0x04
+TYPE_BENCH = 0x05       # link benchmark frames, see ble_bench.py
+RICE_ESC = 16
+
+HEAD = struct.Struct('<BBH')
+SAMPLE = struct.Struct('<IiH')  # time_us, depth_um, force (raw ADC)
+# count, time_first, time_last, depth_first, depth_last, force_min, force_max, force_mean
+SUMMARY = struct.Struct('<IIIiiHHH')
+
+
+def crc16(data):
+    return binascii.crc_hqx(data, 0xFFFF)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            raise ValueError("bad COBS block")
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def cobs_encode(data):
+    out = bytearray()
+    block = bytearray()
+    for b in data:
+        if b == 0:
+            out += bytes([len(block) + 1]) + block
+            block.clear()
+        else:
+            block.append(b)
+            if len(block) == 0xFE:
+                out += b'\xff' + block
+                block.clear()
+    out += bytes([len(block) + 1]) + block
+    return bytes(out)
+
+
+def encode_frame(rtype, seq, payload):
+    """Build one frame as it appears on the wire, delimiters included."""
+    raw = HEAD.pack(VERSION, rtype, seq & 0xFFFF) + payload
+    return b'\x00' + cobs_encode(raw + struct.pack('<H', crc16(raw))) + b'\x00'
+
+
+def decode_frame(chunk):
+    """Decode one COBS chunk into (type, seq, payload); raises ValueError if it is not a valid frame."""
+    raw = cobs_decode(chunk)
+    if len(raw) < HEAD.size + 2:
+        raise ValueError("short frame")
+    if crc16(raw[:-2]) != struct.unpack_from('<H', raw, len(raw) - 2)[0]:
+        raise ValueError("CRC mismatch")
+    ver, rtype, seq = HEAD.unpack_from(raw)
+    if ver != VERSION:
+        raise ValueError(f"unsupported frame version {ver}")
+    return rtype, seq, raw[HEAD.size:-2]
+
+
+def decode_samples(payload):
+    if len(payload) % SAMPLE.size:
+        raise ValueError("partial sample record")
+    return [SAMPLE.unpack_from(payload, i) for i in range(0, len(payload), SAMPLE.size)]
+
+
+def zigzag(v):
+    return ((v << 1) ^ (v >> 31)) & 0xFFFFFFFF
+
+
+def unzigzag(u):
+    return (u >> 1) ^ -(u & 1)
+
+
+class _Rice:
+    """Adaptive Rice parameter per field, reset at every keyframe (mirrors telemetry_put_rice)."""
+
+    def __init__(self):
+        self.a = [2, 2, 2]
+        self.n = [1, 1, 1]
+
+    def k(self, field):
+        k = 0
+        while (self.n[field] << k) < self.a[field] and k < 24:
+            k += 1
+        return k
+
+    def update(self, field, u):
+        self.a[field] += u
+        self.n[field] += 1
+        if self.n[field] >= 16:
+            self.a[field] >>= 1
+            self.n[field] >>= 1
+
+
+class _BitReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def bit(self):
+        if self.pos >= len(self.data) * 8:
+            raise ValueError("Rice stream overrun")
+        b = (self.data[self.pos >> 3] >> (7 - (self.pos & 7))) & 1
+        self.pos += 1
+        return b
+
+    def bits(self, n):
+        v = 0
+        for _ in range(n):
+            v = (v << 1) | self.bit()
+        return v
+
+
+def _read_rice(reader, rice, field):
+    k = rice.k(field)
+    q = 0
+    while q < RICE_ESC and reader.bit():
+        q += 1
+    u = reader.bits(32) if q == RICE_ESC else (q << k) | reader.bits(k)
+    rice.update(field, u)
+    return u
+
+
+def _read_varint(payload, pos):
+    v = shift = 0
+    while True:
+        if pos >= len(payload) or shift > 28:
+            raise ValueError("bad varint")
+        b = payload[pos]
+        pos += 1
+        v |= (b & 0x7F) << shift
+        shift += 7
+        if b < 0x80:
+            return v, pos
+
+
+def decode_delta(rtype, payload):
+    if len(payload) < 1 + SAMPLE.size:
+        raise ValueError("short delta frame")
+    count = payload[0]
+    t, d, f = SAMPLE.unpack_from(payload, 1)
+    samples = [(t, d, f)]
+    dt = dd = 0
+    pos = 1 + SAMPLE.size
+    reader, rice = _BitReader(payload[pos:]), _Rice()
+    for _ in range(count - 1):
+        if rtype == TYPE_VARINT:
+            fields = []
+            for _field in range(3):
+                u, pos = _read_varint(payload, pos)
+                fields.append(unzigzag(u))
+        else:
+            fields = [unzigzag(_read_rice(reader, rice, field)) for field in range(3)]
+        dt += fields[0]
+        dd += fields[1]
+        t = (t + dt) & 0xFFFFFFFF
+        d += dd
+        f = (f + fields[2]) & 0xFFFF
+        samples.append((t, d, f))
+    return samples
+
+
+def encode_payload(rtype, samples):
+    """Reference encoder matching telemetry_sample(); used by the codec benchmark."""
+    if rtype == TYPE_SAMPLE:
+        return b''.join(SAMPLE.pack(*s) for s in samples)
+    out = bytearray([len(samples)]) + SAMPLE.pack(*samples[0])
+    acc, nbits, rice = 0, 0, _Rice()
+    bits = []
+    pt, pd, pf = samples[0]
+    dt = dd = 0
+    for t, d, f in samples[1:]:
+        fields = [zigzag((t - pt - dt)), zigzag(d - pd - dd), zigzag(f - pf)]
+        dt, dd = t - pt, d - pd
+        pt, pd, pf = t, d, f
+        for field, u in enumerate(fields):
+            if rtype == TYPE_VARINT:
+                while u >= 0x80:
+                    out.append((u & 0x7F) | 0x80)
+                    u >>= 7
+                out.append(u)
+            else:
+                k = rice.k(field)
+                q = u >> k
+                if q < RICE_ESC:
+                    bits.append(((1 << (q + 1)) - 2, q + 1))
+                    bits.append((u & ((1 << k) - 1), k))
+                else:
+                    bits.append((0xFFFF, RICE_ESC))
+                    bits.append((u, 32))
+                rice.update(field, u)
+    for v, n in bits:
+        acc = (acc << n) | v
+        nbits += n
+    if nbits:
+        pad = (8 - nbits % 8) % 8
+        out += (acc << pad).to_bytes((nbits + pad) // 8, 'big')
+    return bytes(out)
+
+
+class StreamDecoder:
+    """Splits the notification byte stream into text lines and binary frames.
+
+    BLE notifications can cut a frame or a line anywhere, so bytes are buffered
+    until a delimiter arrives. Text ends with a newline; a frame is enclosed in
+    0x00 bytes. If a 0x00 closes something that does not decode, it is taken to
+    be the opening of the next frame, which resynchronises after one bad frame.
+
+    A sequence jump marks the skipped records as missing; gap_requests() turns
+    them into "rtx" commands. A frame that arrives behind next_seq is a
+    retransmit, and only its still-missing records are passed on.
+
+    After a reconnect the device replays what it spooled while the link was
+    down; expect_replay() holds off "rtx" requests while that replay is
+    still making progress, so the same records are not sent twice.
+    """
+
+    MAX_GAP = 6144          # records tracked per gap; the device history holds no more than this
+    MAX_TRIES = 3           # requests per missing record before giving up on it
+    RETRY_S = 0.5           # time between request rounds
+    MAX_RUNS = 4            # ranges requested per round
+    RESTART_GAP = 8192      # a frame further behind than this means the device restarted its sequence
+    REPLAY_IDLE_S = 1.0     # a replay that recovers nothing for this long is over; request what is still missing
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.in_frame = False
+        self.next_seq = None
+        self.frames = 0
+        self.errors = 0
+        self.lost = 0           # records skipped by sequence jumps
+        self.recovered = 0      # of those, records filled in by retransmits
+        self.abandoned = 0      # records given up on (evicted from the device history or never resent)
+        self.missing = {}       # seq -> number of rtx requests sent for it
+        self.requests = []      # (start, count) of rtx commands awaiting their reply, oldest first
+        self.last_request = 0.0
+        self.replay_until = 0.0
+        self.replay_mark = 0    # self.recovered when the replay last made progress
+
+    def feed(self, data):
+        """Return a list of events: ('line', str), ('samples', seq, [(time_us, depth_um, force), ...]),
+        ('recovered', seq, [...]) for retransmitted records that were missing,
+        ('summary', seq, {field: value}) for samples the device could not send individually, and
+        ('bench', seq, payload) for link benchmark frames, which have their own sequence."""
+        events = []
+        for b in data:
+            if b == 0:
+                if self.in_frame and self.buf:
+                    event = self._frame(bytes(self.buf))
+                    if event:
+                        events.append(event)
+                        self.in_frame = False
+                else:
+                    self.in_frame = True
+                self.buf.clear()
+            elif b == 0x0A and not self.in_frame:
+                line = self.buf.decode('utf-8', errors='replace').strip()
+                self.buf.clear()
+                if line:
+                    events.append(('line', line))
+            else:
+                self.buf.append(b)
+        return events
+
+    def _frame(self, chunk):
+        try:
+            rtype, seq, payload = decode_frame(chunk)
+            if rtype == TYPE_SAMPLE:
+                samples = decode_samples(payload)
+            elif rtype in (TYPE_VARINT, TYPE_RICE):
+                samples = decode_delta(rtype, payload)
+            elif rtype == TYPE_BENCH:
+                self.frames += 1
+                return ('bench', seq, payload)
+            elif rtype == TYPE_SUMMARY:
+                summary = dict(zip(('count', 'time_first', 'time_last', 'depth_first', 'depth_last',
+                                    'force_min', 'force_max', 'force_mean'), SUMMARY.unpack(payload)))
+            else:
+                raise ValueError(f"unknown record type {rtype}")
+        except ValueError:
+            self.errors += 1
+            return None
+
+        self.frames += 1
+        count = summary['count'] if rtype == TYPE_SUMMARY else len(samples)
+        if self.next_seq is None:
+            self.next_seq = seq
+        ahead = (seq - self.next_seq) & 0xFFFF
+        if ahead >= 0x8000:
+            if rtype != TYPE_SUMMARY:
+                wanted = [i for i in range(count) if (seq + i) & 0xFFFF in self.missing]
+                if wanted:
+                    for i in wanted:
+                        del self.missing[(seq + i) & 0xFFFF]
+                    self.recovered += len(wanted)
+                    return ('recovered', seq, [samples[i] for i in wanted])
+            if 0x10000 - ahead <= self.RESTART_GAP:
+                return None                                     # duplicate of records we already have
+            self.abandoned += len(self.missing)
+            self.missing.clear()
+            ahead = 0
+
+        self.lost += ahead
+        self.abandoned += max(0, ahead - self.MAX_GAP)
+        for i in range(max(0, ahead - self.MAX_GAP), ahead):
+            self.missing.setdefault((self.next_seq + i) & 0xFFFF, 0)
+        self.next_seq = (seq + count) & 0xFFFF
+        if rtype == TYPE_SUMMARY:
+            return ('summary', seq, summary)
+        return ('samples', seq, samples)
+
+    def gap_requests(self, now):
+        """Return the "rtx <seq> <count>" commands due at time `now` (seconds) for missing records."""
+        if now < self.replay_until:
+            if self.recovered != self.replay_mark:
+                self.replay_mark = self.recovered
+                self.replay_until = now + self.REPLAY_IDLE_S
+            return []
+        if not self.missing or now - self.last_request < self.RETRY_S:
+            return []
+        self.last_request = now
+
+        for seq, tries in list(self.missing.items()):
+            if tries >= self.MAX_TRIES:
+                del self.missing[seq]
+                self.abandoned += 1
+
+        # Oldest first, so records about to fall out of the device history are asked for first
+        runs = []
+        for seq in sorted(self.missing, key=lambda s: (s - self.next_seq) & 0xFFFF):
+            if runs and (runs[-1][0] + runs[-1][1]) & 0xFFFF == seq:
+                runs[-1][1] += 1
+            else:
+                runs.append([seq, 1])
+
+        commands = []
+        for start, n in runs[:self.MAX_RUNS]:
+            for i in range(n):
+                self.missing[(start + i) & 0xFFFF] += 1
+            self.requests.append((start, n))
+            commands.append(f"rtx {start} {n}")
+        return commands
+
+    def expect_replay(self, now):
+        """The device is about to replay records it spooled while disconnected."""
+        self.replay_until = now + self.REPLAY_IDLE_S
+        self.replay_mark = self.recovered
+
+    def on_rtx_reply(self, line):
+        """Handle "rtx:<sent>,<missing>". The device history only loses its oldest frames, so the
+        records it no longer has are the first `missing` of the range; stop asking for them."""
+        if not self.requests:
+            return
+        start, n = self.requests.pop(0)
+        try:
+            gone = int(line[4:].split(',')[1])
+        except (IndexError, ValueError):
+            return
+        for i in range(min(gone, n)):
+            if self.missing.pop((start + i) & 0xFFFF, None) is not None:
+                self.abandoned += 1
+
+
+class CreditWindow:
+    """Host side of the credit scheme.
+
+    Telemetry: grant `window` frames up front, then top the grant up each time
+    half of it has been used, so the device never waits on a full round trip.
+    Commands: the last "credit:S" reply says how many commands the device can
+    queue. Each command uses one slot. When none are left the host sends
+    "credit 0" to get a fresh count. stop, estop, credit and sync skip the
+    device queue, so they never use a slot.
+    """
+
+    URGENT = ('stop', 'estop', 'credit', 'sync', 'mstop')
+
+    def __init__(self, window=16):
+        self.window = window
+        self.received = 0       # frames received since the last grant
+        self.cmd_slots = 1      # until the first "credit:" reply
+        self.stalls = 0         # commands that had to wait for a free slot
+
+    def grant(self):
+        """Command for the initial grant; call after enabling binary telemetry."""
+        self.received = 0
+        return f"credit {self.window}"
+
+    def on_frame(self):
+        """Count one received frame; returns a top-up command when one is due, else None."""
+        self.received += 1
+        if self.received >= self.window // 2:
+            n, self.received = self.received, 0
+            return f"credit {n}"
+        return None
+
+    def on_line(self, line):
+        """Track the device's free command slots; returns True if the line was a credit reply."""
+        if line.startswith('credit:'):
+            self.cmd_slots = int(line[len('credit:'):])
+            return True
+        return False
+
+    def needs_slot(self, message):
+        return message.split(' ', 1)[0] not in self.URGENT
+
+
+class ClockSync:
+    """NTP-style estimate of the device microsecond clock against the host clock.
+
+    The host sends "sync <n>" at t1 and gets "sync:<n>,<t2>,<t3>" back at t4.
+    t2 is when the device receive interrupt saw the command, and t3 is when
+    the reply was queued; both are device microseconds. Each exchange gives
+    offset = ((t2 - t1) + (t3 - t4)) / 2, with an error of at most half the
+    round trip (t4 - t1) - (t3 - t2). BLE connection intervals make most round
+    trips slow, and a slow one is usually slow in one direction only. So only
+    the exchanges within DELAY_SLACK_S of the fastest are used. A least-squares
+    line through their offsets gives the offset and the drift between the clocks.
+    """
+
+    WINDOW = 32             # recent exchanges kept
+    BEST = 8                # most exchanges used in the fit
+    DELAY_SLACK_S = 0.002   # how much slower than the fastest round trip an exchange may be to be used
+    MIN_SPAN_S = 10.0       # device time the fit must span before drift is estimated
+    PENDING_MAX = 16        # unanswered requests remembered
+
+    def __init__(self, clock=time.time):
+        self.clock = clock
+        self.n = 0
+        self.pending = {}       # n -> t1
+        self.points = []        # (device s, offset s, round trip s), oldest first
+        self.last_us = None     # device clock of the last timestamp seen, unwrapped
+        self.fit = None         # (device s at the fit centre, offset s there, drift s/s)
+
+    @property
+    def ready(self):
+        return self.fit is not None
+
+    @property
+    def error(self):
+        """Error bound of the best exchange in seconds, or None before the first one."""
+        return min(p[2] for p in self.points) / 2 if self.points else None
+
+    def request(self):
+        """Command for one exchange; send it straight away so t1 is accurate."""
+        self.n += 1
+        self.pending[self.n] = self.clock()
+        while len(self.pending) > self.PENDING_MAX:
+            del self.pending[min(self.pending)]
+        return f"sync {self.n}"
+
+    def unwrap(self, t_us):
+        """Device seconds from a 32-bit microsecond value (it wraps every 71.6 minutes)."""
+        if self.last_us is None:
+            self.last_us = t_us
+        else:
+            self.last_us += ((t_us - self.last_us + 2**31) % 2**32) - 2**31
+        return self.last_us / 1e6
+
+    def on_reply(self, line):
+        """Handle "sync:<n>,<t2>,<t3>"; returns the round trip in seconds, or None if the line is unusable."""
+        t4 = self.clock()
+        try:
+            n, t2, t3 = (int(v) for v in line[len('sync:'):].split(','))
+        except ValueError:
+            return None
+        t1 = self.pending.pop(n, None)
+        if t1 is None:
+            return None
+        d2 = self.unwrap(t2)
+        d3 = self.unwrap(t3)
+        delay = (t4 - t1) - (d3 - d2)
+        self.points.append((d2, ((d2 - t1) + (d3 - t4)) / 2, delay))
+        del self.points[:-self.WINDOW]
+        self._refit()
+        return delay
+
+    def _refit(self):
+        fastest = min(p[2] for p in self.points)
+        best = sorted((p for p in self.points if p[2] <= fastest + self.DELAY_SLACK_S), key=lambda p: p[2])[:self.BEST]
+        xm = sum(p[0] for p in best) / len(best)
+        ym = sum(p[1] for p in best) / len(best)
+        sxx = sum((p[0] - xm) ** 2 for p in best)
+        drift = self.fit[2] if self.fit else 0.0    # too few points spread out: keep the last estimate
+        if max(p[0] for p in best) - min(p[0] for p in best) >= self.MIN_SPAN_S:
+            drift = sum((p[0] - xm) * (p[1] - ym) for p in best) / sxx
+        self.fit = (xm, ym, drift)
+
+    def to_host(self, t_us):
+        """Host time (seconds, same clock as `clock`) of a device timestamp; needs `ready`."""
+        x = self.unwrap(t_us)
+        xm, ym, drift = self.fit
+        return x - (ym + drift * (x - xm))